@@ -0,0 +1,1080 @@
+/**
+ *  @file       AudioMixer.cpp
+ *  @brief      CAudioMixer class implementation
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ */
+
+#include "targetver.h"  // this needs to be the 1st header included
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+
+#include <emmintrin.h>  // SSE2
+
+#include "Engine/Utility/BitUtils.h"
+#include "Engine/Utility/Stats.h"
+
+#include "AudioMixer.h"
+
+namespace eng
+{
+namespace audio
+{
+
+//-----------------------------------------------------------------------------------------------
+void MixMonoToStereo(float* pAccum, const float* pSrc, size_t nFrames, float fGainL, float fGainR) noexcept
+{
+    const __m128 vGain = _mm_setr_ps(fGainL, fGainR, fGainL, fGainR);
+
+    size_t i = 0;
+    for (; i + 4 <= nFrames; i += 4)
+    {
+        const __m128 vSrc = _mm_loadu_ps(pSrc + i);
+        const __m128 vLo  = _mm_unpacklo_ps(vSrc, vSrc);   // s0 s0 s1 s1
+        const __m128 vHi  = _mm_unpackhi_ps(vSrc, vSrc);   // s2 s2 s3 s3
+
+        float* pOut = pAccum + i * 2;
+        _mm_storeu_ps(pOut,     _mm_add_ps(_mm_loadu_ps(pOut),     _mm_mul_ps(vLo, vGain)));
+        _mm_storeu_ps(pOut + 4, _mm_add_ps(_mm_loadu_ps(pOut + 4), _mm_mul_ps(vHi, vGain)));
+    }
+
+    for (; i < nFrames; i++)
+    {
+        pAccum[i * 2]     += pSrc[i] * fGainL;
+        pAccum[i * 2 + 1] += pSrc[i] * fGainR;
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+void MixStereoToStereo(float* pAccum, const float* pSrc, size_t nFrames, float fGainL, float fGainR) noexcept
+{
+    const __m128 vGain    = _mm_setr_ps(fGainL, fGainR, fGainL, fGainR);
+    const size_t nSamples = nFrames * 2;
+
+    size_t i = 0;
+    for (; i + 4 <= nSamples; i += 4)
+        _mm_storeu_ps(pAccum + i, _mm_add_ps(_mm_loadu_ps(pAccum + i), _mm_mul_ps(_mm_loadu_ps(pSrc + i), vGain)));
+
+    for (; i < nSamples; i += 2)
+    {
+        pAccum[i]     += pSrc[i]     * fGainL;
+        pAccum[i + 1] += pSrc[i + 1] * fGainR;
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+void MixMonoResampled(float* pAccum, const float* pSrc, float fStart, float fStep, size_t nFrames, float fGainL, float fGainR) noexcept
+{
+    const __m128 vGain  = _mm_setr_ps(fGainL, fGainR, fGainL, fGainR);
+    const __m128 vStart = _mm_set1_ps(fStart);
+    const __m128 vStep  = _mm_set1_ps(fStep);
+    const __m128 vLane  = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+
+    alignas(16) int32_t rgIdx[4];
+
+    // positions are recomputed from the frame number, not accumulated, so
+    // rounding does not drift across the block
+    size_t i = 0;
+    for (; i + 4 <= nFrames; i += 4)
+    {
+        const __m128  vPos = _mm_add_ps(vStart, _mm_mul_ps(_mm_add_ps(_mm_set1_ps(static_cast<float>(i)), vLane), vStep));
+        const __m128i vIdx = _mm_cvttps_epi32(vPos);    // positions are >= 0, truncation is floor
+        const __m128  vT   = _mm_sub_ps(vPos, _mm_cvtepi32_ps(vIdx));
+
+        _mm_store_si128(reinterpret_cast<__m128i*>(rgIdx), vIdx);
+
+        const __m128 vS0 = _mm_setr_ps(pSrc[rgIdx[0]],     pSrc[rgIdx[1]],     pSrc[rgIdx[2]],     pSrc[rgIdx[3]]);
+        const __m128 vS1 = _mm_setr_ps(pSrc[rgIdx[0] + 1], pSrc[rgIdx[1] + 1], pSrc[rgIdx[2] + 1], pSrc[rgIdx[3] + 1]);
+        const __m128 vS  = _mm_add_ps(vS0, _mm_mul_ps(vT, _mm_sub_ps(vS1, vS0)));
+
+        const __m128 vLo = _mm_unpacklo_ps(vS, vS);
+        const __m128 vHi = _mm_unpackhi_ps(vS, vS);
+
+        float* pOut = pAccum + i * 2;
+        _mm_storeu_ps(pOut,     _mm_add_ps(_mm_loadu_ps(pOut),     _mm_mul_ps(vLo, vGain)));
+        _mm_storeu_ps(pOut + 4, _mm_add_ps(_mm_loadu_ps(pOut + 4), _mm_mul_ps(vHi, vGain)));
+    }
+
+    for (; i < nFrames; i++)
+    {
+        const float  fPos = fStart + static_cast<float>(i) * fStep;
+        const size_t nIdx = static_cast<size_t>(fPos);
+        const float  fT   = fPos - static_cast<float>(nIdx);
+        const float  fS   = pSrc[nIdx] + fT * (pSrc[nIdx + 1] - pSrc[nIdx]);
+
+        pAccum[i * 2]     += fS * fGainL;
+        pAccum[i * 2 + 1] += fS * fGainR;
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+void MixStereoResampled(float* pAccum, const float* pSrc, float fStart, float fStep, size_t nFrames, float fGainL, float fGainR) noexcept
+{
+    const __m128 vGain  = _mm_setr_ps(fGainL, fGainR, fGainL, fGainR);
+    const __m128 vStart = _mm_set1_ps(fStart);
+    const __m128 vStep  = _mm_set1_ps(fStep);
+    const __m128 vLane  = _mm_setr_ps(0.0f, 0.0f, 1.0f, 1.0f);   // two frames, both channels
+
+    alignas(16) int32_t rgIdx[4];
+
+    size_t i = 0;
+    for (; i + 2 <= nFrames; i += 2)
+    {
+        const __m128  vPos = _mm_add_ps(vStart, _mm_mul_ps(_mm_add_ps(_mm_set1_ps(static_cast<float>(i)), vLane), vStep));
+        const __m128i vIdx = _mm_cvttps_epi32(vPos);
+        const __m128  vT   = _mm_sub_ps(vPos, _mm_cvtepi32_ps(vIdx));
+
+        _mm_store_si128(reinterpret_cast<__m128i*>(rgIdx), vIdx);
+
+        const float* p0 = pSrc + rgIdx[0] * 2;
+        const float* p1 = pSrc + rgIdx[2] * 2;
+
+        const __m128 vS0 = _mm_setr_ps(p0[0], p0[1], p1[0], p1[1]);
+        const __m128 vS1 = _mm_setr_ps(p0[2], p0[3], p1[2], p1[3]);
+        const __m128 vS  = _mm_add_ps(vS0, _mm_mul_ps(vT, _mm_sub_ps(vS1, vS0)));
+
+        float* pOut = pAccum + i * 2;
+        _mm_storeu_ps(pOut, _mm_add_ps(_mm_loadu_ps(pOut), _mm_mul_ps(vS, vGain)));
+    }
+
+    for (; i < nFrames; i++)
+    {
+        const float  fPos = fStart + static_cast<float>(i) * fStep;
+        const size_t nIdx = static_cast<size_t>(fPos);
+        const float  fT   = fPos - static_cast<float>(nIdx);
+        const float* p    = pSrc + nIdx * 2;
+
+        pAccum[i * 2]     += (p[0] + fT * (p[2] - p[0])) * fGainL;
+        pAccum[i * 2 + 1] += (p[1] + fT * (p[3] - p[1])) * fGainR;
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+void ConvertToInt16(const float* pSrc, int16_t* pDst, size_t nSamples) noexcept
+{
+    const __m128 vMin   = _mm_set1_ps(-1.0f);
+    const __m128 vMax   = _mm_set1_ps( 1.0f);
+    const __m128 vScale = _mm_set1_ps(32767.0f);
+
+    // clamp before converting: _mm_cvtps_epi32 turns out of range values into INT_MIN
+    size_t i = 0;
+    for (; i + 8 <= nSamples; i += 8)
+    {
+        const __m128 vA = _mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(pSrc + i),     vMin), vMax), vScale);
+        const __m128 vB = _mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(pSrc + i + 4), vMin), vMax), vScale);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + i),
+                         _mm_packs_epi32(_mm_cvtps_epi32(vA), _mm_cvtps_epi32(vB)));
+    }
+
+    for (; i < nSamples; i++)
+    {
+        const float f = std::min(std::max(pSrc[i], -1.0f), 1.0f) * 32767.0f;
+        pDst[i] = static_cast<int16_t>(std::lrint(f));
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+CAudioMixer::CAudioMixer(uint32_t nSampleRate /* = k_nMixerSampleRate */, size_t nBlockFrames /* = k_nMixerBlockFrames */)
+    : m_rgSounds(),
+      m_rgVoiceSound(),
+      m_rgVoiceStreamRef(),
+      m_rgVoiceStream(),
+      m_rgVoiceSamples(),
+      m_rgVoiceFrames(),
+      m_rgVoiceChannels(),
+      m_rgVoiceSoundId(),
+      m_rgPosition(),
+      m_rgVolume(),
+      m_rgPan(),
+      m_rgSourceX(),
+      m_rgSourceY(),
+      m_rgPitch(),
+      m_rgFraction(),
+      m_rgStartTime(),
+      m_rgGainL(),
+      m_rgGainR(),
+      m_rgGeneration(),
+      m_nActiveMask(0),
+      m_nLoopMask(0),
+      m_nPositionalMask(0),
+      m_nPitchedMask(0),
+      m_nUnheardMask(0),
+      m_Field(k_DefaultListenerField),
+      m_fMasterVolume(1.0f),
+      m_mtxVoices(),
+      m_rgAccum(nBlockFrames * k_nMixerChannels),                       // note - may throw an exception
+      m_Ring(nBlockFrames * k_nMixerChannels * k_nMixerRingBlocks),     // note - may throw an exception
+      m_pSink(nullptr),
+      m_thMixer(),
+      m_thOutput(),
+      m_bRunning(false),
+      m_nSampleRate(nSampleRate),
+      m_nBlockFrames(nBlockFrames),
+      m_rgPending(),
+      m_nPendingHead(0),
+      m_nPendingTail(0),
+      m_mtxPending(),
+      m_nFramesQueued(0),
+      m_nFramesRead(0),
+      m_pStats(nullptr),
+      m_iStatLatency(-1),
+      m_iStatMixTime(-1),
+      m_iStatQueueDepth(-1),
+      m_iStatUnderruns(-1),
+      m_iStatStarves(-1),
+      m_nBlocks(0),
+      m_nVoiceBlocks(0),
+      m_nMixNanoseconds(0),
+      m_nUnderruns(0),
+      m_nFramesOut(0),
+      m_nStreamStarves(0),
+      m_nPitchedBlocks(0)
+{
+};
+
+//-----------------------------------------------------------------------------------------------
+CAudioMixer::~CAudioMixer() noexcept
+{
+    StopOutput();
+};
+
+//-----------------------------------------------------------------------------------------------
+int CAudioMixer::AddSound(const PcmBuffer& pcm)
+{
+    auto pSound = std::make_shared<PcmBuffer>();        // note - may throw an exception
+    ConvertSampleRate(pcm, m_nSampleRate, *pSound);     // note - may throw an exception
+
+    std::lock_guard<std::mutex> lock(m_mtxVoices);
+    m_rgSounds.push_back(std::move(pSound));            // note - may throw an exception
+    return static_cast<int>(m_rgSounds.size() - 1);
+};
+
+//-----------------------------------------------------------------------------------------------
+bool CAudioMixer::ReplaceSound(int iSound, const PcmBuffer& pcm) noexcept
+{
+    PcmBufferPtr pSound;
+    try
+    {
+        auto pNew = std::make_shared<PcmBuffer>();
+        ConvertSampleRate(pcm, m_nSampleRate, *pNew);
+        pSound = std::move(pNew);
+    }
+    catch (...)
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mtxVoices);
+
+    if (iSound < 0 || iSound >= static_cast<int>(m_rgSounds.size()))
+        return false;
+
+    for (uint64_t nMask = m_nActiveMask; nMask; nMask &= nMask - 1)
+    {
+        const int iVoice = util::LowestSetBit(nMask);
+        if (m_rgVoiceSoundId[iVoice] == iSound)
+        {
+            m_nActiveMask &= ~(1ull << iVoice);
+            m_rgVoiceSound[iVoice].reset();
+        }
+    }
+
+    m_rgSounds[iSound] = std::move(pSound);
+    return true;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CAudioMixer::UpdateGains(void) noexcept
+{
+    const __m128  vCenterX  = _mm_set1_ps(m_Field.get_CenterX());
+    const __m128  vCenterY  = _mm_set1_ps(m_Field.get_CenterY());
+    const __m128  vInvHalfW = _mm_set1_ps(2.0f / (m_Field.fRight - m_Field.fLeft));
+    const __m128  vInvHalfH = _mm_set1_ps(2.0f / (m_Field.fTop - m_Field.fBottom));
+    const __m128  vRolloff  = _mm_set1_ps(m_Field.fRolloff);
+    const __m128  vMaster   = _mm_set1_ps(m_fMasterVolume);
+    const __m128  vOne      = _mm_set1_ps(1.0f);
+    const __m128  vMinusOne = _mm_set1_ps(-1.0f);
+    const __m128  vHalf     = _mm_set1_ps(0.5f);
+    const __m128  vZero     = _mm_setzero_ps();
+    const __m128i vLaneBits = _mm_setr_epi32(1, 2, 4, 8);
+
+    for (int i = 0; i < k_nMaxMixerVoices; i += 4)
+    {
+        if (((m_nActiveMask >> i) & 0xF) == 0)
+            continue;
+
+        // all ones in the lanes of positional voices
+        const __m128i vBits       = _mm_set1_epi32(static_cast<int>((m_nPositionalMask >> i) & 0xF));
+        const __m128  vPositional = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(vBits, vLaneBits), vLaneBits));
+
+        const __m128 vDX = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(m_rgSourceX + i), vCenterX), vInvHalfW);
+        const __m128 vDY = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(m_rgSourceY + i), vCenterY), vInvHalfH);
+        const __m128 vDistSq = _mm_add_ps(_mm_mul_ps(vDX, vDX), _mm_mul_ps(vDY, vDY));
+        const __m128 vAtten  = _mm_div_ps(vOne, _mm_add_ps(vOne, _mm_mul_ps(vRolloff, vDistSq)));
+
+        __m128 vPan = _mm_or_ps(_mm_and_ps(vPositional, vDX), _mm_andnot_ps(vPositional, _mm_loadu_ps(m_rgPan + i)));
+        vPan = _mm_min_ps(_mm_max_ps(vPan, vMinusOne), vOne);
+
+        const __m128 vGain = _mm_mul_ps(_mm_mul_ps(_mm_loadu_ps(m_rgVolume + i), vMaster),
+                                        _mm_or_ps(_mm_and_ps(vPositional, vAtten), _mm_andnot_ps(vPositional, vOne)));
+
+        // equal power: gL^2 + gR^2 == gain^2 across the whole pan range
+        const __m128 vLeft  = _mm_sqrt_ps(_mm_max_ps(_mm_mul_ps(_mm_sub_ps(vOne, vPan), vHalf), vZero));
+        const __m128 vRight = _mm_sqrt_ps(_mm_max_ps(_mm_mul_ps(_mm_add_ps(vOne, vPan), vHalf), vZero));
+
+        _mm_storeu_ps(m_rgGainL + i, _mm_mul_ps(vGain, vLeft));
+        _mm_storeu_ps(m_rgGainR + i, _mm_mul_ps(vGain, vRight));
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+int CAudioMixer::FindVoice(MixerVoice hVoice) const noexcept
+{
+    const int iVoice = static_cast<int>(hVoice & 0xFF) - 1;
+
+    if (iVoice < 0 || iVoice >= k_nMaxMixerVoices ||
+        m_rgGeneration[iVoice] != (hVoice >> 8) ||
+        (m_nActiveMask & (1ull << iVoice)) == 0)
+        return -1;
+
+    return iVoice;
+};
+
+//-----------------------------------------------------------------------------------------------
+MixerVoice CAudioMixer::StartVoice(int iVoice, int iSound, float fVolume, float fPan) noexcept
+{
+    // generation lives in the upper 24 bits of the handle and skips 0
+    uint32_t nGeneration = (m_rgGeneration[iVoice] + 1) & 0x00FFFFFF;
+    if (nGeneration == 0)
+        nGeneration = 1;
+
+    m_rgGeneration[iVoice]    = nGeneration;
+    m_rgVoiceSoundId[iVoice]  = iSound;
+    m_rgPosition[iVoice]      = 0;
+    m_rgFraction[iVoice]      = 0.0f;
+    m_rgPitch[iVoice]         = 1.0f;
+    m_rgStartTime[iVoice]     = std::chrono::steady_clock::now();
+    m_rgVolume[iVoice]        = std::max(fVolume, 0.0f);
+    m_rgPan[iVoice]           = fPan;
+
+    m_nActiveMask     |= 1ull << iVoice;
+    m_nPositionalMask &= ~(1ull << iVoice);
+    m_nPitchedMask    &= ~(1ull << iVoice);
+    m_nUnheardMask    |= 1ull << iVoice;
+
+    return (nGeneration << 8) | static_cast<uint32_t>(iVoice + 1);
+};
+
+//-----------------------------------------------------------------------------------------------
+MixerVoice CAudioMixer::Play(int iSound, float fVolume /* = 1.0f */, float fPan /* = 0.0f */, bool bLoop /* = false */) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mtxVoices);
+    return StartSound(iSound, fVolume, fPan, bLoop);
+};
+
+//-----------------------------------------------------------------------------------------------
+MixerVoice CAudioMixer::PlayAt(int iSound, float fX, float fY, float fVolume /* = 1.0f */, bool bLoop /* = false */) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mtxVoices);
+
+    const MixerVoice hVoice = StartSound(iSound, fVolume, 0.0f, bLoop);
+    if (hVoice)
+    {
+        const int iVoice = static_cast<int>(hVoice & 0xFF) - 1;
+        m_rgSourceX[iVoice] = fX;
+        m_rgSourceY[iVoice] = fY;
+        m_nPositionalMask  |= 1ull << iVoice;
+    }
+    return hVoice;
+};
+
+//-----------------------------------------------------------------------------------------------
+MixerVoice CAudioMixer::StartSound(int iSound, float fVolume, float fPan, bool bLoop) noexcept
+{
+    if (iSound < 0 || iSound >= static_cast<int>(m_rgSounds.size()) || ~m_nActiveMask == 0)
+        return 0;
+
+    const int iVoice = util::LowestSetBit(~m_nActiveMask);
+    const PcmBufferPtr& pSound = m_rgSounds[iSound];
+
+    // a finished stream left in this slot has already stopped its producer
+    m_rgVoiceStreamRef[iVoice].reset();
+    m_rgVoiceStream[iVoice]   = nullptr;
+    m_rgVoiceSound[iVoice]    = pSound;
+    m_rgVoiceSamples[iVoice]  = pSound->rgSamples.data();
+    m_rgVoiceFrames[iVoice]   = pSound->get_FrameCount();
+    m_rgVoiceChannels[iVoice] = pSound->nChannels;
+
+    const uint64_t nBit = 1ull << iVoice;
+    m_nLoopMask = bLoop ? (m_nLoopMask | nBit) : (m_nLoopMask & ~nBit);
+
+    return StartVoice(iVoice, iSound, fVolume, fPan);
+};
+
+//-----------------------------------------------------------------------------------------------
+MixerVoice CAudioMixer::PlayStream(const std::shared_ptr<CWaveStream>& pStream, float fVolume /* = 1.0f */, float fPan /* = 0.0f */) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mtxVoices);
+
+    if (!pStream || pStream->IsFinished() || ~m_nActiveMask == 0)
+        return 0;
+
+    const int iVoice = util::LowestSetBit(~m_nActiveMask);
+
+    m_rgVoiceSound[iVoice].reset();
+    m_rgVoiceStreamRef[iVoice] = pStream;
+    m_rgVoiceStream[iVoice]    = pStream.get();
+    m_rgVoiceSamples[iVoice]   = nullptr;
+    m_rgVoiceFrames[iVoice]    = 0;
+    m_rgVoiceChannels[iVoice]  = pStream->get_Channels();
+    m_nLoopMask &= ~(1ull << iVoice);
+
+    return StartVoice(iVoice, -1, fVolume, fPan);
+};
+
+//-----------------------------------------------------------------------------------------------
+void CAudioMixer::Stop(MixerVoice hVoice) noexcept
+{
+    WaveStreamPtr pStream;
+    {
+        std::lock_guard<std::mutex> lock(m_mtxVoices);
+
+        const int iVoice = FindVoice(hVoice);
+        if (iVoice != -1)
+        {
+            m_nActiveMask &= ~(1ull << iVoice);
+            m_rgVoiceSound[iVoice].reset();
+            m_rgVoiceStream[iVoice] = nullptr;
+            pStream.swap(m_rgVoiceStreamRef[iVoice]);
+        }
+    }
+    // a stream joins its producer thread on release; not while mixing is blocked
+};
+
+//-----------------------------------------------------------------------------------------------
+void CAudioMixer::StopAll(void) noexcept
+{
+    WaveStreamPtr rgStreams[k_nMaxMixerVoices];
+    {
+        std::lock_guard<std::mutex> lock(m_mtxVoices);
+
+        m_nActiveMask = 0;
+        for (int i = 0; i < k_nMaxMixerVoices; i++)
+        {
+            m_rgVoiceSound[i].reset();
+            m_rgVoiceStream[i] = nullptr;
+            rgStreams[i].swap(m_rgVoiceStreamRef[i]);
+        }
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+bool CAudioMixer::IsPlaying(MixerVoice hVoice) const noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mtxVoices);
+    return FindVoice(hVoice) != -1;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CAudioMixer::SetVolume(MixerVoice hVoice, float fVolume) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mtxVoices);
+
+    const int iVoice = FindVoice(hVoice);
+    if (iVoice != -1)
+        m_rgVolume[iVoice] = std::max(fVolume, 0.0f);
+};
+
+//-----------------------------------------------------------------------------------------------
+void CAudioMixer::SetPan(MixerVoice hVoice, float fPan) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mtxVoices);
+
+    const int iVoice = FindVoice(hVoice);
+    if (iVoice != -1)
+    {
+        m_rgPan[iVoice]    = fPan;
+        m_nPositionalMask &= ~(1ull << iVoice);
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+void CAudioMixer::SetPosition(MixerVoice hVoice, float fX, float fY) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mtxVoices);
+
+    const int iVoice = FindVoice(hVoice);
+    if (iVoice != -1)
+    {
+        m_rgSourceX[iVoice] = fX;
+        m_rgSourceY[iVoice] = fY;
+        m_nPositionalMask  |= 1ull << iVoice;
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+void CAudioMixer::SetPitch(MixerVoice hVoice, float fRatio) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mtxVoices);
+
+    const int iVoice = FindVoice(hVoice);
+    if (iVoice != -1 && m_rgVoiceStream[iVoice] == nullptr)
+    {
+        const uint64_t nBit = 1ull << iVoice;
+
+        m_rgPitch[iVoice] = std::min(std::max(fRatio, k_fMixerMinPitch), k_fMixerMaxPitch);
+        m_nPitchedMask    = (m_rgPitch[iVoice] != 1.0f) ? (m_nPitchedMask | nBit) : (m_nPitchedMask & ~nBit);
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+void CAudioMixer::SetMasterVolume(float fVolume) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mtxVoices);
+
+    m_fMasterVolume = std::max(fVolume, 0.0f);
+};
+
+//-----------------------------------------------------------------------------------------------
+void CAudioMixer::SetListenerField(const ListenerField& field) noexcept
+{
+    if (field.IsValid())
+    {
+        std::lock_guard<std::mutex> lock(m_mtxVoices);
+        m_Field = field;
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+int CAudioMixer::get_SoundCount(void) const noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mtxVoices);
+    return static_cast<int>(m_rgSounds.size());
+};
+
+//-----------------------------------------------------------------------------------------------
+int CAudioMixer::get_ActiveVoices(void) const noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mtxVoices);
+
+    int nVoices = 0;
+    for (uint64_t nMask = m_nActiveMask; nMask; nMask &= nMask - 1)
+        nVoices++;
+    return nVoices;
+};
+
+//-----------------------------------------------------------------------------------------------
+MixerStats CAudioMixer::get_Stats(void) const noexcept
+{
+    MixerStats stats;
+    stats.nBlocks      = m_nBlocks.load(std::memory_order_relaxed);
+    stats.nVoiceBlocks = m_nVoiceBlocks.load(std::memory_order_relaxed);
+    stats.dMixSeconds  = m_nMixNanoseconds.load(std::memory_order_relaxed) * 1.0e-9;
+    stats.nUnderruns   = m_nUnderruns.load(std::memory_order_relaxed);
+    stats.nFramesOut   = m_nFramesOut.load(std::memory_order_relaxed);
+    stats.nStreamStarves = m_nStreamStarves.load(std::memory_order_relaxed);
+    stats.nPitchedBlocks = m_nPitchedBlocks.load(std::memory_order_relaxed);
+    return stats;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CAudioMixer::MixBlock(size_t nFrames) noexcept
+{
+    float* pAccum = m_rgAccum.data();
+    memset(pAccum, 0, nFrames * k_nMixerChannels * sizeof(float));
+
+    uint64_t nVoices  = 0;
+    uint64_t nPitched = 0;
+
+    std::lock_guard<std::mutex> lock(m_mtxVoices);
+
+    // voices heard for the first time in this block
+    const uint64_t nStarting = m_nUnheardMask & m_nActiveMask;
+    m_nUnheardMask = 0;
+
+    UpdateGains();
+
+    for (uint64_t nMask = m_nActiveMask; nMask; nMask &= nMask - 1)
+    {
+        const int      iVoice    = util::LowestSetBit(nMask);
+        const uint64_t nBit      = 1ull << iVoice;
+
+        if (m_rgVoiceStream[iVoice])
+        {
+            nVoices++;
+            if (MixStream(iVoice, pAccum, nFrames) < nFrames && !m_rgVoiceStream[iVoice]->IsFinished())
+            {
+                m_rgVoiceStream[iVoice]->OnStarved();
+                m_nStreamStarves.fetch_add(1, std::memory_order_relaxed);
+                if (m_pStats)
+                    m_pStats->Add(m_iStatStarves);
+            }
+
+            if (m_rgVoiceStream[iVoice]->IsFinished())
+                m_nActiveMask &= ~nBit;
+            continue;
+        }
+
+        if (m_nPitchedMask & nBit)
+        {
+            nVoices++;
+            nPitched++;
+            if (!MixPitched(iVoice, pAccum, nFrames))
+                m_nActiveMask &= ~nBit;
+            continue;
+        }
+
+        const size_t   nLength   = m_rgVoiceFrames[iVoice];
+        const int      nChannels = m_rgVoiceChannels[iVoice];
+        const float*   pSamples  = m_rgVoiceSamples[iVoice];
+
+        nVoices++;
+
+        size_t nDone = 0;
+        while (nDone < nFrames)
+        {
+            const size_t nPos  = m_rgPosition[iVoice];
+            const size_t nTake = std::min(nFrames - nDone, nLength - nPos);
+
+            if (nChannels == 1)
+                MixMonoToStereo(pAccum + nDone * 2, pSamples + nPos, nTake, m_rgGainL[iVoice], m_rgGainR[iVoice]);
+            else
+                MixStereoToStereo(pAccum + nDone * 2, pSamples + nPos * 2, nTake, m_rgGainL[iVoice], m_rgGainR[iVoice]);
+
+            nDone += nTake;
+            m_rgPosition[iVoice] = nPos + nTake;
+
+            if (m_rgPosition[iVoice] >= nLength)
+            {
+                if ((m_nLoopMask & nBit) && nLength)
+                {
+                    m_rgPosition[iVoice] = 0;
+                }
+                else
+                {
+                    // the source reference is dropped by the next Play() on this slot
+                    m_nActiveMask &= ~nBit;
+                    break;
+                }
+            }
+        }
+    }
+
+    m_nVoiceBlocks.fetch_add(nVoices, std::memory_order_relaxed);
+    m_nPitchedBlocks.fetch_add(nPitched, std::memory_order_relaxed);
+
+    // only blocks bound for the ring reach a sink, headless renders are not timed
+    if (nStarting && m_pStats && m_pSink)
+        QueueStarts(nStarting);
+};
+
+//-----------------------------------------------------------------------------------------------
+void CAudioMixer::QueueStarts(uint64_t nStartMask) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mtxPending);
+
+    for (uint64_t nMask = nStartMask; nMask; nMask &= nMask - 1)
+    {
+        // a full queue drops the sample, not the sound
+        if (m_nPendingTail - m_nPendingHead >= k_nMixerLatencyQueue)
+            break;
+
+        PendingStart& start = m_rgPending[m_nPendingTail % k_nMixerLatencyQueue];
+        start.nFrame  = m_nFramesQueued;
+        start.tmStart = m_rgStartTime[util::LowestSetBit(nMask)];
+        m_nPendingTail++;
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+void CAudioMixer::RetireStarts(uint64_t nFramesRead) noexcept
+{
+    const auto tmNow = std::chrono::steady_clock::now();
+
+    std::lock_guard<std::mutex> lock(m_mtxPending);
+
+    while (m_nPendingHead != m_nPendingTail)
+    {
+        const PendingStart& start = m_rgPending[m_nPendingHead % k_nMixerLatencyQueue];
+        if (start.nFrame >= nFramesRead)
+            break;
+
+        m_pStats->Record(m_iStatLatency, std::chrono::duration<double, std::milli>(tmNow - start.tmStart).count());
+        m_nPendingHead++;
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+void CAudioMixer::WriteToRing(const int16_t* pSamples) noexcept
+{
+    m_Ring.Write(pSamples, m_nBlockFrames * k_nMixerChannels);
+    m_nFramesQueued += m_nBlockFrames;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CAudioMixer::AttachStats(util::CStats* pStats) noexcept
+{
+    if (m_bRunning || pStats == nullptr)
+        return;
+
+    m_iStatLatency    = pStats->Register("audio.latency",        "ms",      true);
+    m_iStatMixTime    = pStats->Register("audio.mix_block",      "us",      true);
+    m_iStatQueueDepth = pStats->Register("audio.queue_depth",    "ms",      true);
+    m_iStatUnderruns  = pStats->Register("audio.underruns",      "blocks",  false);
+    m_iStatStarves    = pStats->Register("audio.stream_starves", "blocks",  false);
+    m_pStats          = pStats;
+};
+
+//-----------------------------------------------------------------------------------------------
+bool CAudioMixer::MixPitched(int iVoice, float* pAccum, size_t nFrames) noexcept
+{
+    // frames within this margin of the last source frame go through the
+    // scalar step below, which covers float rounding of the SIMD positions
+    constexpr double k_dTapMargin = 1.0 / 64.0;
+
+    const size_t   nLength   = m_rgVoiceFrames[iVoice];
+    const int      nChannels = m_rgVoiceChannels[iVoice];
+    const float*   pSamples  = m_rgVoiceSamples[iVoice];
+    const float    fStep     = m_rgPitch[iVoice];
+    const float    fGainL    = m_rgGainL[iVoice];
+    const float    fGainR    = m_rgGainR[iVoice];
+    const bool     bLoop     = (m_nLoopMask & (1ull << iVoice)) != 0;
+
+    size_t nPos  = m_rgPosition[iVoice];
+    double dFrac = m_rgFraction[iVoice];
+
+    size_t nDone = 0;
+    while (nDone < nFrames)
+    {
+        if (nPos >= nLength)
+        {
+            if (!bLoop || nLength == 0)
+                return false;
+            nPos %= nLength;
+        }
+
+        // output frames whose taps both lie inside the sound
+        const double dSpan = static_cast<double>(nLength - 1 - nPos) - dFrac - k_dTapMargin;
+        const size_t nTake = (nPos + 1 < nLength && dSpan > 0.0)
+                           ? std::min(nFrames - nDone, static_cast<size_t>(dSpan / fStep) + 1) : 0;
+
+        if (nTake)
+        {
+            if (nChannels == 1)
+                MixMonoResampled(pAccum + nDone * 2, pSamples + nPos, static_cast<float>(dFrac), fStep, nTake, fGainL, fGainR);
+            else
+                MixStereoResampled(pAccum + nDone * 2, pSamples + nPos * 2, static_cast<float>(dFrac), fStep, nTake, fGainL, fGainR);
+
+            dFrac += static_cast<double>(nTake) * fStep;
+            nDone += nTake;
+        }
+        else
+        {
+            // last frame of the sound: the second tap wraps for a loop, else is silence
+            const size_t nNext = (nPos + 1 < nLength) ? nPos + 1 : (bLoop ? 0 : nLength);
+            const float  fT    = static_cast<float>(dFrac);
+
+            for (int iCh = 0; iCh < 2; iCh++)
+            {
+                const int   iSrc = (nChannels == 1) ? 0 : iCh;
+                const float fS0  = pSamples[nPos * nChannels + iSrc];
+                const float fS1  = (nNext < nLength) ? pSamples[nNext * nChannels + iSrc] : 0.0f;
+
+                pAccum[nDone * 2 + iCh] += (fS0 + fT * (fS1 - fS0)) * (iCh ? fGainR : fGainL);
+            }
+
+            dFrac += fStep;
+            nDone++;
+        }
+
+        const double dWhole = std::floor(dFrac);
+        nPos  += static_cast<size_t>(dWhole);
+        dFrac -= dWhole;
+    }
+
+    m_rgPosition[iVoice] = nPos;
+    m_rgFraction[iVoice] = static_cast<float>(dFrac);
+
+    if (nPos >= nLength && !bLoop)
+        return false;
+
+    return true;
+};
+
+//-----------------------------------------------------------------------------------------------
+size_t CAudioMixer::MixStream(int iVoice, float* pAccum, size_t nFrames) noexcept
+{
+    CWaveStream* pStream = m_rgVoiceStream[iVoice];
+    const int    nChannels = m_rgVoiceChannels[iVoice];
+
+    size_t nDone = 0;
+    while (nDone < nFrames)
+    {
+        size_t nSpan = 0;
+        const float* pSamples = pStream->get_Span(nSpan);
+        if (pSamples == nullptr)
+            break;
+
+        const size_t nTake = std::min(nFrames - nDone, nSpan);
+        if (nChannels == 1)
+            MixMonoToStereo(pAccum + nDone * 2, pSamples, nTake, m_rgGainL[iVoice], m_rgGainR[iVoice]);
+        else
+            MixStereoToStereo(pAccum + nDone * 2, pSamples, nTake, m_rgGainL[iVoice], m_rgGainR[iVoice]);
+
+        pStream->Consume(nTake);
+        nDone += nTake;
+    }
+
+    return nDone;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CAudioMixer::Render(int16_t* pSamples, size_t nFrames) noexcept
+{
+    while (nFrames)
+    {
+        const size_t nBlock = std::min(nFrames, m_nBlockFrames);
+
+        const auto tmStart = std::chrono::steady_clock::now();
+        MixBlock(nBlock);
+        ConvertToInt16(m_rgAccum.data(), pSamples, nBlock * k_nMixerChannels);
+        const auto tmEnd = std::chrono::steady_clock::now();
+
+        const uint64_t nNanoseconds = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(tmEnd - tmStart).count());
+
+        m_nBlocks.fetch_add(1, std::memory_order_relaxed);
+        m_nMixNanoseconds.fetch_add(nNanoseconds, std::memory_order_relaxed);
+        if (m_pStats)
+            m_pStats->Record(m_iStatMixTime, static_cast<double>(nNanoseconds) * 1.0e-3);
+
+        pSamples += nBlock * k_nMixerChannels;
+        nFrames  -= nBlock;
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+bool CAudioMixer::StartOutput(IAudioSink* pSink) noexcept
+{
+    if (m_bRunning || pSink == nullptr)
+        return false;
+
+    if (!pSink->Open(m_nSampleRate, k_nMixerChannels))
+        return false;
+
+    m_pSink = pSink;
+
+    try
+    {
+        // prime the ring so the sink does not start on an underrun
+        std::vector<int16_t> rgBlock(m_nBlockFrames * k_nMixerChannels);
+        for (size_t i = 0; i < k_nMixerLeadBlocks; i++)
+        {
+            Render(rgBlock.data(), m_nBlockFrames);
+            WriteToRing(rgBlock.data());
+        }
+
+        m_bRunning = true;
+        m_thMixer  = std::thread(&CAudioMixer::MixerProc, this);    // note - may throw an exception
+        m_thOutput = std::thread(&CAudioMixer::OutputProc, this);   // note - may throw an exception
+    }
+    catch (...)
+    {
+        StopOutput();
+        return false;
+    }
+
+    return true;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CAudioMixer::StopOutput(void) noexcept
+{
+    m_bRunning = false;
+
+    if (m_thMixer.joinable())
+        m_thMixer.join();
+
+    if (m_thOutput.joinable())
+        m_thOutput.join();
+
+    if (m_pSink)
+    {
+        m_pSink->Close();
+        m_pSink = nullptr;
+    }
+
+    // starts still queued were never output
+    std::lock_guard<std::mutex> lock(m_mtxPending);
+    m_nPendingHead = m_nPendingTail;
+};
+
+//-----------------------------------------------------------------------------------------------
+bool CAudioMixer::RestartOutput(void) noexcept
+{
+    IAudioSink* pSink = m_pSink;
+    if (pSink == nullptr)
+        return false;
+
+    StopOutput();
+    return StartOutput(pSink);
+};
+
+//-----------------------------------------------------------------------------------------------
+void CAudioMixer::MixerProc(void) noexcept
+{
+    const size_t nBlockSamples = m_nBlockFrames * k_nMixerChannels;
+    const size_t nLeadSamples  = nBlockSamples * k_nMixerLeadBlocks;
+    const auto   tmPoll        = std::chrono::microseconds(m_nBlockFrames * 1000000 / m_nSampleRate / 4);
+
+    std::vector<int16_t> rgBlock;
+    try
+    {
+        rgBlock.resize(nBlockSamples);
+    }
+    catch (...)
+    {
+        return;
+    }
+
+    while (m_bRunning.load(std::memory_order_relaxed))
+    {
+        // stay a fixed lead ahead of the sink; mixing further only adds latency
+        if (m_Ring.get_ReadAvailable() < nLeadSamples && m_Ring.get_WriteAvailable() >= nBlockSamples)
+        {
+            Render(rgBlock.data(), m_nBlockFrames);
+            WriteToRing(rgBlock.data());
+        }
+        else
+        {
+            std::this_thread::sleep_for(tmPoll);
+        }
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+void CAudioMixer::OutputProc(void) noexcept
+{
+    const size_t nBlockSamples = m_nBlockFrames * k_nMixerChannels;
+    const bool   bRealtime     = m_pSink->IsRealtime();
+    const auto   tmBlock       = std::chrono::nanoseconds(static_cast<int64_t>(m_nBlockFrames) * 1000000000 / m_nSampleRate);
+
+    std::vector<int16_t> rgBlock;
+    try
+    {
+        rgBlock.resize(nBlockSamples);
+    }
+    catch (...)
+    {
+        return;
+    }
+
+    const auto tmPoll = tmBlock / 8;
+    auto tmNext = std::chrono::steady_clock::now();
+
+    while (m_bRunning.load(std::memory_order_relaxed))
+    {
+        // give a late mixer up to one block before padding with silence
+        const auto tmDeadline = std::chrono::steady_clock::now() + tmBlock;
+        while (m_Ring.get_ReadAvailable() < nBlockSamples && std::chrono::steady_clock::now() < tmDeadline &&
+               m_bRunning.load(std::memory_order_relaxed))
+            std::this_thread::sleep_for(tmPoll);
+
+        if (m_pStats)
+        {
+            const size_t nQueued = m_Ring.get_ReadAvailable() / k_nMixerChannels;
+            m_pStats->Record(m_iStatQueueDepth, static_cast<double>(nQueued) * 1000.0 / m_nSampleRate);
+        }
+
+        const size_t nRead = m_Ring.Read(rgBlock.data(), nBlockSamples);
+        if (nRead < nBlockSamples)
+        {
+            std::fill(rgBlock.begin() + nRead, rgBlock.end(), int16_t(0));
+            m_nUnderruns.fetch_add(1, std::memory_order_relaxed);
+            if (m_pStats)
+                m_pStats->Add(m_iStatUnderruns);
+        }
+        m_nFramesRead += nRead / k_nMixerChannels;
+
+        if (!m_pSink->Write(rgBlock.data(), m_nBlockFrames))
+        {
+            // a dead sink shows up as IsRunning() == false; RestartOutput() recovers
+            m_bRunning = false;
+            break;
+        }
+
+        m_nFramesOut.fetch_add(m_nBlockFrames, std::memory_order_relaxed);
+        if (m_pStats)
+            RetireStarts(m_nFramesRead);
+
+        // non realtime sinks return at once; hold them to playback rate
+        if (!bRealtime)
+        {
+            tmNext += tmBlock;
+            std::this_thread::sleep_until(tmNext);
+        }
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+ResamplerBenchmark BenchmarkResampler(size_t nVoices, size_t nBlocks) noexcept
+{
+    nVoices = std::min<size_t>(nVoices, k_nMaxMixerVoices);
+
+    ResamplerBenchmark result = { nVoices, nBlocks, 0.0, 0.0 };
+
+    try
+    {
+        // one second of a 440 Hz tone, already at the mixer rate so no voice is converted up front
+        PcmBuffer pcm;
+        pcm.nChannels   = 1;
+        pcm.nSampleRate = k_nMixerSampleRate;
+        pcm.rgSamples.resize(k_nMixerSampleRate);
+        for (size_t i = 0; i < pcm.rgSamples.size(); i++)
+            pcm.rgSamples[i] = 0.25f * std::sin(static_cast<float>(i) * (6.2831853f * 440.0f / k_nMixerSampleRate));
+
+        CAudioMixer mixer;
+        const int iSound = mixer.AddSound(pcm);
+
+        std::vector<MixerVoice> rgVoices;
+        for (size_t i = 0; i < nVoices; i++)
+            rgVoices.push_back(mixer.Play(iSound, 1.0f / static_cast<float>(nVoices), 0.0f, true));
+
+        std::vector<int16_t> rgBlock(k_nMixerBlockFrames * k_nMixerChannels);
+
+        for (int iRun = 0; iRun < 2; iRun++)
+        {
+            if (iRun == 1)
+            {
+                // spread the ratios over the engine's range, none of them unity
+                for (size_t i = 0; i < rgVoices.size(); i++)
+                    mixer.SetPitch(rgVoices[i], 0.5f + 1.5f * (static_cast<float>(i) + 0.5f) / static_cast<float>(rgVoices.size()));
+            }
+
+            const auto tmStart = std::chrono::steady_clock::now();
+            for (size_t n = 0; n < nBlocks; n++)
+                mixer.Render(rgBlock.data(), k_nMixerBlockFrames);
+            const double dElapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - tmStart).count();
+
+            const double dPerMs = (dElapsedMs > 0.0) ? static_cast<double>(nVoices * nBlocks) / dElapsedMs : 0.0;
+            if (iRun == 0)
+                result.dDirectPerMs = dPerMs;
+            else
+                result.dResampledPerMs = dPerMs;
+        }
+    }
+    catch (...)
+    {
+        // allocation failure; report what was measured
+    }
+
+    return result;
+};
+
+} // namespace audio
+} // namespace eng
@@ -0,0 +1,379 @@
+/**
+ *  @file       AudioMixer.h
+ *  @brief      CAudioMixer class interface
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ *  <b>Implementation:</b>
+ *
+ *   Portable software mixer, independent of XAudio2 / COM:
+ *
+ *    - sounds are decoded once (DecodeWave) and converted to the mixer
+ *      rate at AddSound(); voices reference them through shared_ptr so a
+ *      hot reload can swap a sound while a voice still plays the old one.
+ *    - long tracks play through PlayStream() instead: the voice pulls
+ *      chunks from a CWaveStream that decodes the mapped file ahead of it
+ *      on its own thread.
+ *    - voice state is kept as parallel arrays (gain L/R, position, source)
+ *      with an active bit mask; a block mixes only the set bits.
+ *    - volume, pan and world position only store values; at the start of
+ *      each block one SSE pass turns them into gains for every active
+ *      voice, four voices per step.  Voices started with PlayAt() take pan
+ *      and attenuation from their position in the ListenerField, the rest
+ *      use their explicit pan.  Pan is equal power.
+ *    - a voice given a pitch ratio other than 1 reads its source at a
+ *      fractional step with linear interpolation.  The interpolation is
+ *      SSE2, four output frames per step; only the gather of the two taps
+ *      is scalar.  Frames whose second tap would run past the end of the
+ *      sound are finished one at a time so a loop interpolates across its
+ *      seam.  Unpitched voices keep the straight copy path.  Mono and
+ *      stereo sources are accumulated four floats at a time with SSE into
+ *      an interleaved stereo float block, then clamped and packed to
+ *      16-bit.
+ *    - a mixer thread keeps a single producer / single consumer ring
+ *      (CSampleRing) topped up to a couple of blocks ahead; an output
+ *      thread drains it into an IAudioSink.  A ring that runs dry is
+ *      padded with silence and counted as an underrun.
+ *
+ *   Voices are addressed by a MixerVoice handle that carries a generation
+ *   count, so a stale handle to a reused slot is ignored.
+ *
+ *   With AttachStats() the mixer publishes to the engine statistics:
+ *   mixing time per block, ring depth seen by the sink, underruns and
+ *   trigger-to-output latency.  The latency is measured from Play() to
+ *   the return of the sink Write() carrying the voice's first block.  It
+ *   excludes any buffering inside the device itself.
+ */
+#pragma once
+
+#if !defined(__AUDIO_MIXER_H__)
+#define __AUDIO_MIXER_H__
+
+#ifndef _ATOMIC_
+    #include <atomic>
+#endif
+
+#ifndef _CHRONO_
+    #include <chrono>
+#endif
+
+#ifndef _MEMORY_
+    #include <memory>
+#endif
+
+#ifndef _MUTEX_
+    #include <mutex>
+#endif
+
+#ifndef _THREAD_
+    #include <thread>
+#endif
+
+#ifndef _VECTOR_
+    #include <vector>
+#endif
+
+#ifndef __WAVE_FILE_H__
+    #include "Engine/Audio/WaveFile.h"
+#endif
+
+#ifndef __SAMPLE_RING_H__
+    #include "Engine/Audio/SampleRing.h"
+#endif
+
+#ifndef __AUDIO_SINK_H__
+    #include "Engine/Audio/AudioSink.h"
+#endif
+
+#ifndef __WAVE_STREAM_H__
+    #include "Engine/Audio/WaveStream.h"
+#endif
+
+#ifndef __LISTENER_FIELD_H__
+    #include "Engine/Audio/ListenerField.h"
+#endif
+
+namespace eng
+{
+namespace util
+{
+class CStats;
+}
+
+namespace audio
+{
+
+typedef uint32_t MixerVoice;    ///< 0 is no voice
+
+constexpr int      k_nMaxMixerVoices   = 64;      ///< one bit each in the active mask
+constexpr int      k_nMixerChannels    = 2;
+constexpr uint32_t k_nMixerSampleRate  = 44100;
+constexpr size_t   k_nMixerBlockFrames = 512;     ///< ~11.6 ms at 44.1 kHz
+constexpr size_t   k_nMixerRingBlocks  = 8;       ///< ring capacity
+constexpr size_t   k_nMixerLeadBlocks  = 2;       ///< blocks kept mixed ahead of the sink
+constexpr size_t   k_nMixerLatencyQueue = 64;     ///< voice starts awaiting output, more are not measured
+constexpr float    k_fMixerMinPitch    = 0.25f;   ///< two octaves down
+constexpr float    k_fMixerMaxPitch    = 4.0f;    ///< two octaves up
+
+/**
+ * @brief mixer cost and health counters
+ */
+struct MixerStats
+{
+    uint64_t nBlocks;           ///< blocks mixed
+    uint64_t nVoiceBlocks;      ///< sum over blocks of the voices mixed in each
+    double   dMixSeconds;       ///< time spent mixing, excluding sink I/O
+    uint64_t nUnderruns;        ///< sink blocks padded with silence
+    uint64_t nFramesOut;        ///< frames handed to the sink
+    uint64_t nStreamStarves;    ///< stream voice blocks cut short waiting on a chunk
+    uint64_t nPitchedBlocks;    ///< voice blocks mixed through the resampler
+
+/**
+ *  @retval double   mixing cost of one voice for one block, in microseconds
+ */
+    double get_MicrosecondsPerVoiceBlock(void) const noexcept
+    { return nVoiceBlocks ? dMixSeconds * 1.0e6 / static_cast<double>(nVoiceBlocks) : 0.0; };
+};
+
+class CAudioMixer
+{
+    typedef std::shared_ptr<const PcmBuffer> PcmBufferPtr;
+    typedef std::shared_ptr<CWaveStream>     WaveStreamPtr;
+    typedef std::chrono::steady_clock::time_point TimePoint;
+
+    /// a voice start waiting for its first block to reach the sink
+    struct PendingStart
+    {
+        uint64_t  nFrame;       ///< ring frame its first block starts at
+        TimePoint tmStart;
+    };
+
+    std::vector<PcmBufferPtr>   m_rgSounds;
+
+    // voices, structure of arrays
+    PcmBufferPtr                m_rgVoiceSound   [k_nMaxMixerVoices];   ///< keeps the source alive
+    WaveStreamPtr               m_rgVoiceStreamRef[k_nMaxMixerVoices];
+    CWaveStream*                m_rgVoiceStream  [k_nMaxMixerVoices];   ///< non-null for stream voices
+    const float*                m_rgVoiceSamples [k_nMaxMixerVoices];
+    size_t                      m_rgVoiceFrames  [k_nMaxMixerVoices];
+    int                         m_rgVoiceChannels[k_nMaxMixerVoices];
+    int                         m_rgVoiceSoundId [k_nMaxMixerVoices];
+    size_t                      m_rgPosition     [k_nMaxMixerVoices];   ///< next frame to mix
+    float                       m_rgVolume       [k_nMaxMixerVoices];
+    float                       m_rgPan          [k_nMaxMixerVoices];
+    float                       m_rgSourceX      [k_nMaxMixerVoices];   ///< world position, PlayAt() voices
+    float                       m_rgSourceY      [k_nMaxMixerVoices];
+    float                       m_rgPitch        [k_nMaxMixerVoices];   ///< source frames per output frame
+    float                       m_rgFraction     [k_nMaxMixerVoices];   ///< read position past m_rgPosition
+    TimePoint                   m_rgStartTime    [k_nMaxMixerVoices];   ///< Play() time, for latency
+    float                       m_rgGainL        [k_nMaxMixerVoices];
+    float                       m_rgGainR        [k_nMaxMixerVoices];
+    uint32_t                    m_rgGeneration   [k_nMaxMixerVoices];
+    uint64_t                    m_nActiveMask;
+    uint64_t                    m_nLoopMask;
+    uint64_t                    m_nPositionalMask;  ///< voices panned and attenuated by position
+    uint64_t                    m_nPitchedMask;     ///< voices mixed through the resampler
+    uint64_t                    m_nUnheardMask;     ///< voices started but not yet mixed
+    ListenerField               m_Field;
+    float                       m_fMasterVolume;
+    mutable std::mutex          m_mtxVoices;
+
+    std::vector<float>          m_rgAccum;          ///< one interleaved stereo block
+    CSampleRing                 m_Ring;
+    IAudioSink*                 m_pSink;
+    std::thread                 m_thMixer;
+    std::thread                 m_thOutput;
+    std::atomic<bool>           m_bRunning;
+
+    uint32_t                    m_nSampleRate;
+    size_t                      m_nBlockFrames;
+
+    // latency tracking, the mixer side queues and the output side retires
+    PendingStart                m_rgPending[k_nMixerLatencyQueue];
+    size_t                      m_nPendingHead;
+    size_t                      m_nPendingTail;
+    std::mutex                  m_mtxPending;
+    uint64_t                    m_nFramesQueued;    ///< frames written to the ring, mixer side only
+    uint64_t                    m_nFramesRead;      ///< frames read from the ring, output side only
+
+    util::CStats*               m_pStats;
+    int                         m_iStatLatency;
+    int                         m_iStatMixTime;
+    int                         m_iStatQueueDepth;
+    int                         m_iStatUnderruns;
+    int                         m_iStatStarves;
+
+    std::atomic<uint64_t>       m_nBlocks;
+    std::atomic<uint64_t>       m_nVoiceBlocks;
+    std::atomic<uint64_t>       m_nMixNanoseconds;
+    std::atomic<uint64_t>       m_nUnderruns;
+    std::atomic<uint64_t>       m_nFramesOut;
+    std::atomic<uint64_t>       m_nStreamStarves;
+    std::atomic<uint64_t>       m_nPitchedBlocks;
+
+public:
+/**
+ *  @note - may throw an exception
+ */
+    explicit CAudioMixer(uint32_t nSampleRate = k_nMixerSampleRate, size_t nBlockFrames = k_nMixerBlockFrames);
+    /// Default destructor, stops output
+    ~CAudioMixer() noexcept;
+
+/**
+ *  @brief registers a decoded sound, converted to the mixer sample rate
+ *
+ *  @retval int   containing the sound id, ids are assigned in order from 0
+ *
+ *  @note - may throw an exception
+ */
+    int        AddSound       ( const PcmBuffer& pcm );
+/**
+ *  @brief swaps the samples of a sound, its playing voices are stopped
+ */
+    bool       ReplaceSound   ( int iSound, const PcmBuffer& pcm ) noexcept;
+
+/**
+ *  @param [in] fPan     -1 (left) .. +1 (right), equal power
+ *
+ *  @retval MixerVoice   handle of the started voice
+ *  @retval 0            if the id is bad or every voice is busy
+ */
+    MixerVoice Play           ( int iSound, float fVolume = 1.0f, float fPan = 0.0f, bool bLoop = false ) noexcept;
+/**
+ *  @brief plays a sound at a world position in the listener field
+ *
+ *  @retval MixerVoice   handle of the started voice
+ *  @retval 0            if the id is bad or every voice is busy
+ */
+    MixerVoice PlayAt         ( int iSound, float fX, float fY, float fVolume = 1.0f, bool bLoop = false ) noexcept;
+/**
+ *  @param [in] pStream  opened at get_SampleRate(); looping is set at Open()
+ *
+ *  @retval MixerVoice   handle of the started voice
+ *  @retval 0            if the stream is not open or every voice is busy
+ */
+    MixerVoice PlayStream     ( const std::shared_ptr<CWaveStream>& pStream, float fVolume = 1.0f, float fPan = 0.0f ) noexcept;
+    void       Stop           ( MixerVoice hVoice ) noexcept;
+    void       StopAll        ( void ) noexcept;
+    bool       IsPlaying      ( MixerVoice hVoice ) const noexcept;
+    void       SetVolume      ( MixerVoice hVoice, float fVolume ) noexcept;
+    void       SetPan         ( MixerVoice hVoice, float fPan ) noexcept;
+/**
+ *  @brief moves a voice; it is panned by position from the next block on
+ */
+    void       SetPosition    ( MixerVoice hVoice, float fX, float fY ) noexcept;
+/**
+ *  @param [in] fRatio   playback rate, 2 is an octave up; clamped to
+ *                       [k_fMixerMinPitch, k_fMixerMaxPitch], ignored for streams
+ */
+    void       SetPitch       ( MixerVoice hVoice, float fRatio ) noexcept;
+    void       SetMasterVolume( float fVolume ) noexcept;
+/**
+ *  @brief sets the playfield positions are relative to, ignored if empty
+ */
+    void       SetListenerField( const ListenerField& field ) noexcept;
+
+/**
+ *  @brief mixes nFrames interleaved 16-bit frames synchronously
+ *
+ *  Used by the mixer thread, and directly by headless callers and
+ *  benchmarks while output is not started.
+ */
+    void       Render         ( int16_t* pSamples, size_t nFrames ) noexcept;
+
+/**
+ *  @brief opens the sink and starts the mixer and output threads
+ *
+ *  @param [in] pSink    not owned, must outlive StopOutput()
+ */
+    bool       StartOutput    ( IAudioSink* pSink ) noexcept;
+    void       StopOutput     ( void ) noexcept;
+/**
+ *  @brief closes and reopens the current sink, after it failed a write
+ *
+ *  @retval false  if no sink was started or it cannot be reopened
+ */
+    bool       RestartOutput  ( void ) noexcept;
+
+/**
+ *  @brief registers the mixer's statistics, call before StartOutput()
+ *
+ *  @param [in] pStats   not owned, normally &eng::g_theStats
+ */
+    void       AttachStats    ( util::CStats* pStats ) noexcept;
+
+    bool       IsRunning      ( void ) const noexcept
+    { return m_bRunning.load(std::memory_order_relaxed); };
+
+    uint32_t   get_SampleRate ( void ) const noexcept
+    { return m_nSampleRate; };
+
+    int        get_SoundCount ( void ) const noexcept;
+    int        get_ActiveVoices( void ) const noexcept;
+    MixerStats get_Stats      ( void ) const noexcept;
+
+private:
+    int        FindVoice      ( MixerVoice hVoice ) const noexcept;
+    MixerVoice StartSound     ( int iSound, float fVolume, float fPan, bool bLoop ) noexcept;
+    MixerVoice StartVoice     ( int iVoice, int iSound, float fVolume, float fPan ) noexcept;
+    size_t     MixStream      ( int iVoice, float* pAccum, size_t nFrames ) noexcept;
+    bool       MixPitched     ( int iVoice, float* pAccum, size_t nFrames ) noexcept;
+    void       UpdateGains    ( void ) noexcept;
+    void       MixBlock       ( size_t nFrames ) noexcept;
+    void       QueueStarts    ( uint64_t nStartMask ) noexcept;
+    void       RetireStarts   ( uint64_t nFramesRead ) noexcept;
+    void       WriteToRing    ( const int16_t* pSamples ) noexcept;
+
+    void       MixerProc      ( void ) noexcept;
+    void       OutputProc     ( void ) noexcept;
+
+    /// Copy constructor
+    CAudioMixer(const CAudioMixer&) = delete;
+    /// Assignment operator
+    CAudioMixer& operator=(const CAudioMixer&) = delete;
+};
+
+/**
+ *  @brief accumulates nFrames mono frames into an interleaved stereo block
+ */
+void MixMonoToStereo   ( float* pAccum, const float* pSrc, size_t nFrames, float fGainL, float fGainR ) noexcept;
+/**
+ *  @brief accumulates nFrames stereo frames into an interleaved stereo block
+ */
+void MixStereoToStereo ( float* pAccum, const float* pSrc, size_t nFrames, float fGainL, float fGainR ) noexcept;
+/**
+ *  @brief accumulates nFrames linearly interpolated mono frames into an
+ *         interleaved stereo block
+ *
+ *  Output frame i reads source position fStart + i * fStep.  Both taps of
+ *  every frame, floor(position) and floor(position) + 1, must lie in pSrc.
+ */
+void MixMonoResampled  ( float* pAccum, const float* pSrc, float fStart, float fStep, size_t nFrames, float fGainL, float fGainR ) noexcept;
+/**
+ *  @brief stereo form of MixMonoResampled(), positions count frames
+ */
+void MixStereoResampled( float* pAccum, const float* pSrc, float fStart, float fStep, size_t nFrames, float fGainL, float fGainR ) noexcept;
+/**
+ *  @brief clamps to [-1, 1] and converts to 16-bit with saturation
+ */
+void ConvertToInt16    ( const float* pSrc, int16_t* pDst, size_t nSamples ) noexcept;
+
+struct ResamplerBenchmark
+{
+    size_t nVoices;             ///< looping voices mixed in each run
+    size_t nBlocks;             ///< blocks rendered in each run
+    double dDirectPerMs;        ///< voice blocks per millisecond at unity pitch
+    double dResampledPerMs;     ///< voice blocks per millisecond through the resampler
+};
+
+/**
+ *  @brief renders nBlocks blocks of nVoices looping voices on a private
+ *         mixer, first unpitched then each voice at a different pitch
+ */
+ResamplerBenchmark BenchmarkResampler(size_t nVoices, size_t nBlocks) noexcept;
+
+} // namespace audio
+} // namespace eng
+
+#endif
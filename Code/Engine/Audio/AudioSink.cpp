@@ -0,0 +1,154 @@
+/**
+ *  @file       AudioSink.cpp
+ *  @brief      WAV file sink implementation and the sink factory
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ */
+
+#define _CRT_SECURE_NO_WARNINGS
+#include "targetver.h"  // this needs to be the 1st header included
+
+#include <cstring>
+#include <new>
+
+#include "AudioSink.h"
+#include "DeviceAudioSink.h"
+
+namespace eng
+{
+namespace audio
+{
+
+//-----------------------------------------------------------------------------------------------
+static void WriteU16(unsigned char* p, uint16_t n) noexcept
+{
+    p[0] = static_cast<unsigned char>(n);
+    p[1] = static_cast<unsigned char>(n >> 8);
+};
+
+//-----------------------------------------------------------------------------------------------
+static void WriteU32(unsigned char* p, uint32_t n) noexcept
+{
+    WriteU16(p,     static_cast<uint16_t>(n));
+    WriteU16(p + 2, static_cast<uint16_t>(n >> 16));
+};
+
+constexpr size_t k_nWaveHeaderBytes = 44;
+
+//-----------------------------------------------------------------------------------------------
+CWaveFileAudioSink::CWaveFileAudioSink(const char* szFilePath)
+    : m_strFilePath(szFilePath ? szFilePath : ""),
+      m_pFile(nullptr),
+      m_nChannels(0),
+      m_nDataBytes(0)
+{
+};
+
+//-----------------------------------------------------------------------------------------------
+CWaveFileAudioSink::~CWaveFileAudioSink() noexcept
+{
+    Close();
+};
+
+//-----------------------------------------------------------------------------------------------
+bool CWaveFileAudioSink::Open(uint32_t nSampleRate, int nChannels) noexcept
+{
+    Close();
+
+    m_pFile = fopen(m_strFilePath.c_str(), "wb");
+    if (m_pFile == nullptr)
+        return false;
+
+    m_nChannels  = nChannels;
+    m_nDataBytes = 0;
+
+    // RIFF and data sizes are left 0 until Close()
+    const uint16_t nBlockAlign = static_cast<uint16_t>(nChannels * sizeof(int16_t));
+
+    unsigned char rgHeader[k_nWaveHeaderBytes] = { 0 };
+    memcpy(rgHeader,      "RIFF", 4);
+    memcpy(rgHeader + 8,  "WAVEfmt ", 8);
+    WriteU32(rgHeader + 16, 16);
+    WriteU16(rgHeader + 20, 1);     // PCM
+    WriteU16(rgHeader + 22, static_cast<uint16_t>(nChannels));
+    WriteU32(rgHeader + 24, nSampleRate);
+    WriteU32(rgHeader + 28, nSampleRate * nBlockAlign);
+    WriteU16(rgHeader + 32, nBlockAlign);
+    WriteU16(rgHeader + 34, 16);
+    memcpy(rgHeader + 36, "data", 4);
+
+    if (fwrite(rgHeader, sizeof(rgHeader), 1, m_pFile) != 1)
+    {
+        Close();
+        return false;
+    }
+    return true;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CWaveFileAudioSink::Close(void) noexcept
+{
+    if (m_pFile)
+    {
+        // a RIFF chunk cannot describe more than 4 GB; clamp rather than wrap
+        const uint32_t nDataBytes = (m_nDataBytes > 0xFFFFFFFFull - 36) ? 0xFFFFFFFFu - 36
+                                                                        : static_cast<uint32_t>(m_nDataBytes);
+        unsigned char rgSize[4];
+
+        WriteU32(rgSize, nDataBytes + 36);
+        fseek(m_pFile, 4, SEEK_SET);
+        fwrite(rgSize, sizeof(rgSize), 1, m_pFile);
+
+        WriteU32(rgSize, nDataBytes);
+        fseek(m_pFile, 40, SEEK_SET);
+        fwrite(rgSize, sizeof(rgSize), 1, m_pFile);
+
+        fclose(m_pFile);
+        m_pFile = nullptr;
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+bool CWaveFileAudioSink::Write(const int16_t* pSamples, size_t nFrames) noexcept
+{
+    if (m_pFile == nullptr)
+        return false;
+
+    // little-endian targets only, samples go out as is
+    const size_t nSamples = nFrames * m_nChannels;
+    if (fwrite(pSamples, sizeof(int16_t), nSamples, m_pFile) != nSamples)
+        return false;
+
+    m_nDataBytes += nSamples * sizeof(int16_t);
+    return true;
+};
+
+//-----------------------------------------------------------------------------------------------
+IAudioSink* CreateAudioSink(const char* szSpec) noexcept
+{
+    IAudioSink* pSink = nullptr;
+
+    if (szSpec == nullptr || szSpec[0] == '\0')
+        return nullptr;
+
+    try
+    {
+        if (strcmp(szSpec, "null") == 0)
+            pSink = new CNullAudioSink();
+        else if (strcmp(szSpec, "device") == 0)
+            pSink = new CDeviceAudioSink();
+        else
+            pSink = new CWaveFileAudioSink(szSpec);
+    }
+    catch (...)
+    {
+        pSink = nullptr;
+    }
+
+    return pSink;
+};
+
+} // namespace audio
+} // namespace eng
@@ -0,0 +1,136 @@
+/**
+ *  @file       AudioSink.h
+ *  @brief      IAudioSink interface, null and WAV file sinks
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ *  <b>Implementation:</b>
+ *
+ *   A sink is where CAudioMixer output ends up.  The mixer's output thread
+ *   is the only caller, one block of interleaved 16-bit frames at a time:
+ *
+ *    - CNullAudioSink: discards (counts) frames; headless runs and mixer
+ *      benchmarks.
+ *    - CWaveFileAudioSink: writes a 16-bit PCM .wav file, sizes patched on
+ *      Close().
+ *    - CDeviceAudioSink: the default output device, see DeviceAudioSink.h.
+ *
+ *   A realtime sink blocks in Write() at playback rate; for the others the
+ *   output thread paces itself to the wall clock so a recorded session is
+ *   as long as the run.
+ */
+#pragma once
+
+#if !defined(__AUDIO_SINK_H__)
+#define __AUDIO_SINK_H__
+
+#ifndef _CSTDINT_
+    #include <cstdint>
+#endif
+
+#ifndef _CSTDIO_
+    #include <cstdio>
+#endif
+
+#ifndef _STRING_
+    #include <string>
+#endif
+
+namespace eng
+{
+namespace audio
+{
+
+class __declspec(novtable) IAudioSink
+{
+public:
+    virtual ~IAudioSink() = default;
+
+/**
+ *  @retval false    if the sink cannot accept this format
+ */
+    virtual bool        Open        ( uint32_t nSampleRate, int nChannels ) noexcept = 0;
+    virtual void        Close       ( void ) noexcept = 0;
+/**
+ *  @param [in] pSamples    nFrames interleaved frames
+ *
+ *  @retval false    on a device or I/O error
+ */
+    virtual bool        Write       ( const int16_t* pSamples, size_t nFrames ) noexcept = 0;
+/**
+ *  @retval true     if Write() blocks at playback rate
+ */
+    virtual bool        IsRealtime  ( void ) const noexcept = 0;
+    virtual const char* get_Name    ( void ) const noexcept = 0;
+};
+
+//-----------------------------------------------------------------------------------------------
+class CNullAudioSink : public IAudioSink
+{
+    uint64_t m_nFramesWritten;
+
+public:
+    constexpr CNullAudioSink() noexcept
+        : m_nFramesWritten(0)
+    { };
+
+    bool        Open        ( uint32_t, int ) noexcept override
+    { m_nFramesWritten = 0; return true; };
+    void        Close       ( void ) noexcept override
+    { };
+    bool        Write       ( const int16_t*, size_t nFrames ) noexcept override
+    { m_nFramesWritten += nFrames; return true; };
+    bool        IsRealtime  ( void ) const noexcept override
+    { return false; };
+    const char* get_Name    ( void ) const noexcept override
+    { return "null"; };
+
+    uint64_t    get_FramesWritten ( void ) const noexcept
+    { return m_nFramesWritten; };
+};
+
+//-----------------------------------------------------------------------------------------------
+class CWaveFileAudioSink : public IAudioSink
+{
+    std::string m_strFilePath;
+    FILE*       m_pFile;
+    int         m_nChannels;
+    uint64_t    m_nDataBytes;
+
+public:
+/**
+ *  @note - may throw an exception
+ */
+    explicit CWaveFileAudioSink(const char* szFilePath);
+    ~CWaveFileAudioSink() noexcept;
+
+    bool        Open        ( uint32_t nSampleRate, int nChannels ) noexcept override;
+    void        Close       ( void ) noexcept override;
+    bool        Write       ( const int16_t* pSamples, size_t nFrames ) noexcept override;
+    bool        IsRealtime  ( void ) const noexcept override
+    { return false; };
+    const char* get_Name    ( void ) const noexcept override
+    { return "wav"; };
+
+private:
+    /// Copy constructor
+    CWaveFileAudioSink(const CWaveFileAudioSink&) = delete;
+    /// Assignment operator
+    CWaveFileAudioSink& operator=(const CWaveFileAudioSink&) = delete;
+};
+
+/**
+ *  @brief creates a sink from a command line spec
+ *
+ *  @param [in] szSpec   "null", "device", or a path to a .wav file
+ *
+ *  @retval IAudioSink*  owned by the caller
+ *  @retval nullptr      on error
+ */
+IAudioSink* CreateAudioSink(const char* szSpec) noexcept;
+
+} // namespace audio
+} // namespace eng
+
+#endif
@@ -0,0 +1,209 @@
+/**
+ *  @file       DeviceAudioSink.cpp
+ *  @brief      CDeviceAudioSink class implementation
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ */
+
+#define WIN32_LEAN_AND_MEAN
+#include "targetver.h"  // this needs to be the 1st header included
+
+#include <cstring>
+#include <vector>
+
+#ifdef _WIN32
+    #include <Windows.h>
+    #include <mmsystem.h>
+
+    #pragma comment( lib, "winmm" ) // waveOut
+#endif
+
+#include "DeviceAudioSink.h"
+
+namespace eng
+{
+namespace audio
+{
+
+#ifdef _WIN32
+
+struct DeviceBuffers
+{
+    WAVEHDR              rgHeaders[k_nDeviceBuffers];
+    std::vector<int16_t> rgSamples[k_nDeviceBuffers];
+};
+
+#else
+
+struct DeviceBuffers
+{
+};
+
+#endif
+
+//-----------------------------------------------------------------------------------------------
+CDeviceAudioSink::CDeviceAudioSink() noexcept
+    : m_pBuffers(),
+      m_hWaveOut(nullptr),
+      m_hEvent(nullptr),
+      m_nChannels(0),
+      m_iNext(0),
+      m_nFilled(0)
+{
+};
+
+//-----------------------------------------------------------------------------------------------
+CDeviceAudioSink::~CDeviceAudioSink() noexcept
+{
+    Close();
+};
+
+#ifdef _WIN32
+
+//-----------------------------------------------------------------------------------------------
+bool CDeviceAudioSink::Open(uint32_t nSampleRate, int nChannels) noexcept
+{
+    Close();
+
+    try
+    {
+        m_pBuffers.reset(new DeviceBuffers()); // note - may throw an exception
+        for (auto& rgSamples : m_pBuffers->rgSamples)
+            rgSamples.resize(k_nDeviceBufferFrames * nChannels);
+    }
+    catch (...)
+    {
+        m_pBuffers.reset();
+        return false;
+    }
+
+    m_hEvent = ::CreateEvent(nullptr, FALSE, FALSE, nullptr);
+    if (m_hEvent == nullptr)
+    {
+        m_pBuffers.reset();
+        return false;
+    }
+
+    WAVEFORMATEX wfx = { 0 };
+    wfx.wFormatTag      = WAVE_FORMAT_PCM;
+    wfx.nChannels       = static_cast<WORD>(nChannels);
+    wfx.nSamplesPerSec  = nSampleRate;
+    wfx.wBitsPerSample  = 16;
+    wfx.nBlockAlign     = static_cast<WORD>(nChannels * sizeof(int16_t));
+    wfx.nAvgBytesPerSec = nSampleRate * wfx.nBlockAlign;
+
+    HWAVEOUT hWaveOut = nullptr;
+    if (::waveOutOpen(&hWaveOut, WAVE_MAPPER, &wfx, reinterpret_cast<DWORD_PTR>(m_hEvent), 0, CALLBACK_EVENT) != MMSYSERR_NOERROR)
+    {
+        ::CloseHandle(m_hEvent);
+        m_hEvent = nullptr;
+        m_pBuffers.reset();
+        return false;
+    }
+
+    m_hWaveOut  = hWaveOut;
+    m_nChannels = nChannels;
+    m_iNext     = 0;
+    m_nFilled   = 0;
+
+    for (int i = 0; i < k_nDeviceBuffers; i++)
+    {
+        WAVEHDR& hdr = m_pBuffers->rgHeaders[i];
+        memset(&hdr, 0, sizeof(hdr));
+        hdr.lpData         = reinterpret_cast<LPSTR>(m_pBuffers->rgSamples[i].data());
+        hdr.dwBufferLength = static_cast<DWORD>(m_pBuffers->rgSamples[i].size() * sizeof(int16_t));
+        ::waveOutPrepareHeader(hWaveOut, &hdr, sizeof(hdr));
+        hdr.dwFlags |= WHDR_DONE;   // every buffer starts out free
+    }
+
+    return true;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CDeviceAudioSink::Close(void) noexcept
+{
+    if (m_hWaveOut)
+    {
+        HWAVEOUT hWaveOut = static_cast<HWAVEOUT>(m_hWaveOut);
+
+        ::waveOutReset(hWaveOut);
+        for (auto& hdr : m_pBuffers->rgHeaders)
+            ::waveOutUnprepareHeader(hWaveOut, &hdr, sizeof(hdr));
+
+        ::waveOutClose(hWaveOut);
+        m_hWaveOut = nullptr;
+    }
+
+    if (m_hEvent)
+    {
+        ::CloseHandle(m_hEvent);
+        m_hEvent = nullptr;
+    }
+
+    m_pBuffers.reset();
+};
+
+//-----------------------------------------------------------------------------------------------
+bool CDeviceAudioSink::Write(const int16_t* pSamples, size_t nFrames) noexcept
+{
+    if (m_hWaveOut == nullptr)
+        return false;
+
+    HWAVEOUT hWaveOut = static_cast<HWAVEOUT>(m_hWaveOut);
+
+    while (nFrames)
+    {
+        WAVEHDR& hdr = m_pBuffers->rgHeaders[m_iNext];
+
+        // the device still owns this buffer; wait for it to come back
+        while ((hdr.dwFlags & WHDR_DONE) == 0)
+            ::WaitForSingleObject(m_hEvent, INFINITE);
+
+        const size_t nCopy = (nFrames < k_nDeviceBufferFrames - m_nFilled) ? nFrames
+                                                                           : k_nDeviceBufferFrames - m_nFilled;
+        memcpy(m_pBuffers->rgSamples[m_iNext].data() + m_nFilled * m_nChannels,
+               pSamples, nCopy * m_nChannels * sizeof(int16_t));
+
+        pSamples += nCopy * m_nChannels;
+        nFrames  -= nCopy;
+        m_nFilled += nCopy;
+
+        if (m_nFilled == k_nDeviceBufferFrames)
+        {
+            hdr.dwFlags &= ~WHDR_DONE;
+            if (::waveOutWrite(hWaveOut, &hdr, sizeof(hdr)) != MMSYSERR_NOERROR)
+                return false;
+
+            m_iNext   = (m_iNext + 1) % k_nDeviceBuffers;
+            m_nFilled = 0;
+        }
+    }
+
+    return true;
+};
+
+#else
+
+//-----------------------------------------------------------------------------------------------
+bool CDeviceAudioSink::Open(uint32_t, int) noexcept
+{
+    return false;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CDeviceAudioSink::Close(void) noexcept
+{
+};
+
+//-----------------------------------------------------------------------------------------------
+bool CDeviceAudioSink::Write(const int16_t*, size_t) noexcept
+{
+    return false;
+};
+
+#endif
+
+} // namespace audio
+} // namespace eng
@@ -0,0 +1,76 @@
+/**
+ *  @file       DeviceAudioSink.h
+ *  @brief      CDeviceAudioSink class interface
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ *  <b>Implementation:</b>
+ *
+ *   Plays mixer output on the default device through the waveOut API: a
+ *   small ring of device buffers, Write() blocks on the buffer-done event
+ *   until the oldest one is free again, which paces the mixer's output
+ *   thread at playback rate.  Other platforms have no device backend in
+ *   this tree; Open() fails there and callers fall back to a null sink.
+ *
+ * <b>Cite:</b>
+ *
+ * @sa https://docs.microsoft.com/en-us/windows/win32/multimedia/waveform-audio-interface
+ */
+#pragma once
+
+#if !defined(__DEVICE_AUDIO_SINK_H__)
+#define __DEVICE_AUDIO_SINK_H__
+
+#ifndef _MEMORY_
+    #include <memory>
+#endif
+
+#ifndef __AUDIO_SINK_H__
+    #include "Engine/Audio/AudioSink.h"
+#endif
+
+namespace eng
+{
+namespace audio
+{
+
+constexpr int    k_nDeviceBuffers      = 4;
+constexpr size_t k_nDeviceBufferFrames = 1024;
+
+struct DeviceBuffers;
+
+class CDeviceAudioSink : public IAudioSink
+{
+    std::unique_ptr<DeviceBuffers> m_pBuffers;
+    void*                          m_hWaveOut;     ///< HWAVEOUT
+    void*                          m_hEvent;       ///< HANDLE, signaled as buffers complete
+    int                            m_nChannels;
+    int                            m_iNext;        ///< next device buffer to fill
+    size_t                         m_nFilled;      ///< frames already in m_iNext
+
+public:
+    /// Default constructor
+    CDeviceAudioSink() noexcept;
+    /// Default destructor
+    ~CDeviceAudioSink() noexcept;
+
+    bool        Open        ( uint32_t nSampleRate, int nChannels ) noexcept override;
+    void        Close       ( void ) noexcept override;
+    bool        Write       ( const int16_t* pSamples, size_t nFrames ) noexcept override;
+    bool        IsRealtime  ( void ) const noexcept override
+    { return true; };
+    const char* get_Name    ( void ) const noexcept override
+    { return "device"; };
+
+private:
+    /// Copy constructor
+    CDeviceAudioSink(const CDeviceAudioSink&) = delete;
+    /// Assignment operator
+    CDeviceAudioSink& operator=(const CDeviceAudioSink&) = delete;
+};
+
+} // namespace audio
+} // namespace eng
+
+#endif
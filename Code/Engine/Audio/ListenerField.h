@@ -0,0 +1,77 @@
+/**
+ *  @file       ListenerField.h
+ *  @brief      ListenerField structure and positional gain helper
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ *  <b>Implementation:</b>
+ *
+ *   A 2D game has no listener orientation to speak of; the listener is
+ *   the whole visible playfield.  A source position is normalized against
+ *   the field's half extents, so the left and right edges pan fully and
+ *   the centre is heard unpanned.  Attenuation is an inverse square
+ *   rolloff of the normalized distance from the centre,
+ *   1 / (1 + fRolloff * d^2), which needs no square root and never
+ *   silences a source that is still on screen.
+ *
+ *   CAudioMixer applies the same law to all of its voices in one SSE pass
+ *   per block; CalcFieldGain() is the scalar form for single sources.
+ */
+#pragma once
+
+#if !defined(__LISTENER_FIELD_H__)
+#define __LISTENER_FIELD_H__
+
+namespace eng
+{
+namespace audio
+{
+
+constexpr float k_fFieldRolloff = 0.5f;     ///< edge midpoints play at 2/3, corners at 1/2
+
+/**
+ * @brief the playfield sources are positioned in, in world units
+ */
+struct ListenerField
+{
+    float fLeft;
+    float fBottom;
+    float fRight;
+    float fTop;
+    float fRolloff;         ///< attenuation at d = 1 (a field edge) is 1 / (1 + fRolloff)
+
+    constexpr bool  IsValid     ( void ) const noexcept
+    { return fRight > fLeft && fTop > fBottom && fRolloff >= 0.0f; };
+
+    constexpr float get_CenterX ( void ) const noexcept
+    { return (fLeft + fRight) * 0.5f; };
+
+    constexpr float get_CenterY ( void ) const noexcept
+    { return (fBottom + fTop) * 0.5f; };
+};
+
+/**
+ *  @brief default field, a unit square around the origin
+ */
+constexpr ListenerField k_DefaultListenerField = { -1.0f, -1.0f, 1.0f, 1.0f, k_fFieldRolloff };
+
+/**
+ *  @brief pan and attenuation of a source at (fX, fY)
+ *
+ *  @param [out] fPan            -1 (left) .. +1 (right)
+ *  @param [out] fAttenuation    0 .. 1
+ */
+inline void CalcFieldGain(const ListenerField& field, float fX, float fY, float& fPan, float& fAttenuation) noexcept
+{
+    const float fDX = (fX - field.get_CenterX()) * 2.0f / (field.fRight - field.fLeft);
+    const float fDY = (fY - field.get_CenterY()) * 2.0f / (field.fTop - field.fBottom);
+
+    fPan         = (fDX < -1.0f) ? -1.0f : ((fDX > 1.0f) ? 1.0f : fDX);
+    fAttenuation = 1.0f / (1.0f + field.fRolloff * (fDX * fDX + fDY * fDY));
+};
+
+} // namespace audio
+} // namespace eng
+
+#endif
@@ -0,0 +1,81 @@
+/**
+ *  @file       SampleRing.cpp
+ *  @brief      CSampleRing class implementation
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ */
+
+#include "targetver.h"  // this needs to be the 1st header included
+
+#include <cstring>
+
+#include "SampleRing.h"
+
+namespace eng
+{
+namespace audio
+{
+
+//-----------------------------------------------------------------------------------------------
+static size_t RoundUpPow2(size_t n) noexcept
+{
+    size_t nPow2 = 1;
+    while (nPow2 < n)
+        nPow2 <<= 1;
+    return nPow2;
+};
+
+//-----------------------------------------------------------------------------------------------
+CSampleRing::CSampleRing(size_t nCapacity)
+    : m_pSamples(),
+      m_nCapacity(RoundUpPow2(nCapacity)),
+      m_nMask(m_nCapacity - 1),
+      m_nWrite(0),
+      m_nRead(0)
+{
+    m_pSamples.reset(new int16_t[m_nCapacity]()); // note - may throw an exception
+};
+
+//-----------------------------------------------------------------------------------------------
+size_t CSampleRing::Write(const int16_t* pSamples, size_t nSamples) noexcept
+{
+    const size_t nWrite = m_nWrite.load(std::memory_order_relaxed);
+    const size_t nFree  = m_nCapacity - (nWrite - m_nRead.load(std::memory_order_acquire));
+
+    if (nSamples > nFree)
+        nSamples = nFree;
+
+    // at most two spans: up to the end of the buffer, then from the start
+    const size_t nSlot  = nWrite & m_nMask;
+    const size_t nFirst = (nSamples < m_nCapacity - nSlot) ? nSamples : m_nCapacity - nSlot;
+
+    memcpy(m_pSamples.get() + nSlot, pSamples, nFirst * sizeof(int16_t));
+    memcpy(m_pSamples.get(), pSamples + nFirst, (nSamples - nFirst) * sizeof(int16_t));
+
+    m_nWrite.store(nWrite + nSamples, std::memory_order_release);
+    return nSamples;
+};
+
+//-----------------------------------------------------------------------------------------------
+size_t CSampleRing::Read(int16_t* pSamples, size_t nSamples) noexcept
+{
+    const size_t nRead  = m_nRead.load(std::memory_order_relaxed);
+    const size_t nAvail = m_nWrite.load(std::memory_order_acquire) - nRead;
+
+    if (nSamples > nAvail)
+        nSamples = nAvail;
+
+    const size_t nSlot  = nRead & m_nMask;
+    const size_t nFirst = (nSamples < m_nCapacity - nSlot) ? nSamples : m_nCapacity - nSlot;
+
+    memcpy(pSamples, m_pSamples.get() + nSlot, nFirst * sizeof(int16_t));
+    memcpy(pSamples + nFirst, m_pSamples.get(), (nSamples - nFirst) * sizeof(int16_t));
+
+    m_nRead.store(nRead + nSamples, std::memory_order_release);
+    return nSamples;
+};
+
+} // namespace audio
+} // namespace eng
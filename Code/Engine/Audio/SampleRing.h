@@ -0,0 +1,94 @@
+/**
+ *  @file       SampleRing.h
+ *  @brief      CSampleRing class interface
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ *  <b>Implementation:</b>
+ *
+ *   Lock-free single producer / single consumer ring of 16-bit samples
+ *   between the mixer thread and the sink thread.  Capacity is a power of
+ *   two so the free running read / write counters map to slots with a
+ *   mask; each counter is written by one side only and published with
+ *   release / acquire ordering.
+ */
+#pragma once
+
+#if !defined(__SAMPLE_RING_H__)
+#define __SAMPLE_RING_H__
+
+#ifndef _ATOMIC_
+    #include <atomic>
+#endif
+
+#ifndef _CSTDINT_
+    #include <cstdint>
+#endif
+
+#ifndef _MEMORY_
+    #include <memory>
+#endif
+
+namespace eng
+{
+namespace audio
+{
+
+class CSampleRing
+{
+    std::unique_ptr<int16_t[]> m_pSamples;
+    size_t                     m_nCapacity;             ///< power of two
+    size_t                     m_nMask;
+
+    alignas(64) std::atomic<size_t> m_nWrite;           ///< producer owned
+    alignas(64) std::atomic<size_t> m_nRead;            ///< consumer owned
+
+public:
+/**
+ *  @param [in] nCapacity   in samples, rounded up to a power of two
+ *
+ *  @note - may throw an exception
+ */
+    explicit CSampleRing(size_t nCapacity);
+
+    size_t get_Capacity(void) const noexcept
+    { return m_nCapacity; };
+
+/**
+ *  @retval size_t   samples the consumer may read
+ */
+    size_t get_ReadAvailable(void) const noexcept
+    { return m_nWrite.load(std::memory_order_acquire) - m_nRead.load(std::memory_order_relaxed); };
+
+/**
+ *  @retval size_t   samples the producer may write
+ */
+    size_t get_WriteAvailable(void) const noexcept
+    { return m_nCapacity - (m_nWrite.load(std::memory_order_relaxed) - m_nRead.load(std::memory_order_acquire)); };
+
+/**
+ *  @brief producer side
+ *
+ *  @retval size_t   samples copied in, at most get_WriteAvailable()
+ */
+    size_t Write(const int16_t* pSamples, size_t nSamples) noexcept;
+
+/**
+ *  @brief consumer side
+ *
+ *  @retval size_t   samples copied out, at most get_ReadAvailable()
+ */
+    size_t Read(int16_t* pSamples, size_t nSamples) noexcept;
+
+private:
+    /// Copy constructor
+    CSampleRing(const CSampleRing& o) = delete;
+    /// Assignment operator
+    CSampleRing& operator=(const CSampleRing& rhs) = delete;
+};
+
+} // namespace audio
+} // namespace eng
+
+#endif
@@ -0,0 +1,243 @@
+/**
+ *  @file       WaveFile.cpp
+ *  @brief      in-memory RIFF WAVE parsing implementation
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ */
+
+#include "targetver.h"  // this needs to be the 1st header included
+
+#include <cstddef>
+#include <cstring>
+
+#include "WaveFile.h"
+
+namespace eng
+{
+namespace audio
+{
+
+//-----------------------------------------------------------------------------------------------
+constexpr uint32_t MakeFourCC(char a, char b, char c, char d) noexcept
+{
+    return  static_cast<uint32_t>(static_cast<unsigned char>(a))        |
+           (static_cast<uint32_t>(static_cast<unsigned char>(b)) << 8)  |
+           (static_cast<uint32_t>(static_cast<unsigned char>(c)) << 16) |
+           (static_cast<uint32_t>(static_cast<unsigned char>(d)) << 24);
+};
+
+constexpr uint32_t k_nFourCC_RIFF = MakeFourCC('R', 'I', 'F', 'F');
+constexpr uint32_t k_nFourCC_WAVE = MakeFourCC('W', 'A', 'V', 'E');
+constexpr uint32_t k_nFourCC_fmt  = MakeFourCC('f', 'm', 't', ' ');
+constexpr uint32_t k_nFourCC_data = MakeFourCC('d', 'a', 't', 'a');
+
+constexpr uint16_t k_nWaveFormatPcm        = 0x0001;
+constexpr uint16_t k_nWaveFormatFloat      = 0x0003;
+constexpr uint16_t k_nWaveFormatExtensible = 0xFFFE;
+
+// WAVEFORMATEXTENSIBLE: cbSize, wValidBitsPerSample, dwChannelMask, then the
+// SubFormat GUID whose first two bytes carry the format tag
+constexpr uint32_t k_nExtensibleTagOffset  = sizeof(WaveFormat) + 8;
+
+//-----------------------------------------------------------------------------------------------
+inline uint32_t ReadU32(const unsigned char* p) noexcept
+{
+    uint32_t n;
+    memcpy(&n, p, sizeof(n));
+    return n;
+};
+
+//-----------------------------------------------------------------------------------------------
+bool ParseWave(const void* pData, size_t nBytes, WaveView& view) noexcept
+{
+    view = { nullptr, 0, nullptr, 0 };
+
+    const unsigned char* p = static_cast<const unsigned char*>(pData);
+    if (p == nullptr || nBytes < 12 ||
+        ReadU32(p) != k_nFourCC_RIFF || ReadU32(p + 8) != k_nFourCC_WAVE)
+        return false;
+
+    // trust the smaller of the RIFF size and the buffer size
+    const size_t nRiffEnd = static_cast<size_t>(ReadU32(p + 4)) + 8;
+    const size_t nEnd     = nRiffEnd < nBytes ? nRiffEnd : nBytes;
+
+    size_t nPos = 12;
+    while (nPos + 8 <= nEnd && (view.pFormat == nullptr || view.pSamples == nullptr))
+    {
+        const uint32_t nChunkId   = ReadU32(p + nPos);
+        const uint32_t nChunkSize = ReadU32(p + nPos + 4);
+        const size_t   nPayload   = nPos + 8;
+
+        if (nChunkSize > nEnd - nPayload)
+            return false;
+
+        if (nChunkId == k_nFourCC_fmt && nChunkSize >= sizeof(WaveFormat))
+        {
+            view.pFormat      = reinterpret_cast<const WaveFormat*>(p + nPayload);
+            view.nFormatBytes = nChunkSize;
+        }
+        else if (nChunkId == k_nFourCC_data)
+        {
+            view.pSamples     = p + nPayload;
+            view.nSampleBytes = nChunkSize;
+        }
+
+        // chunks are word aligned
+        nPos = nPayload + nChunkSize + (nChunkSize & 1);
+    }
+
+    return view.pFormat != nullptr && view.pSamples != nullptr;
+};
+
+//-----------------------------------------------------------------------------------------------
+bool GetPcmFormat(const WaveView& wave, PcmFormat& fmt) noexcept
+{
+    if (wave.pFormat == nullptr)
+        return false;
+
+    WaveFormat wf;
+    memcpy(&wf, wave.pFormat, sizeof(wf));
+
+    uint16_t nTag = wf.nFormatTag;
+    if (nTag == k_nWaveFormatExtensible)
+    {
+        if (wave.nFormatBytes < k_nExtensibleTagOffset + 2)
+            return false;
+
+        memcpy(&nTag, reinterpret_cast<const unsigned char*>(wave.pFormat) + k_nExtensibleTagOffset, sizeof(nTag));
+    }
+
+    fmt.nSampleRate     = wf.nSamplesPerSec;
+    fmt.nChannels       = wf.nChannels;
+    fmt.nBytesPerSample = wf.nBitsPerSample / 8;
+    fmt.bFloat          = (nTag == k_nWaveFormatFloat);
+
+    if (fmt.nChannels < 1 || fmt.nChannels > 2 || fmt.nSampleRate == 0)
+        return false;
+
+    if (fmt.bFloat)
+        return fmt.nBytesPerSample == 4;
+
+    return nTag == k_nWaveFormatPcm && fmt.nBytesPerSample >= 1 && fmt.nBytesPerSample <= 4 &&
+           wf.nBitsPerSample % 8 == 0;
+};
+
+//-----------------------------------------------------------------------------------------------
+size_t DecodeFrames(const WaveView& wave, const PcmFormat& fmt,
+                    size_t nFirstFrame, size_t nFrames, float* pOut) noexcept
+{
+    const size_t nFrameBytes = fmt.get_FrameBytes();
+    const size_t nTotal      = nFrameBytes ? wave.nSampleBytes / nFrameBytes : 0;
+
+    if (nFirstFrame >= nTotal || pOut == nullptr)
+        return 0;
+
+    if (nFrames > nTotal - nFirstFrame)
+        nFrames = nTotal - nFirstFrame;
+
+    const unsigned char* p  = wave.pSamples + nFirstFrame * nFrameBytes;
+    const size_t nSamples   = nFrames * fmt.nChannels;
+
+    switch (fmt.bFloat ? 0 : fmt.nBytesPerSample)
+    {
+    case 0:
+        memcpy(pOut, p, nSamples * sizeof(float));
+        break;
+
+    case 1:     // unsigned, 128 is silence
+        for (size_t i = 0; i < nSamples; i++)
+            pOut[i] = (static_cast<int>(p[i]) - 128) * (1.0f / 128.0f);
+        break;
+
+    case 2:
+        for (size_t i = 0; i < nSamples; i++)
+        {
+            int16_t n;
+            memcpy(&n, p + i * 2, sizeof(n));
+            pOut[i] = n * (1.0f / 32768.0f);
+        }
+        break;
+
+    case 3:
+        for (size_t i = 0; i < nSamples; i++)
+        {
+            const unsigned char* q = p + i * 3;
+            const int32_t n = static_cast<int32_t>((static_cast<uint32_t>(q[0]) << 8)  |
+                                                   (static_cast<uint32_t>(q[1]) << 16) |
+                                                   (static_cast<uint32_t>(q[2]) << 24));
+            pOut[i] = (n >> 8) * (1.0f / 8388608.0f);
+        }
+        break;
+
+    case 4:
+        for (size_t i = 0; i < nSamples; i++)
+        {
+            int32_t n;
+            memcpy(&n, p + i * 4, sizeof(n));
+            pOut[i] = static_cast<float>(n * (1.0 / 2147483648.0));
+        }
+        break;
+    }
+
+    return nFrames;
+};
+
+//-----------------------------------------------------------------------------------------------
+bool DecodeWave(const WaveView& wave, PcmBuffer& pcm)
+{
+    PcmFormat fmt;
+    if (!GetPcmFormat(wave, fmt))
+        return false;
+
+    const size_t nFrames = wave.nSampleBytes / fmt.get_FrameBytes();
+
+    pcm.rgSamples.resize(nFrames * fmt.nChannels); // note - may throw an exception
+    pcm.nSampleRate = fmt.nSampleRate;
+    pcm.nChannels   = fmt.nChannels;
+
+    DecodeFrames(wave, fmt, 0, nFrames, pcm.rgSamples.data());
+    return true;
+};
+
+//-----------------------------------------------------------------------------------------------
+void ConvertSampleRate(const PcmBuffer& src, uint32_t nSampleRate, PcmBuffer& dst)
+{
+    const size_t nSrcFrames = src.get_FrameCount();
+    const int    nChannels  = src.nChannels;
+
+    if (src.nSampleRate == nSampleRate || nSrcFrames == 0)
+    {
+        dst = src; // note - may throw an exception
+        dst.nSampleRate = nSampleRate;
+        return;
+    }
+
+    const double dStep     = static_cast<double>(src.nSampleRate) / nSampleRate;
+    const size_t nDstFrames = static_cast<size_t>(nSrcFrames / dStep);
+
+    std::vector<float> rgSamples(nDstFrames * nChannels); // note - may throw an exception
+
+    for (size_t i = 0; i < nDstFrames; i++)
+    {
+        const double dPos  = i * dStep;
+        const size_t n0    = static_cast<size_t>(dPos);
+        const size_t n1    = (n0 + 1 < nSrcFrames) ? n0 + 1 : n0;
+        const float  fFrac = static_cast<float>(dPos - n0);
+
+        for (int c = 0; c < nChannels; c++)
+        {
+            const float f0 = src.rgSamples[n0 * nChannels + c];
+            const float f1 = src.rgSamples[n1 * nChannels + c];
+            rgSamples[i * nChannels + c] = f0 + (f1 - f0) * fFrac;
+        }
+    }
+
+    dst.rgSamples.swap(rgSamples);
+    dst.nSampleRate = nSampleRate;
+    dst.nChannels   = nChannels;
+};
+
+} // namespace audio
+} // namespace eng
@@ -0,0 +1,135 @@
+/**
+ *  @file       WaveFile.h
+ *  @brief      in-memory RIFF WAVE parsing
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ *  <b>Implementation:</b>
+ *
+ *   ParseWave walks the RIFF chunks of a complete .wav image already in
+ *   memory (e.g. an asset pack view) and returns pointers to the 'fmt ' and
+ *   'data' payloads.  Nothing is copied.
+ *
+ *   DecodeWave / DecodeFrames convert 8, 16, 24 and 32-bit integer PCM and
+ *   32-bit IEEE float (plain or WAVE_FORMAT_EXTENSIBLE), mono or stereo,
+ *   into interleaved float samples in [-1, 1] for the software mixer.
+ *
+ * <b>Cite:</b>
+ *
+ * @sa http://soundfile.sapp.org/doc/WaveFormat/
+ */
+#pragma once
+
+#if !defined(__WAVE_FILE_H__)
+#define __WAVE_FILE_H__
+
+#ifndef _CSTDDEF_
+    #include <cstddef>
+#endif
+
+#ifndef _CSTDINT_
+    #include <cstdint>
+#endif
+
+#ifndef _VECTOR_
+    #include <vector>
+#endif
+
+namespace eng
+{
+namespace audio
+{
+
+/**
+ * @brief leading fields of the 'fmt ' chunk, PCMWAVEFORMAT layout
+ */
+struct WaveFormat
+{
+    uint16_t nFormatTag;
+    uint16_t nChannels;
+    uint32_t nSamplesPerSec;
+    uint32_t nAvgBytesPerSec;
+    uint16_t nBlockAlign;
+    uint16_t nBitsPerSample;
+};
+
+static_assert(sizeof(WaveFormat) == 16, "WaveFormat must match the 'fmt ' chunk layout");
+
+struct WaveView
+{
+    const WaveFormat*    pFormat;        ///< start of the 'fmt ' payload
+    uint32_t             nFormatBytes;   ///< size of the 'fmt ' payload, >= sizeof(WaveFormat)
+    const unsigned char* pSamples;       ///< start of the 'data' payload
+    uint32_t             nSampleBytes;
+};
+
+/**
+ * @brief sample layout of a WAVE image the decoder accepts
+ */
+struct PcmFormat
+{
+    uint32_t nSampleRate;
+    int      nChannels;         ///< 1 or 2
+    int      nBytesPerSample;   ///< 1, 2, 3 or 4
+    bool     bFloat;            ///< 32-bit IEEE float rather than integer PCM
+
+    size_t get_FrameBytes(void) const noexcept
+    { return static_cast<size_t>(nChannels) * nBytesPerSample; };
+};
+
+/**
+ * @brief decoded samples of a sound
+ */
+struct PcmBuffer
+{
+    std::vector<float> rgSamples;   ///< interleaved, nChannels per frame
+    uint32_t           nSampleRate;
+    int                nChannels;   ///< 1 or 2
+
+    size_t get_FrameCount(void) const noexcept
+    { return nChannels ? rgSamples.size() / nChannels : 0; };
+};
+
+/**
+ *  @retval true    if pData holds a RIFF WAVE image with 'fmt ' and 'data' chunks
+ *  @retval false   if the image is truncated or not a WAVE file
+ */
+bool ParseWave(const void* pData, size_t nBytes, WaveView& view) noexcept;
+
+/**
+ *  @retval true    if the 'fmt ' chunk describes a layout DecodeFrames handles
+ *  @retval false   for compressed formats or more than two channels
+ */
+bool GetPcmFormat(const WaveView& wave, PcmFormat& fmt) noexcept;
+
+/**
+ *  @brief converts up to nFrames frames starting at nFirstFrame
+ *
+ *  @param [out] pOut    nFrames * fmt.nChannels floats
+ *
+ *  @retval size_t   frames written, less than nFrames at the end of the data
+ */
+size_t DecodeFrames(const WaveView& wave, const PcmFormat& fmt,
+                    size_t nFirstFrame, size_t nFrames, float* pOut) noexcept;
+
+/**
+ *  @brief decodes the whole 'data' chunk
+ *
+ *  @retval false   if the format is not supported
+ *
+ *  @note - may throw an exception
+ */
+bool DecodeWave(const WaveView& wave, PcmBuffer& pcm);
+
+/**
+ *  @brief linear interpolation to another sample rate, used once at load
+ *
+ *  @note - may throw an exception
+ */
+void ConvertSampleRate(const PcmBuffer& src, uint32_t nSampleRate, PcmBuffer& dst);
+
+} // namespace audio
+} // namespace eng
+
+#endif
@@ -0,0 +1,317 @@
+/**
+ *  @file       WaveStream.cpp
+ *  @brief      CWaveStream class implementation
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ */
+
+#include "targetver.h"  // this needs to be the 1st header included
+
+#include <chrono>
+#include <cstring>
+
+#include "WaveStream.h"
+
+namespace eng
+{
+namespace audio
+{
+
+//-----------------------------------------------------------------------------------------------
+CWaveStream::CWaveStream() noexcept
+    : m_File(),
+      m_Wave{ nullptr, 0, nullptr, 0 },
+      m_Format{ 0, 0, 0, false },
+      m_nSourceFrames(0),
+      m_nSampleRate(0),
+      m_bLoop(false),
+      m_iFront(0),
+      m_nReadPos(0),
+      m_bFinished(true),
+      m_iBack(0),
+      m_dSourcePos(0.0),
+      m_bProducedLast(false),
+      m_rgWindow(),
+      m_nWindowFirst(0),
+      m_nWindowFrames(0),
+      m_thProducer(),
+      m_mtxProducer(),
+      m_cvProducer(),
+      m_bShutdown(false),
+      m_nStarved(0),
+      m_nChunks(0)
+{
+    for (auto& chunk : m_rgChunks)
+    {
+        chunk.nFrames = 0;
+        chunk.bLast   = false;
+        chunk.bReady  = false;
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+CWaveStream::~CWaveStream() noexcept
+{
+    Close();
+};
+
+//-----------------------------------------------------------------------------------------------
+bool CWaveStream::Open(const char* szFilePath, uint32_t nSampleRate, bool bLoop) noexcept
+{
+    Close();
+
+    if (!m_File.Open(szFilePath) ||
+        !ParseWave(m_File.get_Data(), m_File.get_Size(), m_Wave) ||
+        !GetPcmFormat(m_Wave, m_Format) || nSampleRate == 0)
+    {
+        Close();
+        return false;
+    }
+
+    m_nSourceFrames = m_Wave.nSampleBytes / m_Format.get_FrameBytes();
+    if (m_nSourceFrames == 0)
+    {
+        Close();
+        return false;
+    }
+
+    try
+    {
+        for (auto& chunk : m_rgChunks)
+            chunk.rgSamples.resize(k_nStreamChunkFrames * m_Format.nChannels); // note - may throw an exception
+
+        if (nSampleRate != m_Format.nSampleRate)
+            m_rgWindow.resize(k_nStreamWindowFrames * m_Format.nChannels);    // note - may throw an exception
+    }
+    catch (...)
+    {
+        Close();
+        return false;
+    }
+
+    m_nSampleRate   = nSampleRate;
+    m_bLoop         = bLoop;
+    m_iFront        = 0;
+    m_nReadPos      = 0;
+    m_iBack         = 0;
+    m_dSourcePos    = 0.0;
+    m_bProducedLast = false;
+    m_nWindowFirst  = 0;
+    m_nWindowFrames = 0;
+    m_bShutdown     = false;
+    m_bFinished     = false;
+
+    // both chunks are ready before the first block is mixed
+    for (int i = 0; i < 2 && !m_bProducedLast; i++)
+    {
+        FillChunk(m_rgChunks[m_iBack]);
+        m_iBack ^= 1;
+    }
+
+    if (!m_bProducedLast)
+    {
+        try
+        {
+            m_thProducer = std::thread(&CWaveStream::ProducerProc, this); // note - may throw an exception
+        }
+        catch (...)
+        {
+            Close();
+            return false;
+        }
+    }
+
+    return true;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CWaveStream::Close(void) noexcept
+{
+    if (m_thProducer.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mtxProducer);
+            m_bShutdown = true;
+        }
+        m_cvProducer.notify_one();
+        m_thProducer.join();
+    }
+
+    for (auto& chunk : m_rgChunks)
+    {
+        chunk.bReady  = false;
+        chunk.nFrames = 0;
+    }
+
+    m_bFinished = true;
+    m_File.Close();
+};
+
+//-----------------------------------------------------------------------------------------------
+const float* CWaveStream::get_Span(size_t& nFrames) noexcept
+{
+    nFrames = 0;
+
+    while (!m_bFinished.load(std::memory_order_relaxed))
+    {
+        Chunk& chunk = m_rgChunks[m_iFront];
+        if (!chunk.bReady.load(std::memory_order_acquire))
+            break;
+
+        if (m_nReadPos < chunk.nFrames)
+        {
+            nFrames = chunk.nFrames - m_nReadPos;
+            return chunk.rgSamples.data() + m_nReadPos * m_Format.nChannels;
+        }
+
+        // an empty closing chunk; retire it and look again
+        Consume(0);
+    }
+
+    return nullptr;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CWaveStream::Consume(size_t nFrames) noexcept
+{
+    Chunk& chunk = m_rgChunks[m_iFront];
+
+    m_nReadPos += nFrames;
+    if (m_nReadPos < chunk.nFrames)
+        return;
+
+    // hand the chunk back to the producer
+    const bool bLast = chunk.bLast;
+
+    m_nReadPos = 0;
+    m_iFront  ^= 1;
+    chunk.bReady.store(false, std::memory_order_release);
+
+    if (bLast)
+        m_bFinished.store(true, std::memory_order_release);
+    else
+        m_cvProducer.notify_one();
+};
+
+//-----------------------------------------------------------------------------------------------
+void CWaveStream::FillChunk(Chunk& chunk) noexcept
+{
+    float* pOut = chunk.rgSamples.data();
+
+    chunk.nFrames = (m_nSampleRate == m_Format.nSampleRate) ? CopyFrames(pOut, k_nStreamChunkFrames)
+                                                            : ResampleFrames(pOut, k_nStreamChunkFrames);
+    chunk.bLast   = m_bProducedLast;
+
+    m_nChunks.fetch_add(1, std::memory_order_relaxed);
+    chunk.bReady.store(true, std::memory_order_release);
+};
+
+//-----------------------------------------------------------------------------------------------
+size_t CWaveStream::CopyFrames(float* pOut, size_t nFrames) noexcept
+{
+    size_t nPos  = static_cast<size_t>(m_dSourcePos);
+    size_t nDone = 0;
+
+    while (nDone < nFrames)
+    {
+        const size_t n = DecodeFrames(m_Wave, m_Format, nPos, nFrames - nDone, pOut + nDone * m_Format.nChannels);
+        nDone += n;
+        nPos  += n;
+
+        if (nPos >= m_nSourceFrames)
+        {
+            if (!m_bLoop)
+            {
+                m_bProducedLast = true;
+                break;
+            }
+            nPos = 0;
+        }
+    }
+
+    m_dSourcePos = static_cast<double>(nPos);
+    return nDone;
+};
+
+//-----------------------------------------------------------------------------------------------
+const float* CWaveStream::GetSourceFrame(size_t nFrame) noexcept
+{
+    if (nFrame < m_nWindowFirst || nFrame >= m_nWindowFirst + m_nWindowFrames)
+    {
+        // start one frame early so the interpolation pair straddling the
+        // window edge does not force a second refill
+        m_nWindowFirst  = nFrame ? nFrame - 1 : 0;
+        m_nWindowFrames = DecodeFrames(m_Wave, m_Format, m_nWindowFirst, k_nStreamWindowFrames, m_rgWindow.data());
+    }
+
+    return m_rgWindow.data() + (nFrame - m_nWindowFirst) * m_Format.nChannels;
+};
+
+//-----------------------------------------------------------------------------------------------
+size_t CWaveStream::ResampleFrames(float* pOut, size_t nFrames) noexcept
+{
+    const double dStep     = static_cast<double>(m_Format.nSampleRate) / m_nSampleRate;
+    const double dEnd      = static_cast<double>(m_nSourceFrames);
+    const int    nChannels = m_Format.nChannels;
+
+    size_t i = 0;
+    for (; i < nFrames; i++)
+    {
+        if (m_dSourcePos >= dEnd)
+        {
+            if (!m_bLoop)
+                break;
+            m_dSourcePos -= dEnd;
+        }
+
+        const size_t n0 = static_cast<size_t>(m_dSourcePos);
+        size_t       n1 = n0 + 1;
+        if (n1 >= m_nSourceFrames)
+            n1 = m_bLoop ? 0 : n0;
+
+        const float fFrac = static_cast<float>(m_dSourcePos - n0);
+
+        // copy the first frame out; fetching the second may refill the window
+        float rgFrame0[2];
+        memcpy(rgFrame0, GetSourceFrame(n0), nChannels * sizeof(float));
+        const float* pFrame1 = GetSourceFrame(n1);
+
+        for (int c = 0; c < nChannels; c++)
+            pOut[i * nChannels + c] = rgFrame0[c] + (pFrame1[c] - rgFrame0[c]) * fFrac;
+
+        m_dSourcePos += dStep;
+    }
+
+    if (!m_bLoop && m_dSourcePos >= dEnd)
+        m_bProducedLast = true;
+
+    return i;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CWaveStream::ProducerProc(void) noexcept
+{
+    const auto tmPoll = std::chrono::milliseconds(10);
+
+    while (!m_bProducedLast)
+    {
+        Chunk& chunk = m_rgChunks[m_iBack];
+        {
+            // a missed notify costs at most one poll interval, far less than a chunk
+            std::unique_lock<std::mutex> lock(m_mtxProducer);
+            while (!m_bShutdown && chunk.bReady.load(std::memory_order_acquire))
+                m_cvProducer.wait_for(lock, tmPoll);
+
+            if (m_bShutdown)
+                break;
+        }
+
+        FillChunk(chunk);
+        m_iBack ^= 1;
+    }
+};
+
+} // namespace audio
+} // namespace eng
@@ -0,0 +1,164 @@
+/**
+ *  @file       WaveStream.h
+ *  @brief      CWaveStream class interface
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ *  <b>Implementation:</b>
+ *
+ *   Plays a long .wav (music, ambience) without decoding it up front.  The
+ *   file is memory mapped; a background thread decodes it a fixed size
+ *   chunk at a time, converted to the mixer sample rate, into one of two
+ *   chunk buffers while the mixer consumes the other.  Private memory is
+ *   the two chunks and a small decode window regardless of track length;
+ *   the mapped pages are file backed and the OS may drop them at will.
+ *
+ *   Hand-off is lock free: a chunk's bReady flag is set (release) by the
+ *   producer once it is filled and cleared (release) by the mixer once it
+ *   is consumed, so each side only ever touches the chunk it owns.  If the
+ *   mixer reaches a chunk that is not ready yet the voice plays silence for
+ *   that block and the stream counts a starve.
+ */
+#pragma once
+
+#if !defined(__WAVE_STREAM_H__)
+#define __WAVE_STREAM_H__
+
+#ifndef _ATOMIC_
+    #include <atomic>
+#endif
+
+#ifndef _CONDITION_VARIABLE_
+    #include <condition_variable>
+#endif
+
+#ifndef _MUTEX_
+    #include <mutex>
+#endif
+
+#ifndef _THREAD_
+    #include <thread>
+#endif
+
+#ifndef _VECTOR_
+    #include <vector>
+#endif
+
+#ifndef __MAPPED_FILE_H__
+    #include "Engine/Utility/MappedFile.h"
+#endif
+
+#ifndef __WAVE_FILE_H__
+    #include "Engine/Audio/WaveFile.h"
+#endif
+
+namespace eng
+{
+namespace audio
+{
+
+constexpr size_t k_nStreamChunkFrames  = 8192;    ///< ~186 ms at 44.1 kHz
+constexpr size_t k_nStreamWindowFrames = 4096;    ///< source frames decoded per refill when resampling
+
+class CWaveStream
+{
+    struct Chunk
+    {
+        std::vector<float>  rgSamples;
+        size_t              nFrames;
+        bool                bLast;          ///< final chunk of a non looping stream
+        std::atomic<bool>   bReady;         ///< owned by the mixer while set
+    };
+
+    util::CMappedFile       m_File;
+    WaveView                m_Wave;
+    PcmFormat               m_Format;
+    size_t                  m_nSourceFrames;
+    uint32_t                m_nSampleRate;          ///< output rate
+    bool                    m_bLoop;
+
+    Chunk                   m_rgChunks[2];
+
+    // consumer (mixer) state
+    int                     m_iFront;
+    size_t                  m_nReadPos;
+    std::atomic<bool>       m_bFinished;
+
+    // producer state
+    int                     m_iBack;
+    double                  m_dSourcePos;           ///< next source frame, fractional when resampling
+    bool                    m_bProducedLast;
+    std::vector<float>      m_rgWindow;             ///< decoded source frames [m_nWindowFirst, + m_nWindowFrames)
+    size_t                  m_nWindowFirst;
+    size_t                  m_nWindowFrames;
+
+    std::thread             m_thProducer;
+    std::mutex              m_mtxProducer;
+    std::condition_variable m_cvProducer;
+    bool                    m_bShutdown;
+
+    std::atomic<uint32_t>   m_nStarved;
+    std::atomic<uint32_t>   m_nChunks;
+
+public:
+    /// Default constructor
+    CWaveStream() noexcept;
+    /// Default destructor, stops the producer thread
+    ~CWaveStream() noexcept;
+
+/**
+ *  @brief maps the file, decodes the first two chunks and starts the producer
+ *
+ *  @param [in] nSampleRate   rate the mixer consumes at
+ *
+ *  @retval false    if the file cannot be mapped or its format is not supported
+ */
+    bool            Open         ( const char* szFilePath, uint32_t nSampleRate, bool bLoop ) noexcept;
+    void            Close        ( void ) noexcept;
+
+    int             get_Channels ( void ) const noexcept
+    { return m_Format.nChannels; };
+
+/**
+ *  @brief mixer side, frames ready to mix at the current read position
+ *
+ *  @param [out] nFrames   frames available from the returned pointer, 0 when starved
+ */
+    const float*    get_Span     ( size_t& nFrames ) noexcept;
+/**
+ *  @brief mixer side, advances past nFrames of the last span
+ */
+    void            Consume      ( size_t nFrames ) noexcept;
+/**
+ *  @brief mixer side, counts a block the producer did not keep up with
+ */
+    void            OnStarved    ( void ) noexcept
+    { m_nStarved.fetch_add(1, std::memory_order_relaxed); };
+
+    bool            IsFinished   ( void ) const noexcept
+    { return m_bFinished.load(std::memory_order_acquire); };
+
+    uint32_t        get_Starved  ( void ) const noexcept
+    { return m_nStarved.load(std::memory_order_relaxed); };
+
+    uint32_t        get_Chunks   ( void ) const noexcept
+    { return m_nChunks.load(std::memory_order_relaxed); };
+
+private:
+    void            FillChunk    ( Chunk& chunk ) noexcept;
+    size_t          CopyFrames   ( float* pOut, size_t nFrames ) noexcept;
+    size_t          ResampleFrames( float* pOut, size_t nFrames ) noexcept;
+    const float*    GetSourceFrame( size_t nFrame ) noexcept;
+    void            ProducerProc ( void ) noexcept;
+
+    /// Copy constructor
+    CWaveStream(const CWaveStream&) = delete;
+    /// Assignment operator
+    CWaveStream& operator=(const CWaveStream&) = delete;
+};
+
+} // namespace audio
+} // namespace eng
+
+#endif
@@ -0,0 +1,237 @@
+/**
+ *  @file       AssetReloader.cpp
+ *  @brief      CAssetReloader class implementation
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ */
+
+#include "targetver.h"  // needs to be 1st header included
+
+#include <climits>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+#include "stb_image.h"
+
+#include "Engine/Audio/WaveFile.h"
+#include "Engine/Utility/Hash.h"
+
+#include "AssetReloader.h"
+
+namespace eng
+{
+
+/// how often the worker asks the watcher for settled changes
+constexpr std::chrono::milliseconds k_tmReloadPollInterval(50);
+
+//-----------------------------------------------------------------------------------------------
+CAssetReloader::CAssetReloader() noexcept
+    : m_Watcher(),
+      m_strRoot(),
+      m_rgExcluded(),
+      m_thWorker(),
+      m_mtxWorker(),
+      m_cvWorker(),
+      m_bShutdown(false),
+      m_mtxReady(),
+      m_rgReady(),
+      m_nDecoded(0),
+      m_nFailed(0)
+{
+};
+
+//-----------------------------------------------------------------------------------------------
+CAssetReloader::~CAssetReloader()
+{
+    Stop();
+};
+
+//-----------------------------------------------------------------------------------------------
+bool CAssetReloader::Start(const char* szRootDirectory)
+{
+    if (m_thWorker.joinable())
+        return true;
+
+    if (!m_Watcher.Start(szRootDirectory)) // note - may throw an exception
+        return false;
+
+    m_strRoot   = szRootDirectory; // note - may throw an exception
+    m_bShutdown = false;
+
+    try
+    {
+        m_thWorker = std::thread(&CAssetReloader::WorkerProc, this); // note - may throw an exception
+    }
+    catch (...)
+    {
+        m_Watcher.Stop();
+        throw;
+    }
+    return true;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CAssetReloader::Stop(void) noexcept
+{
+    if (m_thWorker.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mtxWorker);
+            m_bShutdown = true;
+        }
+        m_cvWorker.notify_one();
+        m_thWorker.join();
+    }
+
+    m_Watcher.Stop();
+};
+
+//-----------------------------------------------------------------------------------------------
+void CAssetReloader::Exclude(const char* szDirectory)
+{
+    if (szDirectory == nullptr || szDirectory[0] == '\0' || m_thWorker.joinable())
+        return;
+
+    std::string strPrefix(szDirectory); // note - may throw an exception
+    if (strPrefix.back() != '/')
+        strPrefix += '/';
+
+    m_rgExcluded.push_back(std::move(strPrefix)); // note - may throw an exception
+};
+
+//-----------------------------------------------------------------------------------------------
+bool CAssetReloader::IsExcluded(const std::string& strName) const noexcept
+{
+    for (const std::string& strPrefix : m_rgExcluded)
+    {
+        if (strName.compare(0, strPrefix.size(), strPrefix) == 0)
+            return true;
+    }
+    return false;
+};
+
+//-----------------------------------------------------------------------------------------------
+size_t CAssetReloader::TakeReady(std::vector<ReloadedAssetPtr>& rgAssets) noexcept
+{
+    size_t nTaken = 0;
+
+    std::unique_lock<std::mutex> lock(m_mtxReady, std::try_to_lock);
+    if (lock.owns_lock() && !m_rgReady.empty())
+    {
+        try
+        {
+            for (ReloadedAssetPtr& pAsset : m_rgReady)
+            {
+                rgAssets.push_back(std::move(pAsset));
+                nTaken++;
+            }
+        }
+        catch (...)
+        {
+            // whatever did not fit is dropped; the next save reloads it
+        }
+        m_rgReady.clear();
+    }
+
+    return nTaken;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CAssetReloader::WorkerProc(void) noexcept
+{
+    std::vector<std::string> rgChanged;
+
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mtxWorker);
+            if (m_cvWorker.wait_for(lock, k_tmReloadPollInterval, [this] { return m_bShutdown; }))
+                break;
+        }
+
+        try
+        {
+            rgChanged.clear();
+            m_Watcher.PollChanges(rgChanged);
+
+            for (const std::string& strName : rgChanged)
+            {
+                ReloadedAssetPtr pAsset = Decode(strName);
+                if (pAsset)
+                {
+                    std::lock_guard<std::mutex> lock(m_mtxReady);
+                    m_rgReady.push_back(std::move(pAsset));
+                    m_nDecoded.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        }
+        catch (...)
+        {
+            m_nFailed.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+ReloadedAssetPtr CAssetReloader::Decode(const std::string& strName)
+{
+    if (IsExcluded(strName))
+        return nullptr;     // written by the game, not an edited asset
+
+    const ASSET_FORMAT eFormat = CAssetPackBuilder::FormatFromExtension(strName.c_str());
+    if (eFormat == AF_RAW)
+        return nullptr;     // not a reloadable asset type
+
+    std::ifstream file(std::filesystem::path(m_strRoot) / strName, std::ios::binary);
+    if (!file)
+    {
+        m_nFailed.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    ReloadedAssetPtr pAsset(new ReloadedAsset{ strName, util::HashPath(strName.c_str()), eFormat, {}, {} }); // note - may throw an exception
+    pAsset->rgBytes.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+
+    bool bValid = false;
+
+    if (eFormat == AF_IMAGE && pAsset->rgBytes.size() <= static_cast<size_t>(INT_MAX))
+    {
+        int iWidth = 0, iHeight = 0, iComponents = 0;
+        unsigned char* pTexels = stbi_load_from_memory(pAsset->rgBytes.data(), static_cast<int>(pAsset->rgBytes.size()),
+                                                       &iWidth, &iHeight, &iComponents, STBI_default);
+        if (pTexels)
+        {
+            try
+            {
+                pAsset->rgBytes.assign(pTexels, pTexels + static_cast<size_t>(iWidth) * iHeight * iComponents);
+                bValid = pAsset->chain.Build(pAsset->rgBytes.data(), iWidth, iHeight, iComponents);
+            }
+            catch (...)
+            {
+                stbi_image_free(pTexels);
+                throw;
+            }
+            stbi_image_free(pTexels);
+        }
+    }
+    else if (eFormat == AF_WAVE)
+    {
+        audio::WaveView wave;
+        bValid = audio::ParseWave(pAsset->rgBytes.data(), pAsset->rgBytes.size(), wave);
+    }
+
+    if (!bValid)
+    {
+        // most often a save still in progress; the next write event retries
+        m_nFailed.fetch_add(1, std::memory_order_relaxed);
+        pAsset.reset();
+    }
+
+    return pAsset;
+};
+
+} // namespace eng
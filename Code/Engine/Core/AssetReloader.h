@@ -0,0 +1,143 @@
+/**
+ *  @file       AssetReloader.h
+ *  @brief      CAssetReloader class interface
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ *  <b>Implementation:</b>
+ *
+ *   Hot reload for a running build.  A CFileWatcher reports settled file
+ *   changes below the deploy directory; a worker thread reads each changed
+ *   file and does all of the expensive work off the frame loop (image
+ *   decode + mip chain, WAVE validation).  Finished payloads wait in a ready
+ *   list until the frame loop collects them with TakeReady() at a frame
+ *   boundary and swaps them into the existing CTexture / SoundEffect slots,
+ *   so handles and sound indices held by the game stay valid.
+ *
+ *   TakeReady() only try-locks the ready list: if the worker is publishing
+ *   at that instant, the swap is simply picked up next frame.
+ */
+#pragma once
+
+#if !defined(__ASSET_RELOADER_H__)
+#define __ASSET_RELOADER_H__
+
+#ifndef _ATOMIC_
+    #include <atomic>
+#endif
+
+#ifndef _CONDITION_VARIABLE_
+    #include <condition_variable>
+#endif
+
+#ifndef _MEMORY_
+    #include <memory>
+#endif
+
+#ifndef _THREAD_
+    #include <thread>
+#endif
+
+#ifndef __ASSET_PACK_H__
+    #include "Engine/Utility/AssetPack.h"
+#endif
+
+#ifndef __FILE_WATCHER_H__
+    #include "Engine/Utility/FileWatcher.h"
+#endif
+
+#ifndef __MIP_CHAIN_H__
+    #include "Engine/Renderer/MipChain.h"
+#endif
+
+namespace eng
+{
+
+/**
+ * @brief a changed asset, decoded and ready to swap in
+ */
+struct ReloadedAsset
+{
+    std::string                strName;     ///< relative to the watched root, '/' separated
+    uint64_t                   nNameHash;   ///< util::HashPath(strName)
+    ASSET_FORMAT               eFormat;
+    std::vector<unsigned char> rgBytes;     ///< AF_IMAGE: level 0 texels, otherwise the file contents
+    rdr::CMipChain             chain;       ///< AF_IMAGE only, built over rgBytes
+
+/**
+ *  @retval AssetView   over the raw file contents (AF_WAVE, AF_RAW)
+ */
+    AssetView get_View(void) const noexcept
+    { return AssetView{ rgBytes.data(), rgBytes.size(), eFormat }; };
+};
+
+typedef std::unique_ptr<ReloadedAsset> ReloadedAssetPtr;
+
+class CAssetReloader
+{
+    util::CFileWatcher              m_Watcher;
+    std::string                     m_strRoot;
+    std::vector<std::string>        m_rgExcluded;   ///< "<dir>/" prefixes, relative to the root
+    std::thread                     m_thWorker;
+    std::mutex                      m_mtxWorker;
+    std::condition_variable         m_cvWorker;
+    bool                            m_bShutdown;
+
+    std::mutex                      m_mtxReady;
+    std::vector<ReloadedAssetPtr>   m_rgReady;
+
+    std::atomic<size_t>             m_nDecoded;
+    std::atomic<size_t>             m_nFailed;
+
+public:
+    /// Default Constructor
+    CAssetReloader() noexcept;
+    /// Default Destructor, stops both threads
+    ~CAssetReloader() noexcept;
+
+/**
+ *  @retval true    if szRootDirectory is being watched
+ *
+ *  @note - may throw an exception
+ */
+    bool   Start        (const char* szRootDirectory);
+    void   Stop         (void) noexcept;
+
+/**
+ *  @brief ignores changes below a directory the game itself writes to
+ *         (captures, caches); call before Start()
+ *
+ *  @param [in] szDirectory     relative to the watched root, '/' separated
+ *
+ *  @note - may throw an exception
+ */
+    void   Exclude      (const char* szDirectory);
+
+/**
+ *  @brief moves every decoded asset into rgAssets; never blocks
+ *
+ *  @retval size_t      number of assets appended
+ */
+    size_t TakeReady    (std::vector<ReloadedAssetPtr>& rgAssets) noexcept;
+
+    size_t get_Decoded  (void) const noexcept
+    { return m_nDecoded.load(std::memory_order_relaxed); };
+
+    size_t get_Failed   (void) const noexcept
+    { return m_nFailed.load(std::memory_order_relaxed); };
+
+private:
+    void             WorkerProc  (void) noexcept;
+    ReloadedAssetPtr Decode      (const std::string& strName);
+    bool             IsExcluded  (const std::string& strName) const noexcept;
+
+    /// Copy constructor
+    CAssetReloader(const CAssetReloader&) = delete;
+    /// Assignment operator
+    CAssetReloader& operator=(const CAssetReloader&) = delete;
+};
+
+} // namespace eng
+
+#endif
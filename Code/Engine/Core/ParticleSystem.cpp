@@ -0,0 +1,180 @@
+/**
+ *  @file       ParticleSystem.cpp
+ *  @brief      CParticleSystem class implementation
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ */
+
+#include "targetver.h"  // needs to be 1st header included
+
+#include <algorithm>
+#include <cmath>
+#include <new>
+#include <xmmintrin.h>
+
+#include "Engine/Math/MathUtils.h"
+
+#include "ParticleSystem.h"
+
+namespace eng
+{
+
+//-----------------------------------------------------------------------------------------------
+CParticleSystem::CParticleSystem(size_t nCapacity, float fPointSize /* = 2.f */, float fDrag /* = 0.5f */)
+    : m_pBlock(nullptr),
+      m_rgStreams(),
+      m_nCapacity((nCapacity + 3) & ~static_cast<size_t>(3)),
+      m_nLive(0),
+      m_fDrag(fDrag),
+      m_fPointSize(fPointSize),
+      m_rgVertices()
+{
+    // one aligned block, carved into a stream per attribute; every stream
+    // length is a multiple of 4 so each one starts on a 16 byte boundary
+    m_pBlock = static_cast<float*>( _mm_malloc(sizeof(float) * m_nCapacity * PS_STREAM_COUNT, 16) );
+    if (m_pBlock == nullptr)
+        throw std::bad_alloc();
+
+    std::fill(m_pBlock, m_pBlock + (m_nCapacity * PS_STREAM_COUNT), 0.f);
+
+    for (size_t i = 0; i < PS_STREAM_COUNT; i++)
+        m_rgStreams[i] = m_pBlock + (i * m_nCapacity);
+
+    m_rgVertices.resize(m_nCapacity); // note - may throw an exception
+};
+
+//-----------------------------------------------------------------------------------------------
+CParticleSystem::~CParticleSystem() noexcept
+{
+    if (m_pBlock)
+        _mm_free(m_pBlock);
+};
+
+//-----------------------------------------------------------------------------------------------
+size_t CParticleSystem::Emit(const ParticleBurst& burst, size_t nCount) noexcept
+{
+    nCount = std::min(nCount, m_nCapacity - m_nLive);
+
+    const float fHalfSpread = burst.fDegSpread * 0.5f;
+
+    for (size_t n = 0; n < nCount; n++)
+    {
+        const size_t i = m_nLive++;
+
+        const float fRadDir = math::DegreesToRadians( burst.fDegDirection + math::RangedRand(-fHalfSpread, fHalfSpread) );
+        const float fSpeed  = math::RangedRand( burst.fSpeedMin, burst.fSpeedMax );
+        const float fLife   = std::max( math::RangedRand(burst.fLifeMin, burst.fLifeMax), 0.001f );
+
+        m_rgStreams[PS_POS_X][i]        = burst.vOrigin.X;
+        m_rgStreams[PS_POS_Y][i]        = burst.vOrigin.Y;
+        m_rgStreams[PS_VEL_X][i]        = burst.vBaseVelocity.X + (fSpeed * std::cos(fRadDir));
+        m_rgStreams[PS_VEL_Y][i]        = burst.vBaseVelocity.Y + (fSpeed * std::sin(fRadDir));
+        m_rgStreams[PS_LIFE][i]         = fLife;
+        m_rgStreams[PS_INV_LIFETIME][i] = 1.f / fLife;
+        m_rgStreams[PS_RED][i]          = burst.clr.fRed;
+        m_rgStreams[PS_GREEN][i]        = burst.clr.fGreen;
+        m_rgStreams[PS_BLUE][i]         = burst.clr.fBlue;
+    }
+
+    return nCount;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CParticleSystem::Clear(void) noexcept
+{
+    std::fill(m_rgStreams[PS_LIFE], m_rgStreams[PS_LIFE] + m_nCapacity, 0.f);
+    m_nLive = 0;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CParticleSystem::Kill(size_t nIndex) noexcept
+{
+    // move the last live particle into the vacated slot
+    m_nLive--;
+    if (nIndex != m_nLive)
+    {
+        for (size_t s = 0; s < PS_STREAM_COUNT; s++)
+            m_rgStreams[s][nIndex] = m_rgStreams[s][m_nLive];
+    }
+    // keep the padding lanes past m_nLive reading as dead
+    m_rgStreams[PS_LIFE][m_nLive] = 0.f;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CParticleSystem::Update(float fDeltaTime) noexcept
+{
+    if (m_nLive == 0)
+        return;
+
+    // lanes past m_nLive in the last group are dead padding; updating them is harmless
+    const size_t nPadded = (m_nLive + 3) & ~static_cast<size_t>(3);
+
+    const __m128 vDelta = _mm_set1_ps( fDeltaTime );
+    const __m128 vDamp  = _mm_set1_ps( std::max(0.f, 1.f - (m_fDrag * fDeltaTime)) );
+
+    float* pPosX = m_rgStreams[PS_POS_X];
+    float* pPosY = m_rgStreams[PS_POS_Y];
+    float* pVelX = m_rgStreams[PS_VEL_X];
+    float* pVelY = m_rgStreams[PS_VEL_Y];
+    float* pLife = m_rgStreams[PS_LIFE];
+
+    for (size_t i = 0; i < nPadded; i += 4)
+    {
+        const __m128 vVelX = _mm_mul_ps( _mm_load_ps(pVelX + i), vDamp );
+        const __m128 vVelY = _mm_mul_ps( _mm_load_ps(pVelY + i), vDamp );
+
+        _mm_store_ps( pVelX + i, vVelX );
+        _mm_store_ps( pVelY + i, vVelY );
+        _mm_store_ps( pPosX + i, _mm_add_ps(_mm_load_ps(pPosX + i), _mm_mul_ps(vVelX, vDelta)) );
+        _mm_store_ps( pPosY + i, _mm_add_ps(_mm_load_ps(pPosY + i), _mm_mul_ps(vVelY, vDelta)) );
+        _mm_store_ps( pLife + i, _mm_sub_ps(_mm_load_ps(pLife + i), vDelta) );
+    }
+
+    // compact: whole groups of four still alive are skipped with one compare
+    const __m128 vZero = _mm_setzero_ps();
+
+    for (size_t i = 0; i < m_nLive; i += 4)
+    {
+        if (_mm_movemask_ps( _mm_cmple_ps(_mm_load_ps(pLife + i), vZero) ) == 0)
+            continue;
+
+        for (size_t j = i; j < i + 4 && j < m_nLive; j++)
+        {
+            // the particle moved in may itself have expired
+            while (j < m_nLive && pLife[j] <= 0.f)
+                Kill(j);
+        }
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+void CParticleSystem::Render(void) const noexcept
+{
+    if (m_nLive == 0)
+        return;
+
+    const float* pPosX  = m_rgStreams[PS_POS_X];
+    const float* pPosY  = m_rgStreams[PS_POS_Y];
+    const float* pLife  = m_rgStreams[PS_LIFE];
+    const float* pInv   = m_rgStreams[PS_INV_LIFETIME];
+    const float* pRed   = m_rgStreams[PS_RED];
+    const float* pGreen = m_rgStreams[PS_GREEN];
+    const float* pBlue  = m_rgStreams[PS_BLUE];
+
+    ColoredVertex* pVertex = m_rgVertices.data();
+    for (size_t i = 0; i < m_nLive; i++)
+    {
+        pVertex[i].fX         = pPosX[i];
+        pVertex[i].fY         = pPosY[i];
+        pVertex[i].clr.fRed   = pRed[i];
+        pVertex[i].clr.fGreen = pGreen[i];
+        pVertex[i].clr.fBlue  = pBlue[i];
+        pVertex[i].clr.fAlpha = std::min(pLife[i] * pInv[i], 1.f);
+    }
+
+    g_theRdr.DrawPoints( pVertex, m_nLive, m_fPointSize );
+};
+
+} // namespace eng
@@ -0,0 +1,121 @@
+/**
+ *  @file       ParticleSystem.h
+ *  @brief      CParticleSystem class interface
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ *  <b>Implementation:</b>
+ *
+ *   Particles live in a fixed pool stored as structure-of-arrays: one
+ *   16-byte aligned float stream per attribute, so Update() advances four
+ *   particles per SSE instruction.  Live particles are always packed in
+ *   [0, get_LiveCount()); a particle that expires is overwritten by the last
+ *   live one, so nothing is allocated or shifted after construction.
+ *
+ *   Render() fills a preallocated vertex buffer and submits every particle
+ *   in a single CRenderer::DrawPoints() call; alpha fades with the remaining
+ *   life of each particle.
+ */
+#pragma once
+
+#if !defined(__PARTICLE_SYSTEM_H__)
+#define __PARTICLE_SYSTEM_H__
+
+#ifndef _VECTOR_
+    #include <vector>
+#endif
+
+#ifndef __IRENDERABLE_H__
+    #include "Engine/Core/IRenderable.h"
+#endif
+
+#ifndef __RENDERER_H__
+    #include "Engine/Renderer/Renderer.h"
+#endif
+
+namespace eng
+{
+
+/**
+ * @brief describes a group of particles spawned together
+ */
+struct ParticleBurst
+{
+    math::CVector2f vOrigin;
+    math::CVector2f vBaseVelocity;  ///< added to every particle, e.g. the emitter's velocity
+    float           fDegDirection;  ///< center of the emission cone
+    float           fDegSpread;     ///< width of the emission cone, 360 for a radial burst
+    float           fSpeedMin;
+    float           fSpeedMax;
+    float           fLifeMin;       ///< seconds
+    float           fLifeMax;       ///< seconds
+    ColorRGBA       clr;
+};
+
+class CParticleSystem
+    : public IRenderable
+{
+    enum PARTICLE_STREAM
+    {
+        PS_POS_X = 0,
+        PS_POS_Y,
+        PS_VEL_X,
+        PS_VEL_Y,
+        PS_LIFE,            ///< seconds remaining
+        PS_INV_LIFETIME,    ///< 1 / initial life, used for the alpha fade
+        PS_RED,
+        PS_GREEN,
+        PS_BLUE,
+        PS_STREAM_COUNT
+    };
+
+    float*                                  m_pBlock;
+    float*                                  m_rgStreams[PS_STREAM_COUNT];
+    size_t                                  m_nCapacity;
+    size_t                                  m_nLive;
+    float                                   m_fDrag;         ///< fraction of velocity lost per second
+    float                                   m_fPointSize;
+    mutable std::vector<ColoredVertex>      m_rgVertices;    ///< Render() staging, sized once
+
+public:
+/**
+ *  @param [in] nCapacity    maximum number of live particles, rounded up
+ *                           to a multiple of 4
+ */
+    explicit CParticleSystem(size_t nCapacity, float fPointSize = 2.f, float fDrag = 0.5f);
+    /// Default Destructor
+    ~CParticleSystem() noexcept;
+
+/**
+ *  @brief spawns up to nCount particles
+ *
+ *  @retval size_t   number actually spawned, fewer than nCount if the
+ *                   pool is full
+ */
+    size_t          Emit            (const ParticleBurst& burst, size_t nCount) noexcept;
+
+    void            Clear           (void) noexcept;
+
+    constexpr size_t get_LiveCount  (void) const noexcept
+    { return m_nLive; };
+
+    constexpr size_t get_Capacity   (void) const noexcept
+    { return m_nCapacity; };
+
+// IRenderable
+    void            Update          (float fDeltaTime) noexcept override;
+    void            Render          (void) const noexcept override;
+
+private:
+    void            Kill            (size_t nIndex) noexcept;
+
+    /// Copy constructor
+    CParticleSystem(const CParticleSystem&) = delete;
+    /// Assignment operator
+    CParticleSystem& operator=(const CParticleSystem&) = delete;
+};
+
+} // namespace eng
+
+#endif
@@ -12,6 +12,10 @@
 #if !defined(__AABB2_H__)
 #define __AABB2_H__
 
+#ifndef _LIMITS_
+    #include <limits>
+#endif
+
 #ifndef __VECTOR2_H__
     #include "Engine/Math/Vector2.h"
 #endif
@@ -45,6 +49,8 @@ public:
     explicit constexpr CAABB2(const math::CVector2i& vMin, int iWidth, int iHeight) noexcept;
     /// Default destructor
     ~CAABB2() = default;
+    /// Assignment operator
+    CAABB2& operator=(const CAABB2& rhs) noexcept = default;
 
 /**
  *  @brief get AABB min point
@@ -68,6 +74,54 @@ public:
     constexpr math::CVector2f        CalcCenter(void) const noexcept;
 };
 
+//-----------------------------------------------------------------------------------------------
+constexpr
+CAABB2::CAABB2() noexcept
+    : m_vMin(0.0, 0.0),
+      m_vMax(std::numeric_limits<float>::max(), std::numeric_limits<float>::max() )
+{
+};
+
+//-----------------------------------------------------------------------------------------------
+constexpr
+CAABB2::CAABB2(const CAABB2& o) noexcept
+    : m_vMin( o.m_vMin ),
+      m_vMax( o.m_vMax )
+{
+};
+
+//-----------------------------------------------------------------------------------------------
+constexpr
+CAABB2::CAABB2(const math::CVector2f& vMin, const math::CVector2f& vMax) noexcept
+    : m_vMin( vMin ),
+      m_vMax( vMax )
+{
+};
+
+//-----------------------------------------------------------------------------------------------
+constexpr
+CAABB2::CAABB2(const math::CVector2i& vMin, const math::CVector2i& vMax) noexcept
+    : m_vMin(static_cast<float>(vMin.X), static_cast<float>(vMin.Y)),
+      m_vMax(static_cast<float>(vMax.X), static_cast<float>(vMax.Y))
+{
+};
+
+//-----------------------------------------------------------------------------------------------
+constexpr
+CAABB2::CAABB2(const math::CVector2f& vMin, float fWidth, float fHeight) noexcept
+    : m_vMin(vMin),
+      m_vMax(vMin.X + fWidth, vMin.Y + fHeight)
+{
+};
+
+//-----------------------------------------------------------------------------------------------
+constexpr
+CAABB2::CAABB2(const math::CVector2i& vMin, int iWidth, int iHeight) noexcept
+    : m_vMin(static_cast<float>(vMin.X), static_cast<float>(vMin.Y)),
+      m_vMax(static_cast<float>(vMin.X + iWidth), static_cast<float>(vMin.Y + iHeight))
+{
+};
+
  constexpr const math::CVector2f& 
  CAABB2::get_Min(void) const noexcept
  { return m_vMin; };
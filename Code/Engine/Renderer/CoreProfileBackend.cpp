@@ -0,0 +1,759 @@
+/**
+ *  @file       CoreProfileBackend.cpp
+ *  @brief      CCoreProfileBackend class implementation
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ * <b>Cite:</b>
+ *
+ * @sa https://www.khronos.org/registry/OpenGL/extensions/ARB/WGL_ARB_create_context.txt
+ * @sa https://www.khronos.org/opengl/wiki/Buffer_Object_Streaming
+ */
+
+#define WIN32_LEAN_AND_MEAN
+#include "targetver.h"  // this needs to be the 1st header included
+
+#include <Windows.h>
+#include <gl/gl.h>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+
+#include "Engine/Math/MathUtils.h"
+
+#include "CoreProfileBackend.h"
+
+#pragma comment( lib, "opengl32" ) // Link in the OpenGL32.lib static library
+
+namespace eng
+{
+namespace rdr
+{
+
+using  namespace eng::math;
+
+//-----------------------------------------------------------------------------------------------
+// <gl/gl.h> stops at OpenGL 1.1; everything newer is declared here and
+// resolved through wglGetProcAddress once a 3.3 context is current.
+
+typedef char       GLchar;
+typedef ptrdiff_t  GLsizeiptr;
+typedef ptrdiff_t  GLintptr;
+
+constexpr GLenum GL_ARRAY_BUFFER_              = 0x8892;
+constexpr GLenum GL_ELEMENT_ARRAY_BUFFER_      = 0x8893;
+constexpr GLenum GL_STREAM_DRAW_               = 0x88E0;
+constexpr GLenum GL_STATIC_DRAW_               = 0x88E4;
+constexpr GLenum GL_FRAGMENT_SHADER_           = 0x8B30;
+constexpr GLenum GL_VERTEX_SHADER_             = 0x8B31;
+constexpr GLenum GL_COMPILE_STATUS_            = 0x8B81;
+constexpr GLenum GL_LINK_STATUS_               = 0x8B82;
+constexpr GLenum GL_TEXTURE0_                  = 0x84C0;
+constexpr GLbitfield GL_MAP_WRITE_BIT_            = 0x0002;
+constexpr GLbitfield GL_MAP_INVALIDATE_RANGE_BIT_ = 0x0004;
+constexpr GLbitfield GL_MAP_UNSYNCHRONIZED_BIT_   = 0x0020;
+
+constexpr int WGL_CONTEXT_MAJOR_VERSION_ARB_    = 0x2091;
+constexpr int WGL_CONTEXT_MINOR_VERSION_ARB_    = 0x2092;
+constexpr int WGL_CONTEXT_PROFILE_MASK_ARB_     = 0x9126;
+constexpr int WGL_CONTEXT_CORE_PROFILE_BIT_ARB_ = 0x0001;
+
+typedef HGLRC  (WINAPI  *PFN_wglCreateContextAttribsARB)(HDC, HGLRC, const int*);
+
+typedef void   (APIENTRY *PFN_glGenBuffers)(GLsizei, GLuint*);
+typedef void   (APIENTRY *PFN_glDeleteBuffers)(GLsizei, const GLuint*);
+typedef void   (APIENTRY *PFN_glBindBuffer)(GLenum, GLuint);
+typedef void   (APIENTRY *PFN_glBufferData)(GLenum, GLsizeiptr, const void*, GLenum);
+typedef void*  (APIENTRY *PFN_glMapBufferRange)(GLenum, GLintptr, GLsizeiptr, GLbitfield);
+typedef GLboolean (APIENTRY *PFN_glUnmapBuffer)(GLenum);
+typedef void   (APIENTRY *PFN_glGenVertexArrays)(GLsizei, GLuint*);
+typedef void   (APIENTRY *PFN_glDeleteVertexArrays)(GLsizei, const GLuint*);
+typedef void   (APIENTRY *PFN_glBindVertexArray)(GLuint);
+typedef void   (APIENTRY *PFN_glEnableVertexAttribArray)(GLuint);
+typedef void   (APIENTRY *PFN_glDisableVertexAttribArray)(GLuint);
+typedef void   (APIENTRY *PFN_glVertexAttribPointer)(GLuint, GLint, GLenum, GLboolean, GLsizei, const void*);
+typedef void   (APIENTRY *PFN_glVertexAttrib4f)(GLuint, GLfloat, GLfloat, GLfloat, GLfloat);
+typedef void   (APIENTRY *PFN_glVertexAttribDivisor)(GLuint, GLuint);
+typedef void   (APIENTRY *PFN_glDrawArraysInstanced)(GLenum, GLint, GLsizei, GLsizei);
+typedef GLuint (APIENTRY *PFN_glCreateShader)(GLenum);
+typedef void   (APIENTRY *PFN_glShaderSource)(GLuint, GLsizei, const GLchar* const*, const GLint*);
+typedef void   (APIENTRY *PFN_glCompileShader)(GLuint);
+typedef void   (APIENTRY *PFN_glGetShaderiv)(GLuint, GLenum, GLint*);
+typedef void   (APIENTRY *PFN_glDeleteShader)(GLuint);
+typedef GLuint (APIENTRY *PFN_glCreateProgram)(void);
+typedef void   (APIENTRY *PFN_glAttachShader)(GLuint, GLuint);
+typedef void   (APIENTRY *PFN_glLinkProgram)(GLuint);
+typedef void   (APIENTRY *PFN_glGetProgramiv)(GLuint, GLenum, GLint*);
+typedef void   (APIENTRY *PFN_glDeleteProgram)(GLuint);
+typedef void   (APIENTRY *PFN_glUseProgram)(GLuint);
+typedef GLint  (APIENTRY *PFN_glGetUniformLocation)(GLuint, const GLchar*);
+typedef void   (APIENTRY *PFN_glUniform1i)(GLint, GLint);
+typedef void   (APIENTRY *PFN_glUniformMatrix3fv)(GLint, GLsizei, GLboolean, const GLfloat*);
+typedef void   (APIENTRY *PFN_glActiveTexture)(GLenum);
+
+static struct GLCoreFunctions
+{
+    PFN_glGenBuffers                GenBuffers;
+    PFN_glDeleteBuffers             DeleteBuffers;
+    PFN_glBindBuffer                BindBuffer;
+    PFN_glBufferData                BufferData;
+    PFN_glMapBufferRange            MapBufferRange;
+    PFN_glUnmapBuffer               UnmapBuffer;
+    PFN_glGenVertexArrays           GenVertexArrays;
+    PFN_glDeleteVertexArrays        DeleteVertexArrays;
+    PFN_glBindVertexArray           BindVertexArray;
+    PFN_glEnableVertexAttribArray   EnableVertexAttribArray;
+    PFN_glDisableVertexAttribArray  DisableVertexAttribArray;
+    PFN_glVertexAttribPointer       VertexAttribPointer;
+    PFN_glVertexAttrib4f            VertexAttrib4f;
+    PFN_glVertexAttribDivisor       VertexAttribDivisor;
+    PFN_glDrawArraysInstanced       DrawArraysInstanced;
+    PFN_glCreateShader              CreateShader;
+    PFN_glShaderSource              ShaderSource;
+    PFN_glCompileShader             CompileShader;
+    PFN_glGetShaderiv               GetShaderiv;
+    PFN_glDeleteShader              DeleteShader;
+    PFN_glCreateProgram             CreateProgram;
+    PFN_glAttachShader              AttachShader;
+    PFN_glLinkProgram               LinkProgram;
+    PFN_glGetProgramiv              GetProgramiv;
+    PFN_glDeleteProgram             DeleteProgram;
+    PFN_glUseProgram                UseProgram;
+    PFN_glGetUniformLocation        GetUniformLocation;
+    PFN_glUniform1i                 Uniform1i;
+    PFN_glUniformMatrix3fv          UniformMatrix3fv;
+    PFN_glActiveTexture             ActiveTexture;
+} s_gl = { };
+
+//-----------------------------------------------------------------------------------------------
+template <class _TFunc>
+static bool LoadFunction( _TFunc& pfn, const char* szName ) noexcept
+{
+    pfn = reinterpret_cast<_TFunc>( wglGetProcAddress(szName) );
+    return pfn != nullptr;
+};
+
+//-----------------------------------------------------------------------------------------------
+static bool LoadCoreFunctions( void ) noexcept
+{
+    bool bResult = true;
+
+    bResult &= LoadFunction( s_gl.GenBuffers,               "glGenBuffers" );
+    bResult &= LoadFunction( s_gl.DeleteBuffers,            "glDeleteBuffers" );
+    bResult &= LoadFunction( s_gl.BindBuffer,               "glBindBuffer" );
+    bResult &= LoadFunction( s_gl.BufferData,               "glBufferData" );
+    bResult &= LoadFunction( s_gl.MapBufferRange,           "glMapBufferRange" );
+    bResult &= LoadFunction( s_gl.UnmapBuffer,              "glUnmapBuffer" );
+    bResult &= LoadFunction( s_gl.GenVertexArrays,          "glGenVertexArrays" );
+    bResult &= LoadFunction( s_gl.DeleteVertexArrays,       "glDeleteVertexArrays" );
+    bResult &= LoadFunction( s_gl.BindVertexArray,          "glBindVertexArray" );
+    bResult &= LoadFunction( s_gl.EnableVertexAttribArray,  "glEnableVertexAttribArray" );
+    bResult &= LoadFunction( s_gl.DisableVertexAttribArray, "glDisableVertexAttribArray" );
+    bResult &= LoadFunction( s_gl.VertexAttribPointer,      "glVertexAttribPointer" );
+    bResult &= LoadFunction( s_gl.VertexAttrib4f,           "glVertexAttrib4f" );
+    bResult &= LoadFunction( s_gl.VertexAttribDivisor,      "glVertexAttribDivisor" );
+    bResult &= LoadFunction( s_gl.DrawArraysInstanced,      "glDrawArraysInstanced" );
+    bResult &= LoadFunction( s_gl.CreateShader,             "glCreateShader" );
+    bResult &= LoadFunction( s_gl.ShaderSource,             "glShaderSource" );
+    bResult &= LoadFunction( s_gl.CompileShader,            "glCompileShader" );
+    bResult &= LoadFunction( s_gl.GetShaderiv,              "glGetShaderiv" );
+    bResult &= LoadFunction( s_gl.DeleteShader,             "glDeleteShader" );
+    bResult &= LoadFunction( s_gl.CreateProgram,            "glCreateProgram" );
+    bResult &= LoadFunction( s_gl.AttachShader,             "glAttachShader" );
+    bResult &= LoadFunction( s_gl.LinkProgram,              "glLinkProgram" );
+    bResult &= LoadFunction( s_gl.GetProgramiv,             "glGetProgramiv" );
+    bResult &= LoadFunction( s_gl.DeleteProgram,            "glDeleteProgram" );
+    bResult &= LoadFunction( s_gl.UseProgram,               "glUseProgram" );
+    bResult &= LoadFunction( s_gl.GetUniformLocation,       "glGetUniformLocation" );
+    bResult &= LoadFunction( s_gl.Uniform1i,                "glUniform1i" );
+    bResult &= LoadFunction( s_gl.UniformMatrix3fv,         "glUniformMatrix3fv" );
+    bResult &= LoadFunction( s_gl.ActiveTexture,            "glActiveTexture" );
+
+    return bResult;
+};
+
+//-----------------------------------------------------------------------------------------------
+// vertex attribute locations shared by both programs
+enum VERTEX_ATTRIBUTE : GLuint
+{
+    VA_POSITION  = 0,
+    VA_COLOR     = 1,
+    VA_TEXCOORD  = 2,
+    VA_PLACEMENT = 3,   ///< per instance: x, y, scale, degrees
+    VA_INSTANCE_COLOR = 4,
+    VA_COUNT
+};
+
+constexpr size_t k_nStreamBufferSize = 8 * 1024 * 1024;
+constexpr size_t k_nMaxBatchQuads    = 65536 / 4;      // addressable with 16-bit indices
+constexpr size_t k_nMatrixStackDepth = 32;
+
+static const char* const k_szColorVS =
+    "#version 330 core\n"
+    "layout(location = 0) in vec2 a_vPosition;\n"
+    "layout(location = 1) in vec4 a_clrColor;\n"
+    "layout(location = 2) in vec2 a_vTexCoord;\n"
+    "uniform mat3 u_mTransform;\n"
+    "out vec4 v_clrColor;\n"
+    "out vec2 v_vTexCoord;\n"
+    "void main()\n"
+    "{\n"
+    "    gl_Position = vec4((u_mTransform * vec3(a_vPosition, 1.0)).xy, 0.0, 1.0);\n"
+    "    v_clrColor  = a_clrColor;\n"
+    "    v_vTexCoord = a_vTexCoord;\n"
+    "}\n";
+
+static const char* const k_szInstanceVS =
+    "#version 330 core\n"
+    "layout(location = 0) in vec2 a_vPosition;\n"
+    "layout(location = 3) in vec4 a_vPlacement;\n"
+    "layout(location = 4) in vec4 a_clrColor;\n"
+    "uniform mat3 u_mTransform;\n"
+    "out vec4 v_clrColor;\n"
+    "out vec2 v_vTexCoord;\n"
+    "void main()\n"
+    "{\n"
+    "    float fRadians = radians(a_vPlacement.w);\n"
+    "    float fCos = cos(fRadians);\n"
+    "    float fSin = sin(fRadians);\n"
+    "    vec2  v    = a_vPosition * a_vPlacement.z;\n"
+    "    v = vec2((v.x * fCos) - (v.y * fSin), (v.x * fSin) + (v.y * fCos)) + a_vPlacement.xy;\n"
+    "    gl_Position = vec4((u_mTransform * vec3(v, 1.0)).xy, 0.0, 1.0);\n"
+    "    v_clrColor  = a_clrColor;\n"
+    "    v_vTexCoord = vec2(0.0);\n"
+    "}\n";
+
+static const char* const k_szColorFS =
+    "#version 330 core\n"
+    "uniform sampler2D u_texDiffuse;\n"
+    "uniform bool      u_bTextured;\n"
+    "in  vec4 v_clrColor;\n"
+    "in  vec2 v_vTexCoord;\n"
+    "out vec4 o_clrFragment;\n"
+    "void main()\n"
+    "{\n"
+    "    o_clrFragment = u_bTextured ? v_clrColor * texture(u_texDiffuse, v_vTexCoord) : v_clrColor;\n"
+    "}\n";
+
+//-----------------------------------------------------------------------------------------------
+static GLenum ToGLPrimitive( PRIMITIVE_TYPE ePrim ) noexcept
+{
+    switch (ePrim)
+    {
+    case PRIM_POINTS:       return GL_POINTS;
+    case PRIM_LINES:        return GL_LINES;
+    case PRIM_LINE_LOOP:    return GL_LINE_LOOP;
+    case PRIM_TRIANGLE_FAN: return GL_TRIANGLE_FAN;
+    }
+    return GL_POINTS;
+};
+
+//-----------------------------------------------------------------------------------------------
+static GLuint CompileShader( GLenum eType, const char* szSource ) noexcept
+{
+    GLuint nShader = s_gl.CreateShader(eType);
+    s_gl.ShaderSource (nShader, 1, &szSource, nullptr);
+    s_gl.CompileShader(nShader);
+
+    GLint iStatus = GL_FALSE;
+    s_gl.GetShaderiv(nShader, GL_COMPILE_STATUS_, &iStatus);
+    if (iStatus != GL_TRUE)
+    {
+        s_gl.DeleteShader(nShader);
+        nShader = 0;
+    }
+    return nShader;
+};
+
+//-----------------------------------------------------------------------------------------------
+static GLuint LinkProgram( const char* szVertexSource, const char* szFragmentSource ) noexcept
+{
+    GLuint nProgram = 0;
+    GLuint nVS      = CompileShader(GL_VERTEX_SHADER_,   szVertexSource);
+    GLuint nFS      = CompileShader(GL_FRAGMENT_SHADER_, szFragmentSource);
+
+    if (nVS && nFS)
+    {
+        nProgram = s_gl.CreateProgram();
+        s_gl.AttachShader(nProgram, nVS);
+        s_gl.AttachShader(nProgram, nFS);
+        s_gl.LinkProgram (nProgram);
+
+        GLint iStatus = GL_FALSE;
+        s_gl.GetProgramiv(nProgram, GL_LINK_STATUS_, &iStatus);
+        if (iStatus != GL_TRUE)
+        {
+            s_gl.DeleteProgram(nProgram);
+            nProgram = 0;
+        }
+    }
+
+    // the program keeps what it needs
+    if (nVS)
+        s_gl.DeleteShader(nVS);
+    if (nFS)
+        s_gl.DeleteShader(nFS);
+
+    return nProgram;
+};
+
+//-----------------------------------------------------------------------------------------------
+static void UploadTransform( GLint iLocation, const Affine2& m ) noexcept
+{
+    const GLfloat rgMatrix[9] =
+    {
+        m.a,  m.b,  0.f,
+        m.c,  m.d,  0.f,
+        m.tx, m.ty, 1.f
+    };
+    s_gl.UniformMatrix3fv(iLocation, 1, GL_FALSE, rgMatrix);
+};
+
+//-----------------------------------------------------------------------------------------------
+HGLRC CreateCoreProfileContext( HDC hdc, HGLRC hglrcLegacy ) noexcept
+{
+    if (hdc == nullptr || hglrcLegacy == nullptr)
+        return nullptr;
+
+    PFN_wglCreateContextAttribsARB pfnCreateContextAttribs = nullptr;
+    if (!LoadFunction(pfnCreateContextAttribs, "wglCreateContextAttribsARB"))
+        return nullptr;
+
+    // no WGL_CONTEXT_FORWARD_COMPATIBLE_BIT_ARB, so wide lines stay available
+    const int rgAttribs[] =
+    {
+        WGL_CONTEXT_MAJOR_VERSION_ARB_, 3,
+        WGL_CONTEXT_MINOR_VERSION_ARB_, 3,
+        WGL_CONTEXT_PROFILE_MASK_ARB_,  WGL_CONTEXT_CORE_PROFILE_BIT_ARB_,
+        0
+    };
+
+    HGLRC hglrcCore = pfnCreateContextAttribs(hdc, nullptr, rgAttribs);
+    if (hglrcCore == nullptr)
+        return nullptr;
+
+    if (!wglMakeCurrent(hdc, hglrcCore))
+    {
+        wglDeleteContext(hglrcCore);
+        wglMakeCurrent(hdc, hglrcLegacy);
+        return nullptr;
+    }
+
+    return hglrcCore;
+};
+
+//-----------------------------------------------------------------------------------------------
+CCoreProfileBackend::CCoreProfileBackend() noexcept
+    : m_nColorProgram(0),
+      m_nInstanceProgram(0),
+      m_iColorTransformLoc(-1),
+      m_iColorTexturedLoc(-1),
+      m_iInstanceTransformLoc(-1),
+      m_nVertexArray(0),
+      m_nStreamBuffer(0),
+      m_nStreamOffset(0),
+      m_nQuadIndexBuffer(0),
+      m_nShapeBuffer(0),
+      m_bShapesDirty(false),
+      m_rgShapeVertices(),
+      m_rgShapes(),
+      m_rgMatrixStack(),
+      m_clrCurrent(RGBA_WHITE),
+      m_bInitialized(false)
+{
+};
+
+//-----------------------------------------------------------------------------------------------
+bool CCoreProfileBackend::Initialize(void) noexcept
+{
+    if (m_bInitialized)
+        return true;
+
+    if (!LoadCoreFunctions())
+        return false;
+
+    try
+    {
+        m_rgMatrixStack.reserve(k_nMatrixStackDepth);
+        m_rgMatrixStack.assign(1, Affine2{ 1.f, 0.f, 0.f, 1.f, 0.f, 0.f });
+
+        // 0-1-2, 0-2-3 for every quad in a batch
+        std::vector<unsigned short> rgIndices(k_nMaxBatchQuads * 6);
+        for (size_t i = 0; i < k_nMaxBatchQuads; i++)
+        {
+            const unsigned short nBase = static_cast<unsigned short>(i * 4);
+            unsigned short* pIndex = &rgIndices[i * 6];
+            pIndex[0] = nBase;      pIndex[1] = nBase + 1;  pIndex[2] = nBase + 2;
+            pIndex[3] = nBase;      pIndex[4] = nBase + 2;  pIndex[5] = nBase + 3;
+        }
+
+        m_nColorProgram    = LinkProgram(k_szColorVS,    k_szColorFS);
+        m_nInstanceProgram = LinkProgram(k_szInstanceVS, k_szColorFS);
+        if (m_nColorProgram == 0 || m_nInstanceProgram == 0)
+        {
+            Shutdown();
+            return false;
+        }
+
+        m_iColorTransformLoc    = s_gl.GetUniformLocation(m_nColorProgram,    "u_mTransform");
+        m_iColorTexturedLoc     = s_gl.GetUniformLocation(m_nColorProgram,    "u_bTextured");
+        m_iInstanceTransformLoc = s_gl.GetUniformLocation(m_nInstanceProgram, "u_mTransform");
+
+        s_gl.UseProgram(m_nColorProgram);
+        s_gl.Uniform1i (s_gl.GetUniformLocation(m_nColorProgram, "u_texDiffuse"), 0);
+
+        s_gl.GenVertexArrays(1, &m_nVertexArray);
+        s_gl.BindVertexArray(m_nVertexArray);
+
+        s_gl.GenBuffers(1, &m_nStreamBuffer);
+        s_gl.BindBuffer(GL_ARRAY_BUFFER_, m_nStreamBuffer);
+        s_gl.BufferData(GL_ARRAY_BUFFER_, k_nStreamBufferSize, nullptr, GL_STREAM_DRAW_);
+
+        // element array binding is vertex array state; bound once for good
+        s_gl.GenBuffers(1, &m_nQuadIndexBuffer);
+        s_gl.BindBuffer(GL_ELEMENT_ARRAY_BUFFER_, m_nQuadIndexBuffer);
+        s_gl.BufferData(GL_ELEMENT_ARRAY_BUFFER_, rgIndices.size() * sizeof(unsigned short), rgIndices.data(), GL_STATIC_DRAW_);
+
+        s_gl.GenBuffers(1, &m_nShapeBuffer);
+
+        s_gl.VertexAttribDivisor(VA_PLACEMENT,      1);
+        s_gl.VertexAttribDivisor(VA_INSTANCE_COLOR, 1);
+    }
+    catch (...)
+    {
+        Shutdown();
+        return false;
+    }
+
+    glEnable   ( GL_BLEND );
+    glBlendFunc( GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA );
+    glEnable   ( GL_LINE_SMOOTH );
+
+    m_nStreamOffset = 0;
+    m_bShapesDirty  = !m_rgShapeVertices.empty();
+    m_bInitialized  = true;
+    return true;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CCoreProfileBackend::Shutdown(void) noexcept
+{
+    if (s_gl.DeleteBuffers)
+    {
+        const GLuint rgBuffers[] = { m_nStreamBuffer, m_nQuadIndexBuffer, m_nShapeBuffer };
+        s_gl.DeleteBuffers(_countof(rgBuffers), rgBuffers);
+    }
+    if (s_gl.DeleteVertexArrays && m_nVertexArray)
+        s_gl.DeleteVertexArrays(1, &m_nVertexArray);
+    if (s_gl.DeleteProgram)
+    {
+        if (m_nColorProgram)
+            s_gl.DeleteProgram(m_nColorProgram);
+        if (m_nInstanceProgram)
+            s_gl.DeleteProgram(m_nInstanceProgram);
+    }
+
+    m_nStreamBuffer = m_nQuadIndexBuffer = m_nShapeBuffer = 0;
+    m_nVertexArray  = 0;
+    m_nColorProgram = m_nInstanceProgram = 0;
+    m_bInitialized  = false;
+};
+
+//-----------------------------------------------------------------------------------------------
+const char* CCoreProfileBackend::get_Name(void) const noexcept
+{
+    return "OpenGL 3.3 core profile";
+};
+
+//-----------------------------------------------------------------------------------------------
+void CCoreProfileBackend::Clear(void) noexcept
+{
+    glClear( GL_COLOR_BUFFER_BIT );
+};
+
+//-----------------------------------------------------------------------------------------------
+void CCoreProfileBackend::SetClearColor( const ColorRGBA& clr ) noexcept
+{
+    glClearColor( clr.fRed, clr.fGreen, clr.fBlue, clr.fAlpha );
+};
+
+//-----------------------------------------------------------------------------------------------
+void CCoreProfileBackend::SetViewPort( int iX, int iY, int iWidth, int iHeight ) noexcept
+{
+    glViewport(iX, iY, iWidth, iHeight);
+};
+
+//-----------------------------------------------------------------------------------------------
+void CCoreProfileBackend::SetOrtho( const CVector2f& vBottomLeft, const CVector2f& vTopRight ) noexcept
+{
+    // same as glLoadIdentity() + glOrtho() on the current matrix
+    const float fWidth  = vTopRight.X - vBottomLeft.X;
+    const float fHeight = vTopRight.Y - vBottomLeft.Y;
+    if (fWidth == 0.f || fHeight == 0.f || m_rgMatrixStack.empty())
+        return;
+
+    get_Top() = Affine2{ 2.f / fWidth, 0.f,
+                         0.f,          2.f / fHeight,
+                         -(vTopRight.X + vBottomLeft.X) / fWidth,
+                         -(vTopRight.Y + vBottomLeft.Y) / fHeight };
+};
+
+//-----------------------------------------------------------------------------------------------
+void CCoreProfileBackend::SetLineWidth( float fLineWidth ) noexcept
+{
+    glLineWidth( fLineWidth );
+};
+
+//-----------------------------------------------------------------------------------------------
+void CCoreProfileBackend::SetPointSize( float fPointSize ) noexcept
+{
+    glPointSize( fPointSize );
+};
+
+//-----------------------------------------------------------------------------------------------
+void CCoreProfileBackend::SetColor( const ColorRGBA& clr ) noexcept
+{
+    m_clrCurrent = clr;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CCoreProfileBackend::Translate( const CVector2f& vTranslate ) noexcept
+{
+    if (m_rgMatrixStack.empty())
+        return;
+
+    Affine2& m = get_Top();
+    m.tx += (m.a * vTranslate.X) + (m.c * vTranslate.Y);
+    m.ty += (m.b * vTranslate.X) + (m.d * vTranslate.Y);
+};
+
+//-----------------------------------------------------------------------------------------------
+void CCoreProfileBackend::Rotate( float fDegrees ) noexcept
+{
+    if (m_rgMatrixStack.empty())
+        return;
+
+    const float fRadians = DegreesToRadians(fDegrees);
+    const float fCos     = std::cos(fRadians);
+    const float fSin     = std::sin(fRadians);
+
+    Affine2& m = get_Top();
+    const Affine2 o = m;
+    m.a = (o.a * fCos) + (o.c * fSin);
+    m.b = (o.b * fCos) + (o.d * fSin);
+    m.c = (o.c * fCos) - (o.a * fSin);
+    m.d = (o.d * fCos) - (o.b * fSin);
+};
+
+//-----------------------------------------------------------------------------------------------
+void CCoreProfileBackend::Scale( float fUniformScale ) noexcept
+{
+    if (m_rgMatrixStack.empty())
+        return;
+
+    Affine2& m = get_Top();
+    m.a *= fUniformScale;
+    m.b *= fUniformScale;
+    m.c *= fUniformScale;
+    m.d *= fUniformScale;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CCoreProfileBackend::PushMatrix(void) noexcept
+{
+    // fixed depth, like the GL matrix stack; overflow is ignored
+    if (!m_rgMatrixStack.empty() && m_rgMatrixStack.size() < m_rgMatrixStack.capacity())
+        m_rgMatrixStack.push_back(get_Top());
+};
+
+//-----------------------------------------------------------------------------------------------
+void CCoreProfileBackend::PopMatrix(void) noexcept
+{
+    if (m_rgMatrixStack.size() > 1)
+        m_rgMatrixStack.pop_back();
+};
+
+//-----------------------------------------------------------------------------------------------
+size_t CCoreProfileBackend::Stream( const void* pData, size_t nBytes ) noexcept
+{
+    // keep every block 16 byte aligned
+    const size_t nAligned = (nBytes + 15) & ~static_cast<size_t>(15);
+
+    s_gl.BindBuffer(GL_ARRAY_BUFFER_, m_nStreamBuffer);
+
+    if (m_nStreamOffset + nAligned > k_nStreamBufferSize)
+    {
+        // orphan: the driver hands back fresh storage while the GPU finishes with the old
+        s_gl.BufferData(GL_ARRAY_BUFFER_, k_nStreamBufferSize, nullptr, GL_STREAM_DRAW_);
+        m_nStreamOffset = 0;
+    }
+
+    const size_t nOffset = m_nStreamOffset;
+
+    // never overwrites a range the GPU may still read, so no synchronization is needed
+    void* pDest = s_gl.MapBufferRange(GL_ARRAY_BUFFER_, nOffset, nBytes,
+                                      GL_MAP_WRITE_BIT_ | GL_MAP_INVALIDATE_RANGE_BIT_ | GL_MAP_UNSYNCHRONIZED_BIT_);
+    if (pDest)
+    {
+        memcpy(pDest, pData, nBytes);
+        s_gl.UnmapBuffer(GL_ARRAY_BUFFER_);
+    }
+
+    m_nStreamOffset += nAligned;
+    return nOffset;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CCoreProfileBackend::ResetAttributes(void) noexcept
+{
+    for (GLuint i = 0; i < VA_COUNT; i++)
+        s_gl.DisableVertexAttribArray(i);
+};
+
+//-----------------------------------------------------------------------------------------------
+void CCoreProfileBackend::UseColorProgram( bool bTextured ) noexcept
+{
+    s_gl.UseProgram(m_nColorProgram);
+    s_gl.Uniform1i (m_iColorTexturedLoc, bTextured ? 1 : 0);
+    UploadTransform(m_iColorTransformLoc, get_Top());
+    ResetAttributes();
+};
+
+//-----------------------------------------------------------------------------------------------
+void CCoreProfileBackend::DrawVertices( PRIMITIVE_TYPE ePrim, const CVector2f* rgVertices, size_t nVertices ) noexcept
+{
+    const size_t nBytes = nVertices * sizeof(CVector2f);
+    if (!m_bInitialized || rgVertices == nullptr || nVertices == 0 || nBytes > k_nStreamBufferSize)
+        return;
+
+    UseColorProgram(false);
+
+    const size_t nOffset = Stream(rgVertices, nBytes);
+
+    s_gl.EnableVertexAttribArray(VA_POSITION);
+    s_gl.VertexAttribPointer    (VA_POSITION, 2, GL_FLOAT, GL_FALSE, sizeof(CVector2f), reinterpret_cast<const void*>(nOffset));
+    // disabled attribute arrays read the current generic value
+    s_gl.VertexAttrib4f         (VA_COLOR, m_clrCurrent.fRed, m_clrCurrent.fGreen, m_clrCurrent.fBlue, m_clrCurrent.fAlpha);
+
+    glDrawArrays( ToGLPrimitive(ePrim), 0, static_cast<GLsizei>(nVertices) );
+};
+
+//-----------------------------------------------------------------------------------------------
+void CCoreProfileBackend::DrawColoredVertices( PRIMITIVE_TYPE ePrim, const ColoredVertex* rgVertices, size_t nVertices ) noexcept
+{
+    const size_t nBytes = nVertices * sizeof(ColoredVertex);
+    if (!m_bInitialized || rgVertices == nullptr || nVertices == 0 || nBytes > k_nStreamBufferSize)
+        return;
+
+    UseColorProgram(false);
+
+    const size_t nOffset = Stream(rgVertices, nBytes);
+
+    s_gl.EnableVertexAttribArray(VA_POSITION);
+    s_gl.EnableVertexAttribArray(VA_COLOR);
+    s_gl.VertexAttribPointer    (VA_POSITION, 2, GL_FLOAT, GL_FALSE, sizeof(ColoredVertex),
+                                 reinterpret_cast<const void*>(nOffset + offsetof(ColoredVertex, fX)));
+    s_gl.VertexAttribPointer    (VA_COLOR,    4, GL_FLOAT, GL_FALSE, sizeof(ColoredVertex),
+                                 reinterpret_cast<const void*>(nOffset + offsetof(ColoredVertex, clr)));
+
+    glDrawArrays( ToGLPrimitive(ePrim), 0, static_cast<GLsizei>(nVertices) );
+};
+
+//-----------------------------------------------------------------------------------------------
+void CCoreProfileBackend::DrawTexturedQuads( unsigned int nTextureID, const TexturedVertex* rgVertices, size_t nVertices ) noexcept
+{
+    if (!m_bInitialized || rgVertices == nullptr || nVertices < 4)
+        return;
+
+    UseColorProgram(true);
+
+    s_gl.ActiveTexture( GL_TEXTURE0_ );
+    glBindTexture     ( GL_TEXTURE_2D, nTextureID );
+
+    s_gl.EnableVertexAttribArray(VA_POSITION);
+    s_gl.EnableVertexAttribArray(VA_COLOR);
+    s_gl.EnableVertexAttribArray(VA_TEXCOORD);
+
+    // GL_QUADS is gone; draw indexed triangle pairs, one 16-bit index range at a time
+    size_t nQuads = nVertices / 4;
+    while (nQuads)
+    {
+        const size_t nBatch  = (nQuads < k_nMaxBatchQuads) ? nQuads : k_nMaxBatchQuads;
+        const size_t nOffset = Stream(rgVertices, nBatch * 4 * sizeof(TexturedVertex));
+
+        s_gl.VertexAttribPointer(VA_POSITION, 2, GL_FLOAT, GL_FALSE, sizeof(TexturedVertex),
+                                 reinterpret_cast<const void*>(nOffset + offsetof(TexturedVertex, fX)));
+        s_gl.VertexAttribPointer(VA_COLOR,    4, GL_FLOAT, GL_FALSE, sizeof(TexturedVertex),
+                                 reinterpret_cast<const void*>(nOffset + offsetof(TexturedVertex, clr)));
+        s_gl.VertexAttribPointer(VA_TEXCOORD, 2, GL_FLOAT, GL_FALSE, sizeof(TexturedVertex),
+                                 reinterpret_cast<const void*>(nOffset + offsetof(TexturedVertex, fU)));
+
+        glDrawElements( GL_TRIANGLES, static_cast<GLsizei>(nBatch * 6), GL_UNSIGNED_SHORT, nullptr );
+
+        rgVertices += nBatch * 4;
+        nQuads     -= nBatch;
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+size_t CCoreProfileBackend::RegisterShape( const CVector2f* rgVertices, size_t nVertices )
+{
+    m_rgShapes.push_back(ShapeRange{ static_cast<int>(m_rgShapeVertices.size()), static_cast<int>(nVertices) }); // note - may throw an exception
+    m_rgShapeVertices.insert(m_rgShapeVertices.end(), rgVertices, rgVertices + nVertices);
+
+    // uploaded with the next draw, so shapes may be registered at any time
+    m_bShapesDirty = true;
+    return m_rgShapes.size() - 1;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CCoreProfileBackend::DrawShapeInstances( size_t nShape, const ShapeInstance* rgInstances, size_t nInstances ) noexcept
+{
+    const size_t nBytes = nInstances * sizeof(ShapeInstance);
+    if (!m_bInitialized || nShape >= m_rgShapes.size() || rgInstances == nullptr || nInstances == 0 ||
+        nBytes > k_nStreamBufferSize)
+        return;
+
+    if (m_bShapesDirty)
+    {
+        s_gl.BindBuffer(GL_ARRAY_BUFFER_, m_nShapeBuffer);
+        s_gl.BufferData(GL_ARRAY_BUFFER_, m_rgShapeVertices.size() * sizeof(CVector2f),
+                        m_rgShapeVertices.data(), GL_STATIC_DRAW_);
+        m_bShapesDirty = false;
+    }
+
+    s_gl.UseProgram(m_nInstanceProgram);
+    UploadTransform(m_iInstanceTransformLoc, get_Top());
+    ResetAttributes();
+
+    const size_t nOffset = Stream(rgInstances, nBytes);
+
+    s_gl.EnableVertexAttribArray(VA_PLACEMENT);
+    s_gl.EnableVertexAttribArray(VA_INSTANCE_COLOR);
+    s_gl.VertexAttribPointer    (VA_PLACEMENT,      4, GL_FLOAT, GL_FALSE, sizeof(ShapeInstance),
+                                 reinterpret_cast<const void*>(nOffset + offsetof(ShapeInstance, fX)));
+    s_gl.VertexAttribPointer    (VA_INSTANCE_COLOR, 4, GL_FLOAT, GL_FALSE, sizeof(ShapeInstance),
+                                 reinterpret_cast<const void*>(nOffset + offsetof(ShapeInstance, clr)));
+
+    s_gl.BindBuffer             (GL_ARRAY_BUFFER_, m_nShapeBuffer);
+    s_gl.EnableVertexAttribArray(VA_POSITION);
+    s_gl.VertexAttribPointer    (VA_POSITION, 2, GL_FLOAT, GL_FALSE, sizeof(CVector2f), nullptr);
+
+    const ShapeRange& range = m_rgShapes[nShape];
+    s_gl.DrawArraysInstanced(GL_LINE_LOOP, range.iFirst, range.iCount, static_cast<GLsizei>(nInstances));
+};
+
+//-----------------------------------------------------------------------------------------------
+void CCoreProfileBackend::ReadPixels( int iWidth, int iHeight, void* pDest ) noexcept
+{
+    if (pDest == nullptr || iWidth <= 0 || iHeight <= 0)
+        return;
+
+    glReadBuffer ( GL_BACK );
+    glPixelStorei( GL_PACK_ALIGNMENT, 1 );
+    glReadPixels ( 0, 0, iWidth, iHeight, GL_RGBA, GL_UNSIGNED_BYTE, pDest );
+};
+
+} // namespace rdr
+} // namespace eng
@@ -0,0 +1,154 @@
+/**
+ *  @file       CoreProfileBackend.h
+ *  @brief      CCoreProfileBackend class interface
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ *  <b>Implementation:</b>
+ *
+ *   OpenGL 3.3 core profile rendering path.  Nothing is drawn from client
+ *   memory: per-draw geometry is appended to one long-lived streaming vertex
+ *   buffer (written through unsynchronized glMapBufferRange, orphaned when
+ *   it wraps), registered shapes live in a static buffer, and quads become
+ *   indexed triangles through a shared static index buffer.  The view
+ *   transform is kept as a CPU-side 2D affine matrix stack and uploaded as a
+ *   uniform.
+ *
+ *   DrawShapeInstances() draws every instance of a shape with one
+ *   glDrawArraysInstanced() call; position, scale, rotation and color are
+ *   per-instance vertex attributes.
+ *
+ *   The context is created without the forward-compatible flag so wide
+ *   lines (glLineWidth > 1) keep working.  Mesa's llvmpipe exposes a 3.3
+ *   core profile, so this path can be exercised on Windows machines
+ *   without a GPU by placing Mesa's opengl32.dll next to the executable.
+ *
+ *   Grey and grey-alpha images are uploaded by CTexture as GL_RED / GL_RG
+ *   with a swizzle, as GL_LUMINANCE(_ALPHA) do not exist in this profile.
+ */
+#pragma once
+
+#if !defined(__CORE_PROFILE_BACKEND_H__)
+#define __CORE_PROFILE_BACKEND_H__
+
+#ifndef _WINDOWS_
+    #include <Windows.h>
+#endif
+
+#ifndef _VECTOR_
+    #include <vector>
+#endif
+
+#ifndef __RENDER_BACKEND_H__
+    #include "Engine/Renderer/RenderBackend.h"
+#endif
+
+namespace eng
+{
+namespace rdr
+{
+
+/**
+ *  @brief 2D affine transform, column major:
+ *         x' = (a * x) + (c * y) + tx,  y' = (b * x) + (d * y) + ty
+ */
+struct Affine2
+{
+    float a, b, c, d, tx, ty;
+};
+
+class CCoreProfileBackend
+    : public IRenderBackend
+{
+    struct ShapeRange
+    {
+        int iFirst;
+        int iCount;
+    };
+
+    unsigned int             m_nColorProgram;      ///< per-vertex or constant color, optional texture
+    unsigned int             m_nInstanceProgram;   ///< instanced shapes
+    int                      m_iColorTransformLoc;
+    int                      m_iColorTexturedLoc;
+    int                      m_iInstanceTransformLoc;
+
+    unsigned int             m_nVertexArray;
+    unsigned int             m_nStreamBuffer;
+    size_t                   m_nStreamOffset;
+    unsigned int             m_nQuadIndexBuffer;
+    unsigned int             m_nShapeBuffer;
+    bool                     m_bShapesDirty;
+
+    std::vector<math::CVector2f> m_rgShapeVertices;
+    std::vector<ShapeRange>      m_rgShapes;
+    std::vector<Affine2>         m_rgMatrixStack;   ///< back() is the current transform
+
+    ColorRGBA                m_clrCurrent;
+    bool                     m_bInitialized;
+
+public:
+    /// Default Constructor
+    CCoreProfileBackend() noexcept;
+    /// Default Destructor
+    ~CCoreProfileBackend() = default;
+
+// IRenderBackend
+    bool        Initialize          ( void ) noexcept override;
+    void        Shutdown            ( void ) noexcept override;
+    const char* get_Name            ( void ) const noexcept override;
+
+    void        Clear               ( void ) noexcept override;
+    void        SetClearColor       ( const ColorRGBA& clr ) noexcept override;
+    void        SetViewPort         ( int iX, int iY, int iWidth, int iHeight ) noexcept override;
+    void        SetOrtho            ( const math::CVector2f& vBottomLeft, const math::CVector2f& vTopRight ) noexcept override;
+    void        SetLineWidth        ( float fLineWidth ) noexcept override;
+    void        SetPointSize        ( float fPointSize ) noexcept override;
+    void        SetColor            ( const ColorRGBA& clr ) noexcept override;
+
+    void        Translate           ( const math::CVector2f& vTranslate ) noexcept override;
+    void        Rotate              ( float fDegrees ) noexcept override;
+    void        Scale               ( float fUniformScale ) noexcept override;
+    void        PushMatrix          ( void ) noexcept override;
+    void        PopMatrix           ( void ) noexcept override;
+
+    void        DrawVertices        ( PRIMITIVE_TYPE ePrim, const math::CVector2f* rgVertices, size_t nVertices ) noexcept override;
+    void        DrawColoredVertices ( PRIMITIVE_TYPE ePrim, const ColoredVertex* rgVertices, size_t nVertices ) noexcept override;
+    void        DrawTexturedQuads   ( unsigned int nTextureID, const TexturedVertex* rgVertices, size_t nVertices ) noexcept override;
+
+    size_t      RegisterShape       ( const math::CVector2f* rgVertices, size_t nVertices ) override;
+    void        DrawShapeInstances  ( size_t nShape, const ShapeInstance* rgInstances, size_t nInstances ) noexcept override;
+
+    void        ReadPixels          ( int iWidth, int iHeight, void* pDest ) noexcept override;
+
+private:
+    size_t      Stream              ( const void* pData, size_t nBytes ) noexcept;
+    void        UseColorProgram     ( bool bTextured ) noexcept;
+    void        ResetAttributes     ( void ) noexcept;
+
+    inline Affine2& get_Top         ( void ) noexcept
+    { return m_rgMatrixStack.back(); };
+
+    /// Copy constructor
+    CCoreProfileBackend(const CCoreProfileBackend&) = delete;
+    /// Assignment operator
+    CCoreProfileBackend& operator=(const CCoreProfileBackend&) = delete;
+};
+
+/**
+ *  @brief replaces a legacy context with an OpenGL 3.3 core profile context
+ *
+ *  @param [in] hdc             device context with a pixel format already set
+ *  @param [in] hglrcLegacy     current legacy context, used to look up
+ *                              wglCreateContextAttribsARB
+ *
+ *  @retval HGLRC       the new context, made current
+ *  @retval nullptr     if the driver cannot create one; the legacy context
+ *                      remains current
+ */
+HGLRC CreateCoreProfileContext( HDC hdc, HGLRC hglrcLegacy ) noexcept;
+
+} // namespace rdr
+} // namespace eng
+
+#endif
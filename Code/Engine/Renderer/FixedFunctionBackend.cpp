@@ -0,0 +1,257 @@
+/**
+ *  @file       FixedFunctionBackend.cpp
+ *  @brief      CFixedFunctionBackend class implementation
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ */
+
+#define WIN32_LEAN_AND_MEAN
+#include "targetver.h"  // this needs to be the 1st header included
+
+#include <Windows.h>
+#include <gl/gl.h>
+
+#include "FixedFunctionBackend.h"
+
+#pragma comment( lib, "opengl32" ) // Link in the OpenGL32.lib static library
+
+namespace eng
+{
+namespace rdr
+{
+
+using  namespace eng::math;
+
+constexpr float g_fDefaultLineWidth = 2.f;
+
+//-----------------------------------------------------------------------------------------------
+static GLenum ToGLPrimitive( PRIMITIVE_TYPE ePrim ) noexcept
+{
+    switch (ePrim)
+    {
+    case PRIM_POINTS:       return GL_POINTS;
+    case PRIM_LINES:        return GL_LINES;
+    case PRIM_LINE_LOOP:    return GL_LINE_LOOP;
+    case PRIM_TRIANGLE_FAN: return GL_TRIANGLE_FAN;
+    }
+    return GL_POINTS;
+};
+
+//-----------------------------------------------------------------------------------------------
+CFixedFunctionBackend::CFixedFunctionBackend() noexcept
+    : m_rgShapes()
+{
+};
+
+//-----------------------------------------------------------------------------------------------
+bool CFixedFunctionBackend::Initialize(void) noexcept
+{
+    glEnable( GL_BLEND );
+    glBlendFunc( GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA );
+    glLineWidth( g_fDefaultLineWidth );
+    glEnable( GL_LINE_SMOOTH );
+
+    return true;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CFixedFunctionBackend::Shutdown(void) noexcept
+{
+};
+
+//-----------------------------------------------------------------------------------------------
+const char* CFixedFunctionBackend::get_Name(void) const noexcept
+{
+    return "OpenGL 1.1 fixed function";
+};
+
+//-----------------------------------------------------------------------------------------------
+void CFixedFunctionBackend::Clear(void) noexcept
+{
+    glClear( GL_COLOR_BUFFER_BIT );
+};
+
+//-----------------------------------------------------------------------------------------------
+void CFixedFunctionBackend::SetClearColor( const ColorRGBA& clr ) noexcept
+{
+    glClearColor( clr.fRed, clr.fGreen, clr.fBlue, clr.fAlpha );
+};
+
+//-----------------------------------------------------------------------------------------------
+void CFixedFunctionBackend::SetViewPort( int iX, int iY, int iWidth, int iHeight ) noexcept
+{
+    glViewport(iX, iY, iWidth, iHeight);
+};
+
+//-----------------------------------------------------------------------------------------------
+void CFixedFunctionBackend::SetOrtho( const CVector2f& vBottomLeft, const CVector2f& vTopRight ) noexcept
+{
+    glLoadIdentity();
+    glOrtho(vBottomLeft.X, vTopRight.X, vBottomLeft.Y, vTopRight.Y, 0.f, 1.f);
+};
+
+//-----------------------------------------------------------------------------------------------
+void CFixedFunctionBackend::SetLineWidth( float fLineWidth ) noexcept
+{
+    glLineWidth( fLineWidth );
+};
+
+//-----------------------------------------------------------------------------------------------
+void CFixedFunctionBackend::SetPointSize( float fPointSize ) noexcept
+{
+    glPointSize( fPointSize );
+};
+
+//-----------------------------------------------------------------------------------------------
+void CFixedFunctionBackend::SetColor( const ColorRGBA& clr ) noexcept
+{
+    glColor4f( clr.fRed, clr.fGreen, clr.fBlue, clr.fAlpha );
+};
+
+//-----------------------------------------------------------------------------------------------
+void CFixedFunctionBackend::Translate( const CVector2f& vTranslate ) noexcept
+{
+    glTranslatef( vTranslate.X, vTranslate.Y, 0.f );
+};
+
+//-----------------------------------------------------------------------------------------------
+void CFixedFunctionBackend::Rotate( float fDegrees ) noexcept
+{
+    glRotatef( fDegrees, 0.f, 0.f, 1.f );
+};
+
+//-----------------------------------------------------------------------------------------------
+void CFixedFunctionBackend::Scale( float fUniformScale ) noexcept
+{
+    glScalef( fUniformScale, fUniformScale, 1.f );
+};
+
+//-----------------------------------------------------------------------------------------------
+void CFixedFunctionBackend::PushMatrix(void) noexcept
+{
+    glPushMatrix();
+};
+
+//-----------------------------------------------------------------------------------------------
+void CFixedFunctionBackend::PopMatrix(void) noexcept
+{
+    glPopMatrix();
+};
+
+//-----------------------------------------------------------------------------------------------
+void CFixedFunctionBackend::DrawVertices( PRIMITIVE_TYPE ePrim, const CVector2f* rgVertices, size_t nVertices ) noexcept
+{
+    if (rgVertices == nullptr || nVertices == 0)
+        return;
+
+    glDisable( GL_TEXTURE_2D ); // need to disable texturing before drawing non-textured objects
+
+    glEnableClientState ( GL_VERTEX_ARRAY );
+    glVertexPointer     ( 2, GL_FLOAT, sizeof(CVector2f), &rgVertices[0].X );
+    glDrawArrays        ( ToGLPrimitive(ePrim), 0, static_cast<GLsizei>(nVertices) );
+    glDisableClientState( GL_VERTEX_ARRAY );
+};
+
+//-----------------------------------------------------------------------------------------------
+void CFixedFunctionBackend::DrawColoredVertices( PRIMITIVE_TYPE ePrim, const ColoredVertex* rgVertices, size_t nVertices ) noexcept
+{
+    if (rgVertices == nullptr || nVertices == 0)
+        return;
+
+    glDisable( GL_TEXTURE_2D );
+
+    glEnableClientState( GL_VERTEX_ARRAY );
+    glEnableClientState( GL_COLOR_ARRAY );
+
+    glVertexPointer( 2, GL_FLOAT, sizeof(ColoredVertex), &rgVertices[0].fX );
+    glColorPointer ( 4, GL_FLOAT, sizeof(ColoredVertex), &rgVertices[0].clr );
+
+    glDrawArrays( ToGLPrimitive(ePrim), 0, static_cast<GLsizei>(nVertices) );
+
+    glDisableClientState( GL_COLOR_ARRAY );
+    glDisableClientState( GL_VERTEX_ARRAY );
+};
+
+//-----------------------------------------------------------------------------------------------
+void CFixedFunctionBackend::DrawTexturedQuads( unsigned int nTextureID, const TexturedVertex* rgVertices, size_t nVertices ) noexcept
+{
+    if (rgVertices == nullptr || nVertices < 4)
+        return;
+
+    glEnable     ( GL_TEXTURE_2D );
+    glBindTexture( GL_TEXTURE_2D, nTextureID );
+
+    glEnableClientState( GL_VERTEX_ARRAY );
+    glEnableClientState( GL_TEXTURE_COORD_ARRAY );
+    glEnableClientState( GL_COLOR_ARRAY );
+
+    glVertexPointer  ( 2, GL_FLOAT, sizeof(TexturedVertex), &rgVertices[0].fX );
+    glTexCoordPointer( 2, GL_FLOAT, sizeof(TexturedVertex), &rgVertices[0].fU );
+    glColorPointer   ( 4, GL_FLOAT, sizeof(TexturedVertex), &rgVertices[0].clr );
+
+    glDrawArrays( GL_QUADS, 0, static_cast<GLsizei>(nVertices - (nVertices % 4)) );
+
+    glDisableClientState( GL_COLOR_ARRAY );
+    glDisableClientState( GL_TEXTURE_COORD_ARRAY );
+    glDisableClientState( GL_VERTEX_ARRAY );
+
+    glDisable( GL_TEXTURE_2D );
+};
+
+//-----------------------------------------------------------------------------------------------
+size_t CFixedFunctionBackend::RegisterShape( const CVector2f* rgVertices, size_t nVertices )
+{
+    m_rgShapes.emplace_back(rgVertices, rgVertices + nVertices); // note - may throw an exception
+    return m_rgShapes.size() - 1;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CFixedFunctionBackend::DrawShapeInstances( size_t nShape, const ShapeInstance* rgInstances, size_t nInstances ) noexcept
+{
+    if (nShape >= m_rgShapes.size() || rgInstances == nullptr || nInstances == 0)
+        return;
+
+    const auto& rgShape = m_rgShapes[nShape];
+    if (rgShape.empty())
+        return;
+
+    glDisable( GL_TEXTURE_2D );
+
+    // no instancing in GL 1.1: one transform + draw per instance, sharing the vertex pointer
+    glEnableClientState( GL_VERTEX_ARRAY );
+    glVertexPointer    ( 2, GL_FLOAT, sizeof(CVector2f), &rgShape[0].X );
+
+    for (size_t i = 0; i < nInstances; i++)
+    {
+        const ShapeInstance& inst = rgInstances[i];
+
+        glPushMatrix();
+        glTranslatef( inst.fX, inst.fY, 0.f );
+        glRotatef   ( inst.fDegOrientation, 0.f, 0.f, 1.f );
+        glScalef    ( inst.fScale, inst.fScale, 1.f );
+        glColor4f   ( inst.clr.fRed, inst.clr.fGreen, inst.clr.fBlue, inst.clr.fAlpha );
+
+        glDrawArrays( GL_LINE_LOOP, 0, static_cast<GLsizei>(rgShape.size()) );
+
+        glPopMatrix();
+    }
+
+    glDisableClientState( GL_VERTEX_ARRAY );
+};
+
+//-----------------------------------------------------------------------------------------------
+void CFixedFunctionBackend::ReadPixels( int iWidth, int iHeight, void* pDest ) noexcept
+{
+    if (pDest == nullptr || iWidth <= 0 || iHeight <= 0)
+        return;
+
+    // read the frame just rendered, before it is swapped away
+    glReadBuffer ( GL_BACK );
+    glPixelStorei( GL_PACK_ALIGNMENT, 1 );
+    glReadPixels ( 0, 0, iWidth, iHeight, GL_RGBA, GL_UNSIGNED_BYTE, pDest );
+};
+
+} // namespace rdr
+} // namespace eng
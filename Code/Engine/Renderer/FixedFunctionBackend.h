@@ -0,0 +1,80 @@
+/**
+ *  @file       FixedFunctionBackend.h
+ *  @brief      CFixedFunctionBackend class interface
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ *  <b>Implementation:</b>
+ *
+ *   The original OpenGL 1.1 rendering path: the GL matrix stack carries the
+ *   view transform and geometry is submitted from client-side vertex arrays.
+ */
+#pragma once
+
+#if !defined(__FIXED_FUNCTION_BACKEND_H__)
+#define __FIXED_FUNCTION_BACKEND_H__
+
+#ifndef _VECTOR_
+    #include <vector>
+#endif
+
+#ifndef __RENDER_BACKEND_H__
+    #include "Engine/Renderer/RenderBackend.h"
+#endif
+
+namespace eng
+{
+namespace rdr
+{
+
+class CFixedFunctionBackend
+    : public IRenderBackend
+{
+    std::vector< std::vector<math::CVector2f> > m_rgShapes;
+
+public:
+    /// Default Constructor
+    CFixedFunctionBackend() noexcept;
+    /// Default Destructor
+    ~CFixedFunctionBackend() = default;
+
+// IRenderBackend
+    bool        Initialize          ( void ) noexcept override;
+    void        Shutdown            ( void ) noexcept override;
+    const char* get_Name            ( void ) const noexcept override;
+
+    void        Clear               ( void ) noexcept override;
+    void        SetClearColor       ( const ColorRGBA& clr ) noexcept override;
+    void        SetViewPort         ( int iX, int iY, int iWidth, int iHeight ) noexcept override;
+    void        SetOrtho            ( const math::CVector2f& vBottomLeft, const math::CVector2f& vTopRight ) noexcept override;
+    void        SetLineWidth        ( float fLineWidth ) noexcept override;
+    void        SetPointSize        ( float fPointSize ) noexcept override;
+    void        SetColor            ( const ColorRGBA& clr ) noexcept override;
+
+    void        Translate           ( const math::CVector2f& vTranslate ) noexcept override;
+    void        Rotate              ( float fDegrees ) noexcept override;
+    void        Scale               ( float fUniformScale ) noexcept override;
+    void        PushMatrix          ( void ) noexcept override;
+    void        PopMatrix           ( void ) noexcept override;
+
+    void        DrawVertices        ( PRIMITIVE_TYPE ePrim, const math::CVector2f* rgVertices, size_t nVertices ) noexcept override;
+    void        DrawColoredVertices ( PRIMITIVE_TYPE ePrim, const ColoredVertex* rgVertices, size_t nVertices ) noexcept override;
+    void        DrawTexturedQuads   ( unsigned int nTextureID, const TexturedVertex* rgVertices, size_t nVertices ) noexcept override;
+
+    size_t      RegisterShape       ( const math::CVector2f* rgVertices, size_t nVertices ) override;
+    void        DrawShapeInstances  ( size_t nShape, const ShapeInstance* rgInstances, size_t nInstances ) noexcept override;
+
+    void        ReadPixels          ( int iWidth, int iHeight, void* pDest ) noexcept override;
+
+private:
+    /// Copy constructor
+    CFixedFunctionBackend(const CFixedFunctionBackend&) = delete;
+    /// Assignment operator
+    CFixedFunctionBackend& operator=(const CFixedFunctionBackend&) = delete;
+};
+
+} // namespace rdr
+} // namespace eng
+
+#endif
@@ -0,0 +1,105 @@
+/**
+ *  @file       FrameBufferPool.cpp
+ *  @brief      CFrameBufferPool class implementation
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ */
+
+#include "targetver.h"  // this needs to be the 1st header included
+
+#include "FrameBufferPool.h"
+
+namespace eng
+{
+namespace rdr
+{
+
+//-----------------------------------------------------------------------------------------------
+CFrameBufferPool::CFrameBufferPool(size_t nBuffers)
+    : m_mtxFree(),
+      m_cvFree(),
+      m_rgFree(),
+      m_rgBuffers()
+{
+    m_rgBuffers.reserve(nBuffers);
+    m_rgFree.reserve(nBuffers);
+
+    for (size_t i = 0; i < nBuffers; i++)
+    {
+        m_rgBuffers.emplace_back(new FrameBuffer{ {}, 0, 0, 0 }); // note - may throw an exception
+        m_rgFree.push_back(m_rgBuffers.back().get());
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+FrameBuffer* CFrameBufferPool::Acquire(int iWidth, int iHeight) noexcept
+{
+    FrameBuffer* pBuffer = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(m_mtxFree);
+        if (!m_rgFree.empty())
+        {
+            pBuffer = m_rgFree.back();
+            m_rgFree.pop_back();
+        }
+    }
+
+    return Prepare(pBuffer, iWidth, iHeight);
+};
+
+//-----------------------------------------------------------------------------------------------
+FrameBuffer* CFrameBufferPool::AcquireWait(int iWidth, int iHeight) noexcept
+{
+    FrameBuffer* pBuffer = nullptr;
+    {
+        std::unique_lock<std::mutex> lock(m_mtxFree);
+        m_cvFree.wait(lock, [this] { return !m_rgFree.empty(); });
+
+        pBuffer = m_rgFree.back();
+        m_rgFree.pop_back();
+    }
+
+    return Prepare(pBuffer, iWidth, iHeight);
+};
+
+//-----------------------------------------------------------------------------------------------
+FrameBuffer* CFrameBufferPool::Prepare(FrameBuffer* pBuffer, int iWidth, int iHeight) noexcept
+{
+    if (pBuffer)
+    {
+        const size_t nBytes = static_cast<size_t>(iWidth) * iHeight * k_iFrameComponents;
+        try
+        {
+            if (pBuffer->rgPixels.size() < nBytes)
+                pBuffer->rgPixels.resize(nBytes);
+        }
+        catch (...)
+        {
+            Release(pBuffer);
+            return nullptr;
+        }
+
+        pBuffer->iWidth  = iWidth;
+        pBuffer->iHeight = iHeight;
+    }
+
+    return pBuffer;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CFrameBufferPool::Release(FrameBuffer* pBuffer) noexcept
+{
+    if (pBuffer)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mtxFree);
+            m_rgFree.push_back(pBuffer); // capacity reserved up front, cannot throw
+        }
+        m_cvFree.notify_one();
+    }
+};
+
+} // namespace rdr
+} // namespace eng
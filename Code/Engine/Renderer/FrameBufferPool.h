@@ -0,0 +1,107 @@
+/**
+ *  @file       FrameBufferPool.h
+ *  @brief      CFrameBufferPool class interface
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ *  <b>Implementation:</b>
+ *
+ *   A fixed set of RGBA frame buffers shared between the render thread (which
+ *   fills them) and a background consumer (which encodes and releases them).
+ *   Acquire() never blocks or allocates; when every buffer is in flight it
+ *   returns nullptr and the caller is expected to drop the frame.
+ *   AcquireWait() instead waits for the consumer to release one.
+ */
+#pragma once
+
+#if !defined(__FRAME_BUFFER_POOL_H__)
+#define __FRAME_BUFFER_POOL_H__
+
+#ifndef _CONDITION_VARIABLE_
+    #include <condition_variable>
+#endif
+
+#ifndef _MUTEX_
+    #include <mutex>
+#endif
+
+#ifndef _VECTOR_
+    #include <vector>
+#endif
+
+#ifndef _MEMORY_
+    #include <memory>
+#endif
+
+namespace eng
+{
+namespace rdr
+{
+
+constexpr int k_iFrameComponents = 4; ///< frames are always stored as RGBA8
+
+struct FrameBuffer
+{
+    std::vector<unsigned char> rgPixels;      ///< bottom-up rows, as read back from OpenGL
+    int                        iWidth;
+    int                        iHeight;
+    unsigned long long         nFrameNumber;
+
+    inline size_t get_RowBytes(void) const noexcept
+    { return static_cast<size_t>(iWidth) * k_iFrameComponents; };
+};
+
+class CFrameBufferPool
+{
+    std::mutex                                 m_mtxFree;
+    std::condition_variable                    m_cvFree;
+    std::vector<FrameBuffer*>                  m_rgFree;
+    std::vector< std::unique_ptr<FrameBuffer> > m_rgBuffers;
+
+public:
+    /// Conversion Constructor
+    explicit CFrameBufferPool(size_t nBuffers);
+    /// Default Destructor
+    ~CFrameBufferPool() = default;
+
+/**
+ *  @brief takes a free buffer sized for a iWidth x iHeight frame
+ *
+ *  @retval FrameBuffer*   on success
+ *  @retval nullptr        if every buffer is in use
+ *
+ *  @note  a buffer only reallocates when the requested frame is larger than
+ *         any frame it has previously held
+ */
+    FrameBuffer*  Acquire   (int iWidth, int iHeight) noexcept;
+
+/**
+ *  @brief as Acquire(), but waits for a buffer to be released when every
+ *         buffer is in use
+ *
+ *  @retval nullptr        only if the buffer could not be resized
+ */
+    FrameBuffer*  AcquireWait (int iWidth, int iHeight) noexcept;
+
+/**
+ *  @brief returns a buffer obtained from Acquire() to the pool
+ */
+    void          Release   (FrameBuffer* pBuffer) noexcept;
+
+    inline size_t get_Capacity (void) const noexcept
+    { return m_rgBuffers.size(); };
+
+private:
+    FrameBuffer*  Prepare   (FrameBuffer* pBuffer, int iWidth, int iHeight) noexcept;
+
+    /// Copy constructor
+    CFrameBufferPool(const CFrameBufferPool&) = delete;
+    /// Assignment operator
+    CFrameBufferPool& operator=(const CFrameBufferPool&) = delete;
+};
+
+} // namespace rdr
+} // namespace eng
+
+#endif
@@ -0,0 +1,209 @@
+/**
+ *  @file       FrameCapture.cpp
+ *  @brief      CFrameCapture class implementation
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ */
+
+#include "targetver.h"  // this needs to be the 1st header included
+
+#include <stdio.h>
+#include <cstring>
+
+#include "stb_image_write.h"
+
+#include "Renderer.h"
+#include "FrameCapture.h"
+
+namespace eng
+{
+namespace rdr
+{
+
+//-----------------------------------------------------------------------------------------------
+CFrameCapture::CFrameCapture(const char* szFilePrefix, size_t nPoolSize /* = 4 */)
+    : m_Pool(nPoolSize),
+      m_strFilePrefix(szFilePrefix ? szFilePrefix : "frame"),
+      m_thWriter(),
+      m_mtxQueue(),
+      m_cvQueue(),
+      m_qPending(),
+      m_bShutdown(false),
+      m_nInterval(0),
+      m_nBurstRemaining(0),
+      m_nFrameNumber(0),
+      m_nWritten(0),
+      m_nDropped(0),
+      m_nFailed(0)
+{
+};
+
+//-----------------------------------------------------------------------------------------------
+CFrameCapture::~CFrameCapture()
+{
+    Stop();
+};
+
+//-----------------------------------------------------------------------------------------------
+bool CFrameCapture::Start(void)
+{
+    if (!m_thWriter.joinable())
+    {
+        m_bShutdown = false;
+        m_thWriter  = std::thread(&CFrameCapture::WriterProc, this); // note - may throw an exception
+    }
+    return m_thWriter.joinable();
+};
+
+//-----------------------------------------------------------------------------------------------
+void CFrameCapture::Stop(void) noexcept
+{
+    if (m_thWriter.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mtxQueue);
+            m_bShutdown = true;
+        }
+        m_cvQueue.notify_one();
+        m_thWriter.join();
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+bool CFrameCapture::IsFrameDue(void) noexcept
+{
+    bool bDue = false;
+
+    if (m_nBurstRemaining)
+    {
+        m_nBurstRemaining--;
+        bDue = true;
+    }
+    else if (m_nInterval && (m_nFrameNumber % m_nInterval) == 0)
+    {
+        bDue = true;
+    }
+
+    return bDue;
+};
+
+//-----------------------------------------------------------------------------------------------
+bool CFrameCapture::OnFrameEnd(int iWidth, int iHeight) noexcept
+{
+    bool bReturn = false;
+
+    m_nFrameNumber++;
+
+    if (m_thWriter.joinable() && iWidth > 0 && iHeight > 0 && IsFrameDue())
+    {
+        FrameBuffer* pBuffer = m_Pool.Acquire(iWidth, iHeight);
+        if (pBuffer)
+        {
+            g_theRdr.ReadPixels( iWidth, iHeight, pBuffer->rgPixels.data() );
+
+            pBuffer->nFrameNumber = m_nFrameNumber;
+            Enqueue(pBuffer);
+            bReturn = true;
+        }
+        else
+        {
+            // writer is behind; drop the frame rather than wait on it
+            m_nDropped.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    return bReturn;
+};
+
+//-----------------------------------------------------------------------------------------------
+bool CFrameCapture::SubmitFrame(const unsigned char* pPixels, int iWidth, int iHeight, size_t nStride) noexcept
+{
+    bool bReturn = false;
+
+    m_nFrameNumber++;
+
+    if (m_thWriter.joinable() && pPixels && iWidth > 0 && iHeight > 0 && IsFrameDue())
+    {
+        FrameBuffer* pBuffer = m_Pool.Acquire(iWidth, iHeight);
+        if (pBuffer)
+        {
+            // store bottom-up to match the layout glReadPixels produces
+            const size_t nRowBytes = pBuffer->get_RowBytes();
+            for (int iRow = 0; iRow < iHeight; iRow++)
+            {
+                memcpy(&pBuffer->rgPixels[(iHeight - 1 - iRow) * nRowBytes],
+                       pPixels + iRow * nStride, nRowBytes);
+            }
+
+            pBuffer->nFrameNumber = m_nFrameNumber;
+            Enqueue(pBuffer);
+            bReturn = true;
+        }
+        else
+        {
+            m_nDropped.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    return bReturn;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CFrameCapture::Enqueue(FrameBuffer* pBuffer) noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mtxQueue);
+        try
+        {
+            m_qPending.push_back(pBuffer);
+        }
+        catch (...)
+        {
+            m_Pool.Release(pBuffer);
+            m_nDropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    }
+    m_cvQueue.notify_one();
+};
+
+//-----------------------------------------------------------------------------------------------
+void CFrameCapture::WriterProc(void) noexcept
+{
+    char szFileName[512] = { 0 };
+
+    for (;;)
+    {
+        FrameBuffer* pBuffer = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(m_mtxQueue);
+            m_cvQueue.wait(lock, [this] { return m_bShutdown || !m_qPending.empty(); });
+
+            // drain whatever is still queued before honoring a shutdown
+            if (m_qPending.empty())
+                break;
+
+            pBuffer = m_qPending.front();
+            m_qPending.pop_front();
+        }
+
+        snprintf(szFileName, sizeof(szFileName) - 1, "%s_%06llu.png",
+                 m_strFilePrefix.c_str(), pBuffer->nFrameNumber);
+
+        // rows are bottom-up; start at the last row and walk backwards
+        const int iStride = static_cast<int>(pBuffer->get_RowBytes());
+        const unsigned char* pTopRow = pBuffer->rgPixels.data() + (pBuffer->iHeight - 1) * iStride;
+
+        if (stbi_write_png(szFileName, pBuffer->iWidth, pBuffer->iHeight, k_iFrameComponents, pTopRow, -iStride))
+            m_nWritten.fetch_add(1, std::memory_order_relaxed);
+        else
+            m_nFailed.fetch_add(1, std::memory_order_relaxed);
+
+        m_Pool.Release(pBuffer);
+    }
+};
+
+} // namespace rdr
+} // namespace eng
@@ -0,0 +1,130 @@
+/**
+ *  @file       FrameCapture.h
+ *  @brief      CFrameCapture class interface
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ *  <b>Implementation:</b>
+ *
+ *   The render thread reads the back buffer into a pooled frame buffer and
+ *   queues it; a background writer thread encodes queued frames to PNG using
+ *   stb_image_write.  If the writer falls behind and the pool runs dry, frames
+ *   are dropped (and counted) rather than stalling the frame loop.
+ *
+ *   Capture is either periodic (every Nth frame, see set_Interval()) or a burst
+ *   of consecutive frames (see TriggerBurst()).
+ */
+#pragma once
+
+#if !defined(__FRAME_CAPTURE_H__)
+#define __FRAME_CAPTURE_H__
+
+#ifndef _ATOMIC_
+    #include <atomic>
+#endif
+
+#ifndef _CONDITION_VARIABLE_
+    #include <condition_variable>
+#endif
+
+#ifndef _DEQUE_
+    #include <deque>
+#endif
+
+#ifndef _STRING_
+    #include <string>
+#endif
+
+#ifndef _THREAD_
+    #include <thread>
+#endif
+
+#ifndef __FRAME_BUFFER_POOL_H__
+    #include "Engine/Renderer/FrameBufferPool.h"
+#endif
+
+namespace eng
+{
+namespace rdr
+{
+
+class CFrameCapture
+{
+    CFrameBufferPool            m_Pool;
+    std::string                 m_strFilePrefix;   ///< output directory + file name prefix
+    std::thread                 m_thWriter;
+    std::mutex                  m_mtxQueue;
+    std::condition_variable     m_cvQueue;
+    std::deque<FrameBuffer*>    m_qPending;
+    bool                        m_bShutdown;
+
+    unsigned int                m_nInterval;       ///< capture every Nth frame, 0 = off
+    size_t                      m_nBurstRemaining; ///< frames left in the current burst
+    unsigned long long          m_nFrameNumber;
+
+    std::atomic<size_t>         m_nWritten;
+    std::atomic<size_t>         m_nDropped;
+    std::atomic<size_t>         m_nFailed;
+
+public:
+/**
+ *  @param [in] szFilePrefix    path prefix of the written files, frames are
+ *                              written as <prefix>_000123.png
+ *  @param [in] nPoolSize       number of frames that may be in flight
+ */
+    explicit CFrameCapture(const char* szFilePrefix, size_t nPoolSize = 4);
+    /// Default Destructor, flushes pending frames
+    ~CFrameCapture() noexcept;
+
+    bool          Start         (void);
+    void          Stop          (void) noexcept;
+
+    inline void   set_Interval  (unsigned int nInterval) noexcept
+    { m_nInterval = nInterval; };
+
+    inline void   TriggerBurst  (size_t nFrames) noexcept
+    { m_nBurstRemaining = nFrames; };
+
+    constexpr bool IsBurstActive(void) const noexcept
+    { return m_nBurstRemaining != 0; };
+
+/**
+ *  @brief call once per frame, after rendering and before swapping buffers;
+ *         reads back the frame if it is due for capture
+ *
+ *  @retval true    if the frame was queued for writing
+ */
+    bool          OnFrameEnd    (int iWidth, int iHeight) noexcept;
+
+/**
+ *  @brief queues an RGBA frame from a source other than the GL back buffer
+ *
+ *  @param [in] pPixels      top-down RGBA8 rows
+ */
+    bool          SubmitFrame   (const unsigned char* pPixels, int iWidth, int iHeight, size_t nStride) noexcept;
+
+    inline size_t get_Written   (void) const noexcept
+    { return m_nWritten.load(std::memory_order_relaxed); };
+
+    inline size_t get_Dropped   (void) const noexcept
+    { return m_nDropped.load(std::memory_order_relaxed); };
+
+    inline size_t get_Failed    (void) const noexcept
+    { return m_nFailed.load(std::memory_order_relaxed); };
+
+private:
+    bool          IsFrameDue    (void) noexcept;
+    void          Enqueue       (FrameBuffer* pBuffer) noexcept;
+    void          WriterProc    (void) noexcept;
+
+    /// Copy constructor
+    CFrameCapture(const CFrameCapture&) = delete;
+    /// Assignment operator
+    CFrameCapture& operator=(const CFrameCapture&) = delete;
+};
+
+} // namespace rdr
+} // namespace eng
+
+#endif
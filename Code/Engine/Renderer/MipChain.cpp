@@ -0,0 +1,248 @@
+/**
+ *  @file       MipChain.cpp
+ *  @brief      CMipChain class implementation
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ */
+
+#include "targetver.h"  // this needs to be the 1st header included
+
+#include <algorithm>
+#include <emmintrin.h>
+
+#include "MipChain.h"
+
+namespace eng
+{
+namespace rdr
+{
+
+//-----------------------------------------------------------------------------------------------
+// widens the low or high 8 bytes of two rows to 16 bits and sums them vertically
+static inline __m128i SumRowsLo(__m128i v0, __m128i v1) noexcept
+{
+    const __m128i vZero = _mm_setzero_si128();
+    return _mm_add_epi16( _mm_unpacklo_epi8(v0, vZero), _mm_unpacklo_epi8(v1, vZero) );
+};
+
+static inline __m128i SumRowsHi(__m128i v0, __m128i v1) noexcept
+{
+    const __m128i vZero = _mm_setzero_si128();
+    return _mm_add_epi16( _mm_unpackhi_epi8(v0, vZero), _mm_unpackhi_epi8(v1, vZero) );
+};
+
+//-----------------------------------------------------------------------------------------------
+// rounds 8 four-sample sums back to bytes and stores them
+static inline void StoreAverage(unsigned char* pDst, __m128i vSum) noexcept
+{
+    const __m128i vAvg = _mm_srli_epi16( _mm_add_epi16(vSum, _mm_set1_epi16(2)), 2 );
+    _mm_storel_epi64( reinterpret_cast<__m128i*>(pDst), _mm_packus_epi16(vAvg, vAvg) );
+};
+
+//-----------------------------------------------------------------------------------------------
+// 4 source texels (16 bytes) per row -> 2 destination texels
+static inline int DownsampleRowRGBA(const unsigned char* pRow0, const unsigned char* pRow1,
+                                    unsigned char* pDst, int iDstWidth) noexcept
+{
+    int x = 0;
+    for (; x + 2 <= iDstWidth; x += 2)
+    {
+        const __m128i v0 = _mm_loadu_si128( reinterpret_cast<const __m128i*>(pRow0 + x * 8) );
+        const __m128i v1 = _mm_loadu_si128( reinterpret_cast<const __m128i*>(pRow1 + x * 8) );
+
+        const __m128i vLo = SumRowsLo(v0, v1);      // texels 0, 1
+        const __m128i vHi = SumRowsHi(v0, v1);      // texels 2, 3
+
+        StoreAverage( pDst + x * 4,
+                      _mm_unpacklo_epi64( _mm_add_epi16(vLo, _mm_srli_si128(vLo, 8)),
+                                          _mm_add_epi16(vHi, _mm_srli_si128(vHi, 8)) ) );
+    }
+    return x;
+};
+
+//-----------------------------------------------------------------------------------------------
+// 8 source texels (16 bytes) per row -> 4 destination texels
+static inline int DownsampleRowLA(const unsigned char* pRow0, const unsigned char* pRow1,
+                                  unsigned char* pDst, int iDstWidth) noexcept
+{
+    int x = 0;
+    for (; x + 4 <= iDstWidth; x += 4)
+    {
+        const __m128i v0 = _mm_loadu_si128( reinterpret_cast<const __m128i*>(pRow0 + x * 4) );
+        const __m128i v1 = _mm_loadu_si128( reinterpret_cast<const __m128i*>(pRow1 + x * 4) );
+
+        // reorder [t0 t1 t2 t3] to [t0 t2 t1 t3] so neighbours sit 64 bits apart
+        const __m128i vLo = _mm_shuffle_epi32( SumRowsLo(v0, v1), _MM_SHUFFLE(3, 1, 2, 0) );
+        const __m128i vHi = _mm_shuffle_epi32( SumRowsHi(v0, v1), _MM_SHUFFLE(3, 1, 2, 0) );
+
+        StoreAverage( pDst + x * 2,
+                      _mm_unpacklo_epi64( _mm_add_epi16(vLo, _mm_srli_si128(vLo, 8)),
+                                          _mm_add_epi16(vHi, _mm_srli_si128(vHi, 8)) ) );
+    }
+    return x;
+};
+
+//-----------------------------------------------------------------------------------------------
+// 16 source texels (16 bytes) per row -> 8 destination texels
+static inline int DownsampleRowL(const unsigned char* pRow0, const unsigned char* pRow1,
+                                 unsigned char* pDst, int iDstWidth) noexcept
+{
+    const __m128i vMask = _mm_set1_epi32(0xFFFF);
+
+    int x = 0;
+    for (; x + 8 <= iDstWidth; x += 8)
+    {
+        const __m128i v0 = _mm_loadu_si128( reinterpret_cast<const __m128i*>(pRow0 + x * 2) );
+        const __m128i v1 = _mm_loadu_si128( reinterpret_cast<const __m128i*>(pRow1 + x * 2) );
+
+        const __m128i vLo = SumRowsLo(v0, v1);
+        const __m128i vHi = SumRowsHi(v0, v1);
+
+        // sums are at most 1020, so the signed pack is exact
+        StoreAverage( pDst + x,
+                      _mm_packs_epi32( _mm_add_epi32(_mm_and_si128(vLo, vMask), _mm_srli_epi32(vLo, 16)),
+                                       _mm_add_epi32(_mm_and_si128(vHi, vMask), _mm_srli_epi32(vHi, 16)) ) );
+    }
+    return x;
+};
+
+//-----------------------------------------------------------------------------------------------
+void DownsampleBox2x2(const unsigned char* pSrc, int iSrcWidth, int iSrcHeight,
+                      unsigned char* pDst, int iComponents) noexcept
+{
+    const int    iDstWidth  = std::max(1, iSrcWidth  / 2);
+    const int    iDstHeight = std::max(1, iSrcHeight / 2);
+    const size_t nSrcStride = static_cast<size_t>(iSrcWidth) * iComponents;
+    const size_t nDstStride = static_cast<size_t>(iDstWidth) * iComponents;
+
+    for (int y = 0; y < iDstHeight; y++)
+    {
+        const unsigned char* pRow0 = pSrc + std::min(2 * y,     iSrcHeight - 1) * nSrcStride;
+        const unsigned char* pRow1 = pSrc + std::min(2 * y + 1, iSrcHeight - 1) * nSrcStride;
+        unsigned char*       pOut  = pDst + y * nDstStride;
+
+        int x = 0;
+        if (iSrcWidth >= 2)
+        {
+            switch (iComponents)
+            {
+            case 4:  x = DownsampleRowRGBA(pRow0, pRow1, pOut, iDstWidth); break;
+            case 2:  x = DownsampleRowLA  (pRow0, pRow1, pOut, iDstWidth); break;
+            case 1:  x = DownsampleRowL   (pRow0, pRow1, pOut, iDstWidth); break;
+            default: break;
+            }
+        }
+
+        for (; x < iDstWidth; x++)
+        {
+            const int x0 = std::min(2 * x,     iSrcWidth - 1) * iComponents;
+            const int x1 = std::min(2 * x + 1, iSrcWidth - 1) * iComponents;
+
+            for (int c = 0; c < iComponents; c++)
+            {
+                pOut[x * iComponents + c] = static_cast<unsigned char>(
+                    (pRow0[x0 + c] + pRow0[x1 + c] + pRow1[x0 + c] + pRow1[x1 + c] + 2) >> 2 );
+            }
+        }
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+CMipChain::CMipChain() noexcept
+    : m_rgTexels(),
+      m_rgLevels(),
+      m_pBase(nullptr),
+      m_pAttached(nullptr),
+      m_nLevelBytes(0),
+      m_iComponents(0)
+{
+};
+
+//-----------------------------------------------------------------------------------------------
+// sizes every level, returning the bytes of levels 1..n
+//
+size_t CMipChain::LayoutLevels(int iWidth, int iHeight, int iComponents)
+{
+    size_t nBytes = 0;
+    m_rgLevels.push_back( { iWidth, iHeight, 0 } ); // note - may throw an exception
+    for (int w = iWidth, h = iHeight; w > 1 || h > 1; )
+    {
+        w = std::max(1, w / 2);
+        h = std::max(1, h / 2);
+
+        m_rgLevels.push_back( { w, h, nBytes } ); // note - may throw an exception
+        nBytes += static_cast<size_t>(w) * h * iComponents;
+    }
+    return nBytes;
+};
+
+//-----------------------------------------------------------------------------------------------
+bool CMipChain::Build(const unsigned char* pBase, int iWidth, int iHeight, int iComponents)
+{
+    m_rgTexels.clear();
+    m_rgLevels.clear();
+    m_pBase       = nullptr;
+    m_pAttached   = nullptr;
+    m_nLevelBytes = 0;
+    m_iComponents = 0;
+
+    if (pBase == nullptr || iWidth <= 0 || iHeight <= 0 || iComponents < 1 || iComponents > 4)
+        return false;
+
+    // size every level first so the store is allocated once
+    const size_t nBytes = LayoutLevels(iWidth, iHeight, iComponents); // note - may throw an exception
+
+    m_rgTexels.resize(nBytes); // note - may throw an exception
+    m_pBase       = pBase;
+    m_nLevelBytes = nBytes;
+    m_iComponents = iComponents;
+
+    for (size_t n = 1; n < m_rgLevels.size(); n++)
+    {
+        const MipLevel& src = m_rgLevels[n - 1];
+        DownsampleBox2x2( get_Texels(n - 1), src.iWidth, src.iHeight,
+                          m_rgTexels.data() + m_rgLevels[n].nOffset, iComponents );
+    }
+
+    return true;
+};
+
+//-----------------------------------------------------------------------------------------------
+bool CMipChain::Attach(const unsigned char* pBase, int iWidth, int iHeight, int iComponents,
+                       const unsigned char* pLevels, size_t nLevelBytes)
+{
+    m_rgTexels.clear();
+    m_rgLevels.clear();
+    m_pBase       = nullptr;
+    m_pAttached   = nullptr;
+    m_nLevelBytes = 0;
+    m_iComponents = 0;
+
+    if (pBase == nullptr || iWidth <= 0 || iHeight <= 0 || iComponents < 1 || iComponents > 4)
+        return false;
+
+    const size_t nBytes = LayoutLevels(iWidth, iHeight, iComponents); // note - may throw an exception
+    if (nBytes != nLevelBytes || (nBytes && pLevels == nullptr))
+    {
+        m_rgLevels.clear();
+        return false;
+    }
+
+    m_pBase       = pBase;
+    m_pAttached   = pLevels;
+    m_nLevelBytes = nBytes;
+    m_iComponents = iComponents;
+    return true;
+};
+
+//-----------------------------------------------------------------------------------------------
+size_t CMipChain::get_ByteSize(void) const noexcept
+{
+    return m_rgLevels.empty() ? 0
+         : static_cast<size_t>(m_rgLevels[0].iWidth) * m_rgLevels[0].iHeight * m_iComponents + m_nLevelBytes;
+};
+
+} // namespace rdr
+} // namespace eng
@@ -0,0 +1,112 @@
+/**
+ *  @file       MipChain.h
+ *  @brief      CMipChain class interface
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ *  <b>Implementation:</b>
+ *
+ *   Builds the full mip chain of an 8-bit texture (1 to 4 components, i.e.
+ *   L, LA, RGB, RGBA) down to 1x1 with a 2x2 box filter.  Level n+1 is
+ *   max(1, w/2) x max(1, h/2) of level n, matching the sizes GL expects;
+ *   an odd trailing row/column is folded into the last output texel's
+ *   neighbour by clamping.  L, LA and RGBA rows are filtered 16 source
+ *   bytes at a time with SSE2, RGB and row tails fall back to scalar.
+ *
+ *   The chain touches no GL state, so it can be built on any thread and
+ *   uploaded later from the GL thread.
+ */
+#pragma once
+
+#if !defined(__MIP_CHAIN_H__)
+#define __MIP_CHAIN_H__
+
+#ifndef _VECTOR_
+    #include <vector>
+#endif
+
+namespace eng
+{
+namespace rdr
+{
+
+struct MipLevel
+{
+    int    iWidth;
+    int    iHeight;
+    size_t nOffset;     ///< into the chain's texel store; unused for level 0
+};
+
+class CMipChain
+{
+    std::vector<unsigned char> m_rgTexels;     ///< levels 1..n, tightly packed, when built here
+    std::vector<MipLevel>      m_rgLevels;
+    const unsigned char*       m_pBase;        ///< level 0, not owned
+    const unsigned char*       m_pAttached;    ///< levels 1..n when attached, not owned
+    size_t                     m_nLevelBytes;
+    int                        m_iComponents;
+
+public:
+    /// Default Constructor
+    CMipChain() noexcept;
+
+/**
+ *  @brief builds levels 1..n from pBase, which must outlive the chain
+ *
+ *  @retval true    on success
+ *  @retval false   on invalid dimensions or component count
+ *
+ *  @note - may throw an exception
+ */
+    bool                 Build          (const unsigned char* pBase, int iWidth, int iHeight, int iComponents);
+
+/**
+ *  @brief wraps levels 1..n built earlier, laid out as get_LevelTexels()
+ *         returns them (e.g. read back from a cache); nothing is filtered or
+ *         copied, and both buffers must outlive the chain
+ *
+ *  @retval false   on invalid dimensions or if nLevelBytes does not match
+ *
+ *  @note - may throw an exception
+ */
+    bool                 Attach         (const unsigned char* pBase, int iWidth, int iHeight, int iComponents,
+                                         const unsigned char* pLevels, size_t nLevelBytes);
+
+    size_t               get_LevelCount (void) const noexcept
+    { return m_rgLevels.size(); };
+
+    const MipLevel&      get_Level      (size_t nLevel) const noexcept
+    { return m_rgLevels[nLevel]; };
+
+    const unsigned char* get_Texels     (size_t nLevel) const noexcept
+    { return nLevel == 0 ? m_pBase : get_LevelTexels() + m_rgLevels[nLevel].nOffset; };
+
+    /// levels 1..n, tightly packed
+    const unsigned char* get_LevelTexels(void) const noexcept
+    { return m_pAttached ? m_pAttached : m_rgTexels.data(); };
+
+    size_t               get_LevelBytes (void) const noexcept
+    { return m_nLevelBytes; };
+
+    int                  get_Components (void) const noexcept
+    { return m_iComponents; };
+
+    /// bytes of every level, level 0 included
+    size_t               get_ByteSize   (void) const noexcept;
+
+private:
+    size_t               LayoutLevels   (int iWidth, int iHeight, int iComponents);
+};
+
+/**
+ *  @brief box filters one level into the next; pDst receives
+ *         max(1, iSrcWidth/2) x max(1, iSrcHeight/2) tightly packed texels
+ */
+void DownsampleBox2x2(const unsigned char* pSrc, int iSrcWidth, int iSrcHeight,
+                      unsigned char* pDst, int iComponents) noexcept;
+
+} // namespace rdr
+} // namespace eng
+
+#endif
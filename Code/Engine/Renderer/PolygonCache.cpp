@@ -0,0 +1,172 @@
+/**
+ *  @file       PolygonCache.cpp
+ *  @brief      CPolygonCache class implementation
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ */
+
+#include "targetver.h"  // this needs to be the 1st header included
+
+#include <cmath>
+#include <xmmintrin.h>
+
+#include "Engine/Math/MathUtils.h"
+#include "Engine/Utility/TimeUtils.h"
+
+#include "PolygonCache.h"
+
+namespace eng
+{
+namespace rdr
+{
+
+using namespace eng::math;
+
+static_assert(sizeof(CVector2f) == 2 * sizeof(float),
+              "CVector2f must be tightly packed to be processed as float pairs");
+
+//-----------------------------------------------------------------------------------------------
+CPolygonCache::CPolygonCache() noexcept
+    : m_rgOffsets(),
+      m_rgUnitVertices()
+{
+    size_t nOffset = 0;
+    for (size_t nSides = 0; nSides <= k_nMaxCachedSides; nSides++)
+    {
+        m_rgOffsets[nSides] = nOffset;
+        if (nSides < k_nMinPolygonSides)
+            continue;
+
+        // integer vertex index, so rounding can never add or drop a vertex
+        CVector2f* pTable = &m_rgUnitVertices[nOffset];
+        for (size_t i = 0; i < nSides; i++)
+        {
+            const double dRadians = (RADIANS_PER_CIRCLE * i) / nSides;
+            pTable[i].Init( static_cast<float>(std::cos(dRadians)),
+                            static_cast<float>(std::sin(dRadians)) );
+        }
+        nOffset += nSides;
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+const CVector2f* CPolygonCache::GetUnitPolygon(size_t nSides) const noexcept
+{
+    if (nSides < k_nMinPolygonSides || nSides > k_nMaxCachedSides)
+        return nullptr;
+
+    return &m_rgUnitVertices[ m_rgOffsets[nSides] ];
+};
+
+//-----------------------------------------------------------------------------------------------
+size_t CPolygonCache::GeneratePolygon(const CVector2f& vCenter, float fRadius, size_t nSides,
+                                      float fDegOrientation, CVector2f* rgVertices) const noexcept
+{
+    const CVector2f* pUnit = GetUnitPolygon(nSides);
+    if (pUnit == nullptr || rgVertices == nullptr)
+        return 0;
+
+    const float fRadOrientation = DegreesToRadians( fDegOrientation );
+    const float fCos = fRadius * std::cos( fRadOrientation );
+    const float fSin = fRadius * std::sin( fRadOrientation );
+
+    //  x' = cx + (ux * cos) - (uy * sin)
+    //  y' = cy + (ux * sin) + (uy * cos)
+    // two vertices per register: [ x0, y0, x1, y1 ]
+    const __m128 vCos    = _mm_set1_ps( fCos );
+    const __m128 vSin    = _mm_setr_ps( -fSin, fSin, -fSin, fSin );
+    const __m128 vOrigin = _mm_setr_ps( vCenter.X, vCenter.Y, vCenter.X, vCenter.Y );
+
+    const float* pSrc = &pUnit[0].X;
+    float*       pDst = &rgVertices[0].X;
+
+    size_t i = 0;
+    for (; i + 2 <= nSides; i += 2)
+    {
+        const __m128 vUnit    = _mm_loadu_ps( pSrc + (i * 2) );
+        const __m128 vSwapped = _mm_shuffle_ps( vUnit, vUnit, _MM_SHUFFLE(2, 3, 0, 1) ); // [ y0, x0, y1, x1 ]
+
+        const __m128 vResult  = _mm_add_ps( vOrigin,
+                                            _mm_add_ps( _mm_mul_ps(vUnit, vCos), _mm_mul_ps(vSwapped, vSin) ) );
+        _mm_storeu_ps( pDst + (i * 2), vResult );
+    }
+
+    // odd side count, last vertex
+    if (i < nSides)
+    {
+        rgVertices[i].Init( vCenter.X + (pUnit[i].X * fCos) - (pUnit[i].Y * fSin),
+                            vCenter.Y + (pUnit[i].X * fSin) + (pUnit[i].Y * fCos) );
+    }
+
+    return nSides;
+};
+
+//-----------------------------------------------------------------------------------------------
+const CPolygonCache& GetPolygonCache(void) noexcept
+{
+    static const CPolygonCache s_PolygonCache;
+
+    return s_PolygonCache;
+};
+
+//-----------------------------------------------------------------------------------------------
+size_t GeneratePolygonDirect(const CVector2f& vCenter, float fRadius, size_t nSides,
+                             float fDegOrientation, CVector2f* rgVertices) noexcept
+{
+    if (nSides < k_nMinPolygonSides || rgVertices == nullptr)
+        return 0;
+
+    const float fRadOrientation = DegreesToRadians( fDegOrientation );
+
+    for (size_t i = 0; i < nSides; i++)
+    {
+        const float fRadCurrent = static_cast<float>( (RADIANS_PER_CIRCLE * i) / nSides ) + fRadOrientation;
+
+        rgVertices[i].Init( vCenter.X + (fRadius * std::cos(fRadCurrent)),
+                            vCenter.Y + (fRadius * std::sin(fRadCurrent)) );
+    }
+
+    return nSides;
+};
+
+//-----------------------------------------------------------------------------------------------
+PolygonBenchmark BenchmarkPolygonGeneration(size_t nPolygons) noexcept
+{
+    PolygonBenchmark result = { nPolygons, 0.0, 0.0 };
+
+    const CPolygonCache& cache = GetPolygonCache();
+
+    CVector2f rgVertices[k_nMaxCachedSides];
+    // consumed after each run so neither loop can be optimized away
+    volatile float fSink = 0.f;
+
+    // side counts cycle through the range the game actually draws
+    double dStart = util::GetCurrentTimeInSeconds();
+    for (size_t n = 0; n < nPolygons; n++)
+    {
+        const size_t nSides = k_nMinPolygonSides + (n % 14);
+        GeneratePolygonDirect( CVector2f(float(n & 0xFF), 0.f), 25.f, nSides, float(n % 360), rgVertices );
+        fSink = fSink + rgVertices[nSides - 1].X;
+    }
+    double dElapsed = util::GetCurrentTimeInSeconds() - dStart;
+    if (dElapsed > 0.0)
+        result.dDirectPerSecond = nPolygons / dElapsed;
+
+    dStart = util::GetCurrentTimeInSeconds();
+    for (size_t n = 0; n < nPolygons; n++)
+    {
+        const size_t nSides = k_nMinPolygonSides + (n % 14);
+        cache.GeneratePolygon( CVector2f(float(n & 0xFF), 0.f), 25.f, nSides, float(n % 360), rgVertices );
+        fSink = fSink + rgVertices[nSides - 1].X;
+    }
+    dElapsed = util::GetCurrentTimeInSeconds() - dStart;
+    if (dElapsed > 0.0)
+        result.dCachedPerSecond = nPolygons / dElapsed;
+
+    return result;
+};
+
+} // namespace rdr
+} // namespace eng
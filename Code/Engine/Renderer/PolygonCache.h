@@ -0,0 +1,101 @@
+/**
+ *  @file       PolygonCache.h
+ *  @brief      CPolygonCache class interface
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ *  <b>Implementation:</b>
+ *
+ *   Regular polygons are all the same shape for a given side count, so the
+ *   unit-circle vertices for every side count up to k_nMaxCachedSides are
+ *   computed once and stored back to back.  A polygon is then produced by a
+ *   single rotate, scale and translate of its table, two vertices per SSE
+ *   register, with one sin/cos pair per polygon instead of one per vertex.
+ */
+#pragma once
+
+#if !defined(__POLYGON_CACHE_H__)
+#define __POLYGON_CACHE_H__
+
+#ifndef __VECTOR2_H__
+    #include "Engine/Math/Vector2.h"
+#endif
+
+namespace eng
+{
+namespace rdr
+{
+
+constexpr size_t k_nMinPolygonSides = 3;
+constexpr size_t k_nMaxCachedSides  = 64;
+
+struct PolygonBenchmark
+{
+    size_t nPolygons;          ///< polygons generated by each method
+    double dDirectPerSecond;   ///< per-vertex sin/cos
+    double dCachedPerSecond;   ///< cached unit table
+};
+
+class CPolygonCache
+{
+    /// start of each side count's table within m_rgUnitVertices
+    size_t          m_rgOffsets[k_nMaxCachedSides + 1];
+    math::CVector2f m_rgUnitVertices[ (k_nMaxCachedSides * (k_nMaxCachedSides + 1)) / 2 ];
+
+public:
+    /// Default Constructor, builds every table
+    CPolygonCache() noexcept;
+    /// Default Destructor
+    ~CPolygonCache() = default;
+
+/**
+ *  @brief retrieves the unit-circle vertices of a regular polygon, the first
+ *         vertex lies on the positive X axis
+ *
+ *  @retval const CVector2f*   nSides vertices in counter-clockwise order
+ *  @retval nullptr            if nSides is outside the cached range
+ */
+    const math::CVector2f* GetUnitPolygon(size_t nSides) const noexcept;
+
+/**
+ *  @brief writes the vertices of a regular polygon
+ *
+ *  @param [out] rgVertices     destination, room for at least nSides vertices
+ *
+ *  @retval size_t              number of vertices written, 0 if nSides is
+ *                              outside the cached range
+ */
+    size_t GeneratePolygon(const math::CVector2f& vCenter, float fRadius, size_t nSides,
+                           float fDegOrientation, math::CVector2f* rgVertices) const noexcept;
+
+private:
+    /// Copy constructor
+    CPolygonCache(const CPolygonCache&) = delete;
+    /// Assignment operator
+    CPolygonCache& operator=(const CPolygonCache&) = delete;
+};
+
+/**
+ *  @brief the process-wide cache, built on first use
+ */
+const CPolygonCache& GetPolygonCache(void) noexcept;
+
+/**
+ *  @brief writes the vertices of a regular polygon evaluating sin/cos for
+ *         every vertex; used for side counts beyond the cache and as the
+ *         benchmark reference
+ */
+size_t GeneratePolygonDirect(const math::CVector2f& vCenter, float fRadius, size_t nSides,
+                             float fDegOrientation, math::CVector2f* rgVertices) noexcept;
+
+/**
+ *  @brief times nPolygons polygons of varying side count through both
+ *         generators (vertex generation only, nothing is submitted to GL)
+ */
+PolygonBenchmark BenchmarkPolygonGeneration(size_t nPolygons) noexcept;
+
+} // namespace rdr
+} // namespace eng
+
+#endif
@@ -0,0 +1,102 @@
+/**
+ *  @file       RenderBackend.h
+ *  @brief      IRenderBackend interface
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ *  <b>Implementation:</b>
+ *
+ *   CRenderer forwards to exactly one backend, chosen once at startup by
+ *   CRenderer::Initialize():
+ *
+ *    - RB_FIXED_FUNCTION: the original OpenGL 1.1 path (matrix stack,
+ *      client-side vertex arrays); runs on any context.
+ *    - RB_CORE_PROFILE_33: OpenGL 3.3 core profile; vertex buffer objects,
+ *      a small shader pair, a CPU-side matrix stack and instanced drawing
+ *      of registered shapes.  Requires a 3.3 core context, see
+ *      CreateCoreProfileContext().
+ *
+ *   The backend interface is intentionally low level: polygon generation,
+ *   AABB and line helpers stay in CRenderer and reach the backend as plain
+ *   vertex arrays.
+ */
+#pragma once
+
+#if !defined(__RENDER_BACKEND_H__)
+#define __RENDER_BACKEND_H__
+
+#ifndef __VECTOR2_H__
+    #include "Engine/Math/Vector2.h"
+#endif
+
+#ifndef __RENDER_TYPES_H__
+    #include "Engine/Renderer/RenderTypes.h"
+#endif
+
+namespace eng
+{
+namespace rdr
+{
+
+enum RENDER_BACKEND
+{
+    RB_FIXED_FUNCTION = 0,
+    RB_CORE_PROFILE_33
+};
+
+class __declspec(novtable) IRenderBackend
+{
+public:
+    virtual ~IRenderBackend() = default;
+
+/**
+ *  @brief creates GPU resources, called with the backend's context current
+ *
+ *  @retval false    if the context cannot run this backend
+ */
+    virtual bool        Initialize          ( void ) noexcept = 0;
+    virtual void        Shutdown            ( void ) noexcept = 0;
+    virtual const char* get_Name            ( void ) const noexcept = 0;
+
+    virtual void        Clear               ( void ) noexcept = 0;
+    virtual void        SetClearColor       ( const ColorRGBA& clr ) noexcept = 0;
+    virtual void        SetViewPort         ( int iX, int iY, int iWidth, int iHeight ) noexcept = 0;
+    virtual void        SetOrtho            ( const math::CVector2f& vBottomLeft, const math::CVector2f& vTopRight ) noexcept = 0;
+    virtual void        SetLineWidth        ( float fLineWidth ) noexcept = 0;
+    virtual void        SetPointSize        ( float fPointSize ) noexcept = 0;
+    virtual void        SetColor            ( const ColorRGBA& clr ) noexcept = 0;
+
+    virtual void        Translate           ( const math::CVector2f& vTranslate ) noexcept = 0;
+    virtual void        Rotate              ( float fDegrees ) noexcept = 0;
+    virtual void        Scale               ( float fUniformScale ) noexcept = 0;
+    virtual void        PushMatrix          ( void ) noexcept = 0;
+    virtual void        PopMatrix           ( void ) noexcept = 0;
+
+/**
+ *  @brief draws vertices in the color last passed to SetColor()
+ */
+    virtual void        DrawVertices        ( PRIMITIVE_TYPE ePrim, const math::CVector2f* rgVertices, size_t nVertices ) noexcept = 0;
+    virtual void        DrawColoredVertices ( PRIMITIVE_TYPE ePrim, const ColoredVertex* rgVertices, size_t nVertices ) noexcept = 0;
+    virtual void        DrawTexturedQuads   ( unsigned int nTextureID, const TexturedVertex* rgVertices, size_t nVertices ) noexcept = 0;
+
+/**
+ *  @brief stores a closed outline for later instanced drawing
+ *
+ *  @retval size_t      shape id passed to DrawShapeInstances()
+ */
+    virtual size_t      RegisterShape       ( const math::CVector2f* rgVertices, size_t nVertices ) = 0;
+    virtual void        DrawShapeInstances  ( size_t nShape, const ShapeInstance* rgInstances, size_t nInstances ) noexcept = 0;
+
+    virtual void        ReadPixels          ( int iWidth, int iHeight, void* pDest ) noexcept = 0;
+};
+
+/**
+ *  @brief retrieves the process-wide instance of a backend
+ */
+IRenderBackend* GetRenderBackend( RENDER_BACKEND eBackend ) noexcept;
+
+} // namespace rdr
+} // namespace eng
+
+#endif
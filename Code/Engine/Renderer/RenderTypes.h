@@ -0,0 +1,87 @@
+/**
+ *  @file       RenderTypes.h
+ *  @brief      Colors, vertex layouts and primitive types shared by the
+ *              renderer and its backends
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ */
+#pragma once
+
+#if !defined(__RENDER_TYPES_H__)
+#define __RENDER_TYPES_H__
+
+namespace eng
+{
+
+struct ColorRGBA
+{
+    float fRed;
+    float fGreen;
+    float fBlue;
+    float fAlpha;
+};
+
+constexpr ColorRGBA RGBA_WHITE   = { 1.0f, 1.0f, 1.0f,  1.0f };
+constexpr ColorRGBA RGBA_BLACK   = { 0.0f, 0.0f, 0.0f,  1.0f };
+constexpr ColorRGBA RGBA_RED     = { 1.0f, 0.0f, 0.0f,  1.0f };
+constexpr ColorRGBA RGBA_GREEN   = { 0.0f, 1.0f, 0.0f,  1.0f };
+constexpr ColorRGBA RGBA_BLUE    = { 0.0f, 0.0f, 1.0f,  1.0f };
+constexpr ColorRGBA RGBA_CYAN    = { 0.0f, 1.0f, 1.0f,  1.0f };
+constexpr ColorRGBA RGBA_YELLOW  = { 1.0f, 1.0f, 0.0f,  1.0f };
+constexpr ColorRGBA RGBA_MAGENTA = { 1.0f, 0.0f, 1.0f,  1.0f };
+constexpr ColorRGBA RGBA_GRAY    = { 0.5f, 0.5f, 0.5f,  1.0f };
+constexpr ColorRGBA RGBA_BROWN   = { 0.6f, 0.4f, 0.12f, 1.0f };
+
+/**
+ * @brief interleaved vertex layout used for batched textured geometry
+ */
+struct TexturedVertex
+{
+    float     fX;
+    float     fY;
+    float     fU;
+    float     fV;
+    ColorRGBA clr;
+};
+
+/**
+ * @brief interleaved vertex layout used for batched untextured points
+ */
+struct ColoredVertex
+{
+    float     fX;
+    float     fY;
+    ColorRGBA clr;
+};
+
+/**
+ * @brief placement of one instance of a registered shape
+ *        (see CRenderer::RegisterShape)
+ */
+struct ShapeInstance
+{
+    float     fX;
+    float     fY;
+    float     fScale;
+    float     fDegOrientation;
+    ColorRGBA clr;
+};
+
+namespace rdr
+{
+
+enum PRIMITIVE_TYPE
+{
+    PRIM_POINTS = 0,
+    PRIM_LINES,
+    PRIM_LINE_LOOP,
+    PRIM_TRIANGLE_FAN
+};
+
+} // namespace rdr
+
+} // namespace eng
+
+#endif
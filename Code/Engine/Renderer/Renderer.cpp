@@ -11,13 +11,13 @@
 #define WIN32_LEAN_AND_MEAN
 #include "targetver.h"  // this needs to be the 1st header included
 
-#include <Windows.h>
-#include <gl/gl.h>
 #include <stdlib.h>
+#include <cmath>
 
 #include "Renderer.h"
-
-#pragma comment( lib, "opengl32" ) // Link in the OpenGL32.lib static library
+#include "PolygonCache.h"
+#include "FixedFunctionBackend.h"
+#include "CoreProfileBackend.h"
 
 
 namespace eng
@@ -27,118 +27,172 @@ namespace rdr
 
 using  namespace eng::math;
 
-constexpr float g_fDefaultLineWidth = 2.f;
+//-----------------------------------------------------------------------------------------------
+IRenderBackend* GetRenderBackend( RENDER_BACKEND eBackend ) noexcept
+{
+    static CFixedFunctionBackend s_FixedFunction;
+    static CCoreProfileBackend   s_CoreProfile;
+
+    switch (eBackend)
+    {
+    case RB_FIXED_FUNCTION:  return &s_FixedFunction;
+    case RB_CORE_PROFILE_33: return &s_CoreProfile;
+    }
+    return nullptr;
+};
+
+//-----------------------------------------------------------------------------------------------
+bool CRenderer::Initialize( RENDER_BACKEND eBackend /* = RB_FIXED_FUNCTION */ ) noexcept
+{
+    IRenderBackend* pBackend = GetRenderBackend(eBackend);
+    if (pBackend == nullptr || !pBackend->Initialize())
+        return false;
+
+    if (m_pBackend && m_pBackend != pBackend)
+        m_pBackend->Shutdown();
+
+    m_pBackend = pBackend;
+    m_eBackend = eBackend;
+    return true;
+};
 
 //-----------------------------------------------------------------------------------------------
-void CRenderer::Initialize(void) noexcept
+void CRenderer::Shutdown(void) noexcept
 {
-    glEnable( GL_BLEND );
-    glBlendFunc( GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA );
-    glLineWidth( g_fDefaultLineWidth );
-    glEnable( GL_LINE_SMOOTH );
+    if (m_pBackend)
+    {
+        m_pBackend->Shutdown();
+        m_pBackend = nullptr;
+        m_eBackend = RB_FIXED_FUNCTION;
+    }
 };
 
 //-----------------------------------------------------------------------------------------------
 void CRenderer::ClearColorBuffer(void) noexcept
 {
-    glClear( GL_COLOR_BUFFER_BIT );
+    if (m_pBackend)
+        m_pBackend->Clear();
 };
 
 //-----------------------------------------------------------------------------------------------
 void CRenderer::SetViewPort( int iX, int iY, int iWidth, int iHeight ) noexcept
 {
-    glViewport(iX, iY, iWidth, iHeight);
+    if (m_pBackend)
+        m_pBackend->SetViewPort(iX, iY, iWidth, iHeight);
 };
 
 //-----------------------------------------------------------------------------------------------
 void CRenderer::SetOrtho( const CVector2f& vBottomLeft, const CVector2f& vTopRight ) noexcept
 {
-    glLoadIdentity();
-    glOrtho(vBottomLeft.X, vTopRight.X, vBottomLeft.Y, vTopRight.Y, 0.f, 1.f);
+    if (m_pBackend)
+        m_pBackend->SetOrtho(vBottomLeft, vTopRight);
 };
 
 //-----------------------------------------------------------------------------------------------
 void CRenderer::SetLineWidth ( float fLineWidth ) noexcept
 {
-    glLineWidth( fLineWidth );
+    if (m_pBackend)
+        m_pBackend->SetLineWidth( fLineWidth );
 };
 
 //-----------------------------------------------------------------------------------------------
 void CRenderer::SetColor     ( const ColorRGBA& clr ) noexcept
 {
-    glColor4f( clr.fRed, clr.fGreen, clr.fBlue, clr.fAlpha );
+    if (m_pBackend)
+        m_pBackend->SetColor( clr );
 };
 
 //-----------------------------------------------------------------------------------------------
 void CRenderer::SetPointSize ( float fPointSize ) noexcept
 {
-    glPointSize( fPointSize );
+    if (m_pBackend)
+        m_pBackend->SetPointSize( fPointSize );
 };
 
 //-----------------------------------------------------------------------------------------------
 void CRenderer::SetClearColor (const ColorRGBA& clr ) noexcept
 {
-    glClearColor( clr.fRed, clr.fGreen, clr.fBlue, clr.fAlpha );
+    if (m_pBackend)
+        m_pBackend->SetClearColor( clr );
 };
 
 //-----------------------------------------------------------------------------------------------
 void CRenderer::TranslateView( const CVector2f& vTranslate ) noexcept
 {
-    glTranslatef( vTranslate.X, vTranslate.Y, 0.f );
+    if (m_pBackend)
+        m_pBackend->Translate( vTranslate );
 };
 
 //-----------------------------------------------------------------------------------------------
 void CRenderer::RotateView( float fDegrees ) noexcept
 {
-    glRotatef( fDegrees, 0.f, 0.f, 1.f );
+    if (m_pBackend)
+        m_pBackend->Rotate( fDegrees );
 };
 
 //-----------------------------------------------------------------------------------------------
 void CRenderer::ScaleView( float fUniformScale ) noexcept
 {
-    glScalef(fUniformScale, fUniformScale, 1.f);
+    if (m_pBackend)
+        m_pBackend->Scale( fUniformScale );
 };
 
 //-----------------------------------------------------------------------------------------------
 void CRenderer::PushView(void) noexcept
 {
-    glPushMatrix();
+    if (m_pBackend)
+        m_pBackend->PushMatrix();
 };
 
 //-----------------------------------------------------------------------------------------------
 void CRenderer::PopView(void) noexcept
 {
-    glPopMatrix();
+    if (m_pBackend)
+        m_pBackend->PopMatrix();
 };
 
 //-----------------------------------------------------------------------------------------------
 void CRenderer::DrawLine( const CVector2f& vStart, const CVector2f& vEnd) noexcept
 {
-    glDisable( GL_TEXTURE_2D ); // need to disable texturing before drawing non-textured objects
-    glBegin ( GL_LINES );
-    {
-        glVertex2f( vStart.X, vStart.Y );
-        glVertex2f( vEnd.X,   vEnd.Y );
-    }
-    glEnd();
+    if (m_pBackend == nullptr)
+        return;
+
+    const CVector2f rgVertices[2] = { vStart, vEnd };
+
+    m_pBackend->DrawVertices( PRIM_LINES, rgVertices, _countof(rgVertices) );
 };
 
 //-----------------------------------------------------------------------------------------------
 void CRenderer::DrawPoint( const CVector2f& vCenter, const ColorRGBA& clr, float fPointSize ) noexcept
 {
-    glPointSize( fPointSize );
-    glColor4f  ( clr.fRed, clr.fGreen, clr.fBlue, clr.fAlpha );
+    if (m_pBackend == nullptr)
+        return;
 
-    glBegin( GL_POINTS );
-        glVertex2f( vCenter.X, vCenter.Y );
-    glEnd();
+    m_pBackend->SetPointSize( fPointSize );
+    m_pBackend->SetColor    ( clr );
+    m_pBackend->DrawVertices( PRIM_POINTS, &vCenter, 1 );
+};
+
+//-----------------------------------------------------------------------------------------------
+void CRenderer::DrawPoints( const ColoredVertex* rgVertices, size_t nVertices, float fPointSize ) noexcept
+{
+    if (m_pBackend == nullptr || rgVertices == nullptr || nVertices == 0)
+        return;
+
+    m_pBackend->SetPointSize       ( fPointSize );
+    m_pBackend->DrawColoredVertices( PRIM_POINTS, rgVertices, nVertices );
+
+    return;
 };
 
 //-----------------------------------------------------------------------------------------------
 void CRenderer::DrawLine( const CVector2f& vStart, const CVector2f& vEnd, const ColorRGBA& clr, float fLineWidth /* = 1.f */) noexcept
 {
-    glLineWidth( fLineWidth );
-    glColor4f  ( clr.fRed, clr.fGreen, clr.fBlue, clr.fAlpha );
+    if (m_pBackend == nullptr)
+        return;
+
+    m_pBackend->SetLineWidth( fLineWidth );
+    m_pBackend->SetColor    ( clr );
 
     DrawLine( vStart, vEnd );
 
@@ -148,21 +202,46 @@ void CRenderer::DrawLine( const CVector2f& vStart, const CVector2f& vEnd, const
 //-----------------------------------------------------------------------------------------------
 void CRenderer::DrawPolygon( const CVector2f& vCenter, float fRadius, size_t nSides, float fDegOrientation ) noexcept
 {
-    const float RADIANS_PER_SIDE = static_cast<float>( eng::math::RADIANS_PER_CIRCLE / nSides );
+    if (m_pBackend == nullptr || nSides < k_nMinPolygonSides)
+        return;
 
-    // Orientation of the polygon (in Radians)
-    float fRadOrientation = eng::math::DegreesToRadians( fDegOrientation );
+    if (nSides <= k_nMaxCachedSides)
+    {
+        CVector2f rgVertices[k_nMaxCachedSides];
+        GetPolygonCache().GeneratePolygon( vCenter, fRadius, nSides, fDegOrientation, rgVertices );
 
-    glBegin ( GL_LINE_LOOP );
+        m_pBackend->DrawVertices( PRIM_LINE_LOOP, rgVertices, nSides );
+    }
+    else
     {
-        for (float fRadCurrent = 0.f; fRadCurrent < eng::math::RADIANS_PER_CIRCLE; fRadCurrent += RADIANS_PER_SIDE)
+        // too many sides to cache; evaluate a unit outline in fixed-size runs
+        // of segments and let the view transform place it
+        CVector2f rgSegments[2 * k_nMaxCachedSides];
+
+        m_pBackend->PushMatrix();
+        m_pBackend->Translate ( vCenter );
+        m_pBackend->Rotate    ( fDegOrientation );
+        m_pBackend->Scale     ( fRadius );
+
+        CVector2f vPrev( 1.f, 0.f );
+        for (size_t nFirst = 1; nFirst <= nSides; nFirst += k_nMaxCachedSides)
         {
-            float x  = vCenter.X + (fRadius * std::cos(fRadCurrent + fRadOrientation));
-            float y  = vCenter.Y + (fRadius * std::sin(fRadCurrent + fRadOrientation));
-            glVertex2f(x, y);
+            size_t nCount = 0;
+            for (size_t i = nFirst; i <= nSides && nCount < _countof(rgSegments); i++)
+            {
+                const float fRadCurrent = static_cast<float>( (eng::math::RADIANS_PER_CIRCLE * (i % nSides)) / nSides );
+                const CVector2f vCurr( std::cos(fRadCurrent), std::sin(fRadCurrent) );
+
+                rgSegments[nCount++] = vPrev;
+                rgSegments[nCount++] = vCurr;
+                vPrev = vCurr;
+            }
+
+            m_pBackend->DrawVertices( PRIM_LINES, rgSegments, nCount );
         }
+
+        m_pBackend->PopMatrix();
     }
-    glEnd();
 
     return;
 };
@@ -170,21 +249,13 @@ void CRenderer::DrawPolygon( const CVector2f& vCenter, float fRadius, size_t nSi
 //-----------------------------------------------------------------------------------------------
 void CRenderer::DrawPolygon( const CVector2f*& rgVertices, size_t nVertices, float fDegOrientation ) noexcept
 {
-    glPushMatrix();
-
-    glRotatef   ( fDegOrientation, 0.f, 0.f, 1.f );
-
-    glBegin ( GL_LINE_LOOP );
-    {
-        const CVector2f* pV = &rgVertices[0];
-        for ( size_t i = 0; i < nVertices; i++)
-        {
-            glVertex2f( pV[i].X, pV[i].Y );
-        }
-    }
-    glEnd();
+    if (m_pBackend == nullptr)
+        return;
 
-    glPopMatrix();
+    m_pBackend->PushMatrix();
+    m_pBackend->Rotate      ( fDegOrientation );
+    m_pBackend->DrawVertices( PRIM_LINE_LOOP, rgVertices, nVertices );
+    m_pBackend->PopMatrix();
 
     return;
 };
@@ -192,20 +263,13 @@ void CRenderer::DrawPolygon( const CVector2f*& rgVertices, size_t nVertices, flo
 //-----------------------------------------------------------------------------------------------
 void CRenderer::DrawPolygon( const std::vector<CVector2f>& rgVertices, float fDegOrientation ) noexcept
 {
-    glPushMatrix();
+    if (m_pBackend == nullptr)
+        return;
 
-    glRotatef   ( fDegOrientation, 0.f, 0.f, 1.f );
-
-    glBegin ( GL_LINE_LOOP );
-    {
-        for ( auto v : rgVertices)
-        {
-            glVertex2f( v.X, v.Y );
-        }
-    }
-    glEnd();
-
-    glPopMatrix();
+    m_pBackend->PushMatrix();
+    m_pBackend->Rotate      ( fDegOrientation );
+    m_pBackend->DrawVertices( PRIM_LINE_LOOP, rgVertices.data(), rgVertices.size() );
+    m_pBackend->PopMatrix();
 
     return;
 };
@@ -213,49 +277,83 @@ void CRenderer::DrawPolygon( const std::vector<CVector2f>& rgVertices, float fDe
 void CRenderer::DrawTexturedAABB( const CAABB2& aabb, const CTexture& texture, const ColorRGBA& tint,
                                   const CVector2f& vTexCoordMins, const CVector2f& vTexCoordMaxs ) noexcept
 {
-    glColor4f    ( tint.fRed, tint.fGreen, tint.fBlue, tint.fAlpha );
-    glEnable     ( GL_TEXTURE_2D );
-    glBindTexture( GL_TEXTURE_2D,  texture.get_TextureID() );
+    if (m_pBackend == nullptr)
+        return;
 
-    glBegin(GL_QUADS);
+    const TexturedVertex rgVertices[4] =
     {
-        glTexCoord2f(vTexCoordMins.X, vTexCoordMaxs.Y); glVertex2f(aabb.get_Min().X, aabb.get_Min().Y);
-        glTexCoord2f(vTexCoordMaxs.X, vTexCoordMaxs.Y); glVertex2f(aabb.get_Max().X, aabb.get_Min().Y);
-        glTexCoord2f(vTexCoordMaxs.X, vTexCoordMins.Y); glVertex2f(aabb.get_Max().X, aabb.get_Max().Y);
-        glTexCoord2f(vTexCoordMins.X, vTexCoordMins.Y); glVertex2f(aabb.get_Min().X, aabb.get_Max().Y);
-    }
-    glEnd();
+        { aabb.get_Min().X, aabb.get_Min().Y, vTexCoordMins.X, vTexCoordMaxs.Y, tint },
+        { aabb.get_Max().X, aabb.get_Min().Y, vTexCoordMaxs.X, vTexCoordMaxs.Y, tint },
+        { aabb.get_Max().X, aabb.get_Max().Y, vTexCoordMaxs.X, vTexCoordMins.Y, tint },
+        { aabb.get_Min().X, aabb.get_Max().Y, vTexCoordMins.X, vTexCoordMins.Y, tint }
+    };
+
+    m_pBackend->DrawTexturedQuads( texture.get_TextureID(), rgVertices, _countof(rgVertices) );
  
     return;
 };
 
+//-----------------------------------------------------------------------------------------------
+/**
+ *  Submits a run of textured quads (4 vertices per quad) bound to a single
+ *  texture with one draw call.
+ */
+void CRenderer::DrawTexturedQuads( unsigned int nTextureID, const TexturedVertex* rgVertices, size_t nVertices ) noexcept
+{
+    if (m_pBackend)
+        m_pBackend->DrawTexturedQuads( nTextureID, rgVertices, nVertices );
+};
+
+//-----------------------------------------------------------------------------------------------
+size_t CRenderer::RegisterShape( const CVector2f* rgVertices, size_t nVertices )
+{
+    if (m_pBackend == nullptr)
+        return k_nInvalidShape;
+
+    return m_pBackend->RegisterShape( rgVertices, nVertices ); // note - may throw an exception
+};
+
+//-----------------------------------------------------------------------------------------------
+void CRenderer::DrawShapeInstances( size_t nShape, const ShapeInstance* rgInstances, size_t nInstances ) noexcept
+{
+    if (m_pBackend)
+        m_pBackend->DrawShapeInstances( nShape, rgInstances, nInstances );
+};
+
+//-----------------------------------------------------------------------------------------------
+void CRenderer::ReadPixels( int iWidth, int iHeight, void* pDest ) noexcept
+{
+    // read the frame just rendered, before it is swapped away
+    if (m_pBackend)
+        m_pBackend->ReadPixels( iWidth, iHeight, pDest );
+};
+
 void CRenderer::DrawQuad        ( const CVector2f rgVertices[4], const ColorRGBA& clr ) noexcept
 { 
-    glColor4f  ( clr.fRed, clr.fGreen, clr.fBlue, clr.fAlpha );
-    glBegin ( GL_QUADS );
-    {
-        for ( size_t i = 0; i < 4; i++)
-        {
-            glVertex2f( rgVertices[i].X, rgVertices[i].Y );
-        }
-    }
-    glEnd();
+    if (m_pBackend == nullptr)
+        return;
+
+    m_pBackend->SetColor    ( clr );
+    m_pBackend->DrawVertices( PRIM_TRIANGLE_FAN, rgVertices, 4 );
 
     return;
 };
 
 void CRenderer::DrawAABB        ( const CAABB2& aabb, const ColorRGBA& clr ) noexcept
 { 
-    glColor4f( clr.fRed, clr.fGreen, clr.fBlue, clr.fAlpha );
-    glDisable( GL_TEXTURE_2D ); // need to disable texturing before drawing non-textured objects
-    glBegin  ( GL_QUADS );
+    if (m_pBackend == nullptr)
+        return;
+
+    const CVector2f rgVertices[4] =
     {
-        glVertex2f( aabb.get_Min().X, aabb.get_Min().Y );
-        glVertex2f( aabb.get_Max().X, aabb.get_Min().Y );
-        glVertex2f( aabb.get_Max().X, aabb.get_Max().Y );
-        glVertex2f( aabb.get_Min().X, aabb.get_Max().Y );
-    }
-    glEnd();
+        CVector2f( aabb.get_Min().X, aabb.get_Min().Y ),
+        CVector2f( aabb.get_Max().X, aabb.get_Min().Y ),
+        CVector2f( aabb.get_Max().X, aabb.get_Max().Y ),
+        CVector2f( aabb.get_Min().X, aabb.get_Max().Y )
+    };
+
+    m_pBackend->SetColor    ( clr );
+    m_pBackend->DrawVertices( PRIM_TRIANGLE_FAN, rgVertices, _countof(rgVertices) );
 
     return;
 };
@@ -21,47 +21,60 @@
     #include "Engine/Renderer/Texture.h"
 #endif
 
+#ifndef __RENDER_TYPES_H__
+    #include "Engine/Renderer/RenderTypes.h"
+#endif
+
+#ifndef __RENDER_BACKEND_H__
+    #include "Engine/Renderer/RenderBackend.h"
+#endif
+
 #ifndef _VECTOR_
     #include <vector>
 #endif
 
 namespace eng
 {
-
-struct ColorRGBA
-{
-    float fRed;
-    float fGreen;
-    float fBlue;
-    float fAlpha;
-};
-
-constexpr ColorRGBA RGBA_WHITE   = { 1.0f, 1.0f, 1.0f,  1.0f };
-constexpr ColorRGBA RGBA_BLACK   = { 0.0f, 0.0f, 0.0f,  1.0f };
-constexpr ColorRGBA RGBA_RED     = { 1.0f, 0.0f, 0.0f,  1.0f };
-constexpr ColorRGBA RGBA_GREEN   = { 0.0f, 1.0f, 0.0f,  1.0f };
-constexpr ColorRGBA RGBA_BLUE    = { 0.0f, 0.0f, 1.0f,  1.0f };
-constexpr ColorRGBA RGBA_CYAN    = { 0.0f, 1.0f, 1.0f,  1.0f };
-constexpr ColorRGBA RGBA_YELLOW  = { 1.0f, 1.0f, 0.0f,  1.0f };
-constexpr ColorRGBA RGBA_MAGENTA = { 1.0f, 0.0f, 1.0f,  1.0f };
-constexpr ColorRGBA RGBA_GRAY    = { 0.5f, 0.5f, 0.5f,  1.0f };
-constexpr ColorRGBA RGBA_BROWN   = { 0.6f, 0.4f, 0.12f, 1.0f };
-
-
 namespace rdr
 {
 
+/// never a registered shape, DrawShapeInstances() ignores it
+constexpr size_t k_nInvalidShape = static_cast<size_t>(-1);
+
 class CRenderer
 {
+    IRenderBackend*  m_pBackend;
+    RENDER_BACKEND   m_eBackend;
+
 public:
     /// Default Constructor
     constexpr CRenderer() noexcept
+        : m_pBackend(nullptr),
+          m_eBackend(RB_FIXED_FUNCTION)
     { };
 
     /// Default Destructor
     ~CRenderer() = default;
 
-    void Initialize      ( void ) noexcept;
+/**
+ *  @brief selects and initializes the rendering backend; must be called
+ *         with a context current that can run it.  Until then every other
+ *         method does nothing, as window messages may arrive first
+ *
+ *  @retval false    if the backend cannot run on the current context; the
+ *                   previously selected backend (if any) stays in use
+ */
+    bool Initialize      ( RENDER_BACKEND eBackend = RB_FIXED_FUNCTION ) noexcept;
+    void Shutdown        ( void ) noexcept;
+
+    constexpr bool IsInitialized ( void ) const noexcept
+    { return m_pBackend != nullptr; };
+
+    inline const char* get_BackendName ( void ) const noexcept
+    { return m_pBackend ? m_pBackend->get_Name() : ""; };
+
+    constexpr RENDER_BACKEND get_Backend ( void ) const noexcept
+    { return m_eBackend; };
 
     void ClearColorBuffer( void ) noexcept;
 
@@ -81,6 +94,7 @@ public:
     void SetViewPort     ( int iX, int iY, int iWidth, int iHeight ) noexcept;
 
     void DrawPoint       ( const math::CVector2f& vCenter, const ColorRGBA& clr, float fPointSize ) noexcept;
+    void DrawPoints      ( const ColoredVertex* rgVertices, size_t nVertices, float fPointSize ) noexcept;
 
     void DrawLine        ( const math::CVector2f& vStart, const math::CVector2f& vEnd ) noexcept;
     void DrawLine        ( const math::CVector2f& vStart, const math::CVector2f& vEnd, const ColorRGBA& clr, float fLineWidth = 1.f ) noexcept;
@@ -96,6 +110,32 @@ public:
                            const math::CVector2f& vTexCoordMins = math::CVector2f(0.f, 0.f), 
                            const math::CVector2f& vTexCoordMaxs = math::CVector2f(1.f, 1.f) ) noexcept;
 
+    void DrawTexturedQuads( unsigned int nTextureID, const TexturedVertex* rgVertices, size_t nVertices ) noexcept;
+
+/**
+ *  @brief stores a closed outline (in unit space, drawn as a line loop) for
+ *         instanced drawing; vertices are copied
+ *
+ *  @retval size_t          shape id for DrawShapeInstances()
+ *  @retval k_nInvalidShape before Initialize()
+ *
+ *  @note - may throw an exception
+ */
+    size_t RegisterShape ( const math::CVector2f* rgVertices, size_t nVertices );
+
+/**
+ *  @brief draws many placements of one registered shape, each with its own
+ *         position, scale, orientation and color, in the current view
+ */
+    void DrawShapeInstances( size_t nShape, const ShapeInstance* rgInstances, size_t nInstances ) noexcept;
+
+/**
+ *  @brief copies the back buffer into pDest as bottom-up RGBA8 rows
+ *
+ *  @param [out] pDest       room for iWidth * iHeight * 4 bytes
+ */
+    void ReadPixels       ( int iWidth, int iHeight, void* pDest ) noexcept;
+
 };
 
 
@@ -0,0 +1,72 @@
+/**
+ *  @file       ShapeBatch.cpp
+ *  @brief      CShapeBatch class implementation
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ */
+
+#include "targetver.h"   // this needs to be the 1st header included
+
+#include "ShapeBatch.h"
+
+namespace eng
+{
+namespace rdr
+{
+
+//---------------------------------------------------------------------------
+CShapeBatch::CShapeBatch() noexcept
+    : m_rgShapeInstances(),
+      m_bInBatch(false),
+      m_nInstancesDrawn(0),
+      m_nSubmissions(0)
+{
+};
+
+//---------------------------------------------------------------------------
+void CShapeBatch::Begin(void) noexcept
+{
+    // keep the capacity of each instance stream from frame to frame
+    for (auto& rgInstances : m_rgShapeInstances)
+        rgInstances.clear();
+
+    m_bInBatch = true;
+};
+
+//---------------------------------------------------------------------------
+void CShapeBatch::Draw(size_t nShape, const ShapeInstance& instance)
+{
+    if (!m_bInBatch)
+        return;
+
+    if (nShape >= m_rgShapeInstances.size())
+        m_rgShapeInstances.resize(nShape + 1); // note - may throw an exception
+
+    m_rgShapeInstances[nShape].push_back(instance); // note - may throw an exception
+};
+
+//---------------------------------------------------------------------------
+void CShapeBatch::End(void) noexcept
+{
+    m_nInstancesDrawn = 0;
+    m_nSubmissions    = 0;
+
+    for (size_t nShape = 0; nShape < m_rgShapeInstances.size(); nShape++)
+    {
+        const auto& rgInstances = m_rgShapeInstances[nShape];
+        if (rgInstances.empty())
+            continue;
+
+        g_theRdr.DrawShapeInstances(nShape, rgInstances.data(), rgInstances.size());
+
+        m_nInstancesDrawn += rgInstances.size();
+        m_nSubmissions++;
+    }
+
+    m_bInBatch = false;
+};
+
+} // namespace rdr
+} // namespace eng
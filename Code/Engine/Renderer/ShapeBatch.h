@@ -0,0 +1,74 @@
+/**
+ *  @file       ShapeBatch.h
+ *  @brief      CShapeBatch class interface
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ *  <b>Implementation:</b>
+ *
+ *   Placements of registered shapes (see CRenderer::RegisterShape()) drawn
+ *   between Begin() and End() are accumulated per shape and submitted with
+ *   one CRenderer::DrawShapeInstances() call per shape, e.g.:
+ *
+ *      batch.Begin();
+ *      batch.Draw(nShape, ShapeInstance{ x, y, fRadius, fDegrees, RGBA_WHITE });
+ *      ...
+ *      batch.End();
+ *
+ *   On the core profile backend each call is a single instanced draw.
+ */
+#pragma once
+
+#if !defined(__SHAPE_BATCH_H__)
+#define __SHAPE_BATCH_H__
+
+#ifndef _VECTOR_
+    #include <vector>
+#endif
+
+#ifndef __RENDERER_H__
+    #include "Engine/Renderer/Renderer.h"
+#endif
+
+namespace eng
+{
+namespace rdr
+{
+
+class CShapeBatch
+{
+    std::vector< std::vector<ShapeInstance> > m_rgShapeInstances; ///< one instance stream per shape id
+    bool                                      m_bInBatch;
+    size_t                                    m_nInstancesDrawn;  ///< instances submitted by the last End()
+    size_t                                    m_nSubmissions;     ///< draw calls issued by the last End()
+
+public:
+    /// Default Constructor
+    CShapeBatch() noexcept;
+    /// Default Destructor
+    ~CShapeBatch() = default;
+
+    void   Begin (void) noexcept;
+
+    void   Draw  (size_t nShape, const ShapeInstance& instance);
+
+    void   End   (void) noexcept;
+
+    constexpr size_t get_InstancesDrawn (void) const noexcept
+    { return m_nInstancesDrawn; };
+
+    constexpr size_t get_Submissions    (void) const noexcept
+    { return m_nSubmissions; };
+
+private:
+    /// Copy constructor
+    CShapeBatch(const CShapeBatch&) = delete;
+    /// Assignment operator
+    CShapeBatch& operator=(const CShapeBatch&) = delete;
+};
+
+} // namespace rdr
+} // namespace eng
+
+#endif
@@ -0,0 +1,86 @@
+/**
+ *  @file       SpriteBatch.cpp
+ *  @brief      CSpriteBatch class implementation
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ */
+
+#include "targetver.h"   // this needs to be the 1st header included
+
+#include "SpriteBatch.h"
+
+namespace eng
+{
+namespace rdr
+{
+
+//---------------------------------------------------------------------------
+CSpriteBatch::CSpriteBatch(const CTextureAtlas& atlas)
+    : m_Atlas(atlas),
+      m_rgPageVertices(),
+      m_bInBatch(false),
+      m_nSpritesDrawn(0),
+      m_nSubmissions(0)
+{
+};
+
+//---------------------------------------------------------------------------
+void CSpriteBatch::Begin(void) noexcept
+{
+    // keep the capacity of each page stream from frame to frame
+    for (auto& rgVertices : m_rgPageVertices)
+        rgVertices.clear();
+
+    m_bInBatch = true;
+};
+
+//---------------------------------------------------------------------------
+void CSpriteBatch::Draw(const CAABB2& aabb, const SpriteRegion& region, const ColorRGBA& clrTint)
+{
+    if (!m_bInBatch)
+        return;
+
+    if (region.nPage >= m_rgPageVertices.size())
+        m_rgPageVertices.resize(m_Atlas.get_PageCount()); // note - may throw an exception
+
+    if (region.nPage >= m_rgPageVertices.size())
+        return;
+
+    const math::CVector2f& vMin    = aabb.get_Min();
+    const math::CVector2f& vMax    = aabb.get_Max();
+    const math::CVector2f& vTCMins = region.vTexCoordMins;
+    const math::CVector2f& vTCMaxs = region.vTexCoordMaxs;
+
+    // same winding & texture orientation as CRenderer::DrawTexturedAABB
+    auto& rgVertices = m_rgPageVertices[region.nPage];
+    rgVertices.push_back(TexturedVertex{ vMin.X, vMin.Y, vTCMins.X, vTCMaxs.Y, clrTint });
+    rgVertices.push_back(TexturedVertex{ vMax.X, vMin.Y, vTCMaxs.X, vTCMaxs.Y, clrTint });
+    rgVertices.push_back(TexturedVertex{ vMax.X, vMax.Y, vTCMaxs.X, vTCMins.Y, clrTint });
+    rgVertices.push_back(TexturedVertex{ vMin.X, vMax.Y, vTCMins.X, vTCMins.Y, clrTint });
+};
+
+//---------------------------------------------------------------------------
+void CSpriteBatch::End(void) noexcept
+{
+    m_nSpritesDrawn = 0;
+    m_nSubmissions  = 0;
+
+    for (size_t nPage = 0; nPage < m_rgPageVertices.size(); nPage++)
+    {
+        const auto& rgVertices = m_rgPageVertices[nPage];
+        if (rgVertices.empty())
+            continue;
+
+        g_theRdr.DrawTexturedQuads(m_Atlas.GetPageTextureID(nPage), rgVertices.data(), rgVertices.size());
+
+        m_nSpritesDrawn += rgVertices.size() / 4;
+        m_nSubmissions++;
+    }
+
+    m_bInBatch = false;
+};
+
+} // namespace rdr
+} // namespace eng
@@ -0,0 +1,78 @@
+/**
+ *  @file       SpriteBatch.h
+ *  @brief      CSpriteBatch class interface
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ *  <b>Implementation:</b>
+ *
+ *   Sprites drawn between Begin() and End() are accumulated per atlas page and
+ *   submitted with one CRenderer::DrawTexturedQuads() call per page, e.g.:
+ *
+ *      batch.Begin();
+ *      batch.Draw(aabbDigit, *atlas.GetRegion(iDigit), RGBA_WHITE);
+ *      ...
+ *      batch.End();
+ *
+ *   Draw order is preserved within a page, but not across pages.
+ */
+#pragma once
+
+#if !defined(__SPRITE_BATCH_H__)
+#define __SPRITE_BATCH_H__
+
+#ifndef _VECTOR_
+    #include <vector>
+#endif
+
+#ifndef __RENDERER_H__
+    #include "Engine/Renderer/Renderer.h"
+#endif
+
+#ifndef __TEXTURE_ATLAS_H__
+    #include "Engine/Renderer/TextureAtlas.h"
+#endif
+
+namespace eng
+{
+namespace rdr
+{
+
+class CSpriteBatch
+{
+    const CTextureAtlas&                       m_Atlas;
+    std::vector< std::vector<TexturedVertex> > m_rgPageVertices; ///< one vertex stream per atlas page
+    bool                                       m_bInBatch;
+    size_t                                     m_nSpritesDrawn;  ///< sprites submitted by the last End()
+    size_t                                     m_nSubmissions;   ///< draw calls issued by the last End()
+
+public:
+    /// Conversion Constructor
+    explicit CSpriteBatch(const CTextureAtlas& atlas);
+    /// Default Destructor
+    ~CSpriteBatch() = default;
+
+    void   Begin (void) noexcept;
+
+    void   Draw  (const CAABB2& aabb, const SpriteRegion& region, const ColorRGBA& clrTint);
+
+    void   End   (void) noexcept;
+
+    constexpr size_t get_SpritesDrawn (void) const noexcept
+    { return m_nSpritesDrawn; };
+
+    constexpr size_t get_Submissions  (void) const noexcept
+    { return m_nSubmissions; };
+
+private:
+    /// Copy constructor
+    CSpriteBatch(const CSpriteBatch&) = delete;
+    /// Assignment operator
+    CSpriteBatch& operator=(const CSpriteBatch&) = delete;
+};
+
+} // namespace rdr
+} // namespace eng
+
+#endif
@@ -15,37 +15,131 @@
 #include <windows.h>
 #include <gl/gl.h>
 
+#include <climits>
+
 #include "stb_image.h"
 
+#include "Engine/Utility/Hash.h"
+
+#include "MipChain.h"
+#include "Renderer.h"
 #include "Texture.h"
+#include "TextureManager.h"
+
+#ifndef GL_CLAMP_TO_EDGE
+    #define GL_CLAMP_TO_EDGE 0x812F  // OpenGL 1.2; GL_CLAMP does not exist in a core profile
+#endif
+
+#ifndef GL_TEXTURE_MAX_LEVEL
+    #define GL_TEXTURE_MAX_LEVEL 0x813D  // OpenGL 1.2
+#endif
+
+// OpenGL 3.0 / 3.3; a core profile has no GL_LUMINANCE or GL_LUMINANCE_ALPHA
+#ifndef GL_RG
+    #define GL_RG                   0x8227
+#endif
+
+#ifndef GL_R8
+    #define GL_R8                   0x8229
+#endif
+
+#ifndef GL_RG8
+    #define GL_RG8                  0x822B
+#endif
+
+#ifndef GL_TEXTURE_SWIZZLE_RGBA
+    #define GL_TEXTURE_SWIZZLE_RGBA 0x8E46
+#endif
 
 namespace eng
 {
 namespace rdr
 {
 //---------------------------------------------------------------------------
-std::map< std::string, CTexture* >  CTexture::s_mapRegistry;
+bool CTexture::Init(const char* szImageFilePath)
+{
+    int numComponentsRequested = STBI_default; // don't care; we support 3 (RGB) or 4 (RGBA)
+    int iWidth = 0, iHeight = 0, iComponents = 0;
+    unsigned char* pImageData  = stbi_load(szImageFilePath, &iWidth, &iHeight, &iComponents, numComponentsRequested);
+
+    const bool bReturn = InitFromTexels(pImageData, iWidth, iHeight, iComponents);
+    stbi_image_free(pImageData);
+
+    return bReturn;
+}
+
 
 //---------------------------------------------------------------------------
-constexpr CTexture::CTexture() noexcept
-    : m_nOpenGLTextureID(0),
-      m_vTexelSize(0, 0),
-      m_iComponents(0)
+// Decodes an encoded image (png, tga, ...) already in memory, typically a
+//  view into a mapped asset pack; stb_image reads it in place.
+//
+bool CTexture::InitFromMemory(const unsigned char* pEncoded, size_t nBytes)
 {
-};
+    unsigned char* pImageData = nullptr;
+    int iWidth = 0, iHeight = 0, iComponents = 0;
+
+    if (pEncoded && nBytes > 0 && nBytes <= static_cast<size_t>(INT_MAX))
+    {
+        pImageData = stbi_load_from_memory(pEncoded, static_cast<int>(nBytes),
+                                           &iWidth, &iHeight, &iComponents, STBI_default);
+    }
+
+    const bool bReturn = InitFromTexels(pImageData, iWidth, iHeight, iComponents);
+    stbi_image_free(pImageData);
+
+    return bReturn;
+}
+
 
 //---------------------------------------------------------------------------
-bool CTexture::Init(const char* szImageFilePath)
+// Uploads already decoded, tightly packed texels (1 to 4 components) to a
+//  new GL texture along with a generated mip chain; the caller keeps
+//  ownership of pImageData
+//
+bool CTexture::InitFromTexels(const unsigned char* pImageData, int iWidth, int iHeight, int iComponents)
 {
-    bool bReturn = false;
+    CMipChain chain;
+    bool      bChain = false;
 
-    int numComponentsRequested = STBI_default; // don't care; we support 3 (RGB) or 4 (RGBA)
-    unsigned char* pImageData  = stbi_load(szImageFilePath, &m_vTexelSize.X, &m_vTexelSize.Y, &m_iComponents, numComponentsRequested);
+    try
+    {
+        bChain = chain.Build(pImageData, iWidth, iHeight, iComponents); // note - may throw an exception
+    }
+    catch (...)
+    {
+        // out of memory for the chain; level 0 alone still makes a usable texture
+        bChain = false;
+    }
+
+    return Upload(pImageData, iWidth, iHeight, iComponents, bChain ? &chain : nullptr);
+}
 
-    if (pImageData)
+
+//---------------------------------------------------------------------------
+// Uploads a mip chain built ahead of time, e.g. off the GL thread
+//
+bool CTexture::InitFromMipChain(const CMipChain& chain)
+{
+    if (chain.get_LevelCount() == 0)
+        return false;
+
+    const MipLevel& base = chain.get_Level(0);
+    return Upload(chain.get_Texels(0), base.iWidth, base.iHeight, chain.get_Components(), &chain);
+}
+
+
+//---------------------------------------------------------------------------
+bool CTexture::Upload(const unsigned char* pImageData, int iWidth, int iHeight, int iComponents, const CMipChain* pChain)
+{
+    bool bReturn = false;
+
+    if (pImageData && iWidth > 0 && iHeight > 0 && iComponents >= STBI_grey && iComponents <= STBI_rgb_alpha)
     {
-        // Enable texturing
-        glEnable(GL_TEXTURE_2D);
+        const size_t nLevels = pChain ? pChain->get_LevelCount() : 1;
+
+        m_vTexelSize  = math::CVector2i(iWidth, iHeight);
+        m_iComponents = iComponents;
+        m_nByteSize   = pChain ? pChain->get_ByteSize() : static_cast<size_t>(iWidth) * iHeight * iComponents;
 
         // Tell OpenGL that our pixel data is single-byte aligned
         glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
@@ -57,12 +151,13 @@ bool CTexture::Init(const char* szImageFilePath)
         glBindTexture(GL_TEXTURE_2D, m_nOpenGLTextureID);
 
         // Set texture clamp vs. wrap (repeat)
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP); // one of: GL_CLAMP or GL_REPEAT
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP); // one of: GL_CLAMP or GL_REPEAT
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE); // one of: GL_CLAMP_TO_EDGE or GL_REPEAT
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE); // one of: GL_CLAMP_TO_EDGE or GL_REPEAT
 
         // Set magnification (texel > pixel) and minification (texel < pixel) filters
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST); // one of: GL_NEAREST, GL_LINEAR
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);  // one of: GL_NEAREST, GL_LINEAR, GL_NEAREST_MIPMAP_NEAREST, GL_NEAREST_MIPMAP_LINEAR, GL_LINEAR_MIPMAP_NEAREST, GL_LINEAR_MIPMAP_LINEAR
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, (nLevels > 1) ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);  // one of: GL_NEAREST, GL_LINEAR, GL_NEAREST_MIPMAP_NEAREST, GL_NEAREST_MIPMAP_LINEAR, GL_LINEAR_MIPMAP_NEAREST, GL_LINEAR_MIPMAP_LINEAR
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(nLevels - 1));
 
         GLenum bufferFormat = GL_RGBA; // the format our source pixel data is currently in; any of: GL_RGB, GL_RGBA, GL_LUMINANCE, GL_LUMINANCE_ALPHA, ...
         if (m_iComponents == STBI_rgb )
@@ -79,6 +174,19 @@ bool CTexture::Init(const char* szImageFilePath)
 
         GLenum internalFormat = bufferFormat; // the format we want the texture to me on the card; allows us to translate into a different texture format as we upload to OpenGL
 
+        // the core profile keeps grey images in red / red-green textures and
+        //  swizzles them back to luminance (alpha) when sampled
+        if (g_theRdr.get_Backend() == RB_CORE_PROFILE_33 && (m_iComponents == STBI_grey || m_iComponents == STBI_grey_alpha))
+        {
+            static const GLint k_rgGreySwizzle[4]      = { GL_RED, GL_RED, GL_RED, GL_ONE };
+            static const GLint k_rgGreyAlphaSwizzle[4] = { GL_RED, GL_RED, GL_RED, GL_GREEN };
+
+            const bool bAlpha = (m_iComponents == STBI_grey_alpha);
+            bufferFormat   = bAlpha ? GL_RG  : GL_RED;
+            internalFormat = bAlpha ? GL_RG8 : GL_R8;
+            glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, bAlpha ? k_rgGreyAlphaSwizzle : k_rgGreySwizzle);
+        }
+
         // Upload this pixel data to our new OpenGL texture
         glTexImage2D(GL_TEXTURE_2D,     // Creating this as a 2d texture
                      0,                 // Which mipmap level to use as the "root" (0 = the highest-quality, full-res image), if mipmaps are enabled
@@ -90,7 +198,14 @@ bool CTexture::Init(const char* szImageFilePath)
                      GL_UNSIGNED_BYTE,  // Pixel color components are unsigned bytes (one byte per color/alpha channel)
                      pImageData);	    // Location of the actual pixel data bytes/buffer
 
-        stbi_image_free(pImageData);
+        // levels 1..n were filtered on the CPU; GL 1.1 has no glGenerateMipmap
+        for (size_t n = 1; n < nLevels; n++)
+        {
+            const MipLevel& level = pChain->get_Level(n);
+            glTexImage2D(GL_TEXTURE_2D, static_cast<GLint>(n), internalFormat, level.iWidth, level.iHeight, 0,
+                         bufferFormat, GL_UNSIGNED_BYTE, pChain->get_Texels(n));
+        }
+
         bReturn = true;
     }
 
@@ -98,19 +213,29 @@ bool CTexture::Init(const char* szImageFilePath)
 }
 
 
+//---------------------------------------------------------------------------
+void CTexture::Release(void) noexcept
+{
+    if (m_nOpenGLTextureID)
+    {
+        glDeleteTextures(1, (GLuint*) &m_nOpenGLTextureID);
+        m_nOpenGLTextureID = 0;
+    }
+    m_vTexelSize  = math::CVector2i(0, 0);
+    m_iComponents = 0;
+    m_nByteSize   = 0;
+}
+
+
 //---------------------------------------------------------------------------
 // Returns a pointer to the already-loaded texture of a given image file,
 //	or nullptr if no such texture/image has been loaded.
 //
-CTexture* CTexture::GetTextureByName(const char* szImageFilePath)
+const CTexture* CTexture::GetTextureByName(const char* szImageFilePath)
 {
-    CTexture* pRetResult = nullptr;
-
-    auto it = CTexture::s_mapRegistry.find(szImageFilePath);
-    if (it != CTexture::s_mapRegistry.end())
-        pRetResult = it->second;
+    CTextureManager& mgr = GetTextureManager();
 
-    return pRetResult;
+    return mgr.Get( mgr.Find(util::HashPath(szImageFilePath)) );
 }
 
 
@@ -118,30 +243,12 @@ CTexture* CTexture::GetTextureByName(const char* szImageFilePath)
 // Finds the named Texture among the registry of those already loaded; if
 //	found, returns that Texture*.  If not, attempts to load that texture,
 //	and returns a Texture* just created (or nullptr if unable to load file).
+//  The texture is pinned by a single reference however many times it is
+//  requested, so it stays resident.
 //
-CTexture* CTexture::CreateOrGetTexture(const char* szImageFilePath)
+const CTexture* CTexture::CreateOrGetTexture(const char* szImageFilePath)
 {
-    CTexture* pRetResult = CTexture::GetTextureByName(szImageFilePath);
-
-    if (pRetResult == nullptr)
-    {
-        pRetResult = new CTexture();
-        if (pRetResult)
-        {
-            if (pRetResult->Init (szImageFilePath))
-            {
-                CTexture::s_mapRegistry[szImageFilePath] = pRetResult;
-            }
-            else 
-            {
-                // handle the error
-                delete pRetResult;
-                pRetResult = nullptr;
-            }
-        }
-    }
-
-    return pRetResult;
+    return GetTextureManager().AcquirePinned(szImageFilePath); // note - may throw an exception
 }
 
 }
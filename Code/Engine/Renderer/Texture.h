@@ -11,20 +11,20 @@
  *   Subsequent calls to CreateOrGetTexture() with the same name return a pointer to the 
  *          already-loaded texture (and do not load it a second time).
  *
+ *   Both static functions are thin wrappers over CTextureManager (see
+ *   TextureManager.h); code that needs to release textures should hold a
+ *   TextureHandle from CTextureManager::Acquire() instead.
+ *
+ *   Every texture is uploaded with a full mip chain (see MipChain.h) and
+ *   sampled with GL_LINEAR_MIPMAP_LINEAR, so sprites drawn smaller than
+ *   their source do not alias.
+ *
  */
 #pragma once
 
 #if !defined(__TEXTURE_H__)
 #define __TEXTURE_H__
 
-#ifndef _MAP_
-    #include <map>
-#endif
-
-#ifndef _STRING_
-    #include <string>
-#endif
-
 #ifndef __VECTOR2_H__
     #include "Engine/Math/Vector2.h"
 #endif
@@ -35,24 +35,53 @@ namespace eng
 namespace rdr
 {
 
+class CMipChain;
+
 class CTexture
 {
-    static std::map< std::string, CTexture*> s_mapRegistry;
     unsigned int                             m_nOpenGLTextureID; ///< Holds the ID of the texture object
     math::CVector2i                          m_vTexelSize;
     int                                      m_iComponents;      ///< RGBA Components
+    size_t                                   m_nByteSize;        ///< every mip level
 
 public:
     constexpr CTexture() noexcept;
     ~CTexture() = default;
 
     bool                   Init              (const char* szImageFilePath);
+    bool                   InitFromMemory    (const unsigned char* pEncoded, size_t nBytes);
+    bool                   InitFromTexels    (const unsigned char* pTexels, int iWidth, int iHeight, int iComponents);
+    bool                   InitFromMipChain  (const CMipChain& chain);
+/**
+ *  @brief deletes the GL texture object; the GL name is not owned by the
+ *         destructor since copies of a CTexture share it
+ */
+    void                   Release           (void) noexcept;
+
     constexpr unsigned int get_TextureID     (void) const noexcept;
 
-    static CTexture*       GetTextureByName  (const char* szImageFilePath);
-    static CTexture*       CreateOrGetTexture(const char* szImageFilePath);
+    constexpr const math::CVector2i& get_TexelSize (void) const noexcept
+    { return m_vTexelSize; };
+
+    /// bytes of texel data uploaded to the GL, mip levels included
+    constexpr size_t       get_ByteSize      (void) const noexcept
+    { return m_nByteSize; };
+
+    static const CTexture* GetTextureByName  (const char* szImageFilePath);
+    static const CTexture* CreateOrGetTexture(const char* szImageFilePath);
+
+private:
+    bool                   Upload            (const unsigned char* pImageData, int iWidth, int iHeight,
+                                              int iComponents, const CMipChain* pChain);
 };
 
+constexpr CTexture::CTexture() noexcept
+    : m_nOpenGLTextureID(0),
+      m_vTexelSize(0, 0),
+      m_iComponents(0),
+      m_nByteSize(0)
+{ };
+
 constexpr unsigned int 
 CTexture::get_TextureID  (void) const noexcept
 { return m_nOpenGLTextureID; };
@@ -0,0 +1,389 @@
+/**
+ *  @file       TextureAtlas.cpp
+ *  @brief      CTextureAtlas class implementation
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ *  <b>Cite:</b>
+ *
+ *  @sa Jukka Jylanki, "A Thousand Ways to Pack the Bin", 2010
+ */
+
+#define WIN32_LEAN_AND_MEAN
+#include "targetver.h"   // this needs to be the 1st header included
+
+#include <windows.h>
+#include <gl/gl.h>
+#include <algorithm>
+#include <limits>
+#include <cstring>
+
+#include "stb_image.h"
+
+#include "TextureAtlas.h"
+
+#ifndef GL_CLAMP_TO_EDGE
+    #define GL_CLAMP_TO_EDGE 0x812F
+#endif
+
+namespace eng
+{
+namespace rdr
+{
+
+constexpr int k_iAtlasComponents = STBI_rgb_alpha; // all pages are stored as RGBA
+
+//---------------------------------------------------------------------------
+CTextureAtlas::CTextureAtlas(int iPageSize /* = 1024 */, int iPadding /* = 1 */)
+    : m_iPageSize(iPageSize),
+      m_iPadding(iPadding),
+      m_bBuilt(false),
+      m_rgImages(),
+      m_rgRegions(),
+      m_rgPages()
+{
+};
+
+//---------------------------------------------------------------------------
+CTextureAtlas::~CTextureAtlas()
+{
+    Release();
+};
+
+//---------------------------------------------------------------------------
+void CTextureAtlas::Release(void) noexcept
+{
+    for (auto& page : m_rgPages)
+    {
+        if (page.nTextureID)
+        {
+            glDeleteTextures(1, (GLuint*) &page.nTextureID);
+            page.nTextureID = 0;
+        }
+    }
+};
+
+//---------------------------------------------------------------------------
+int CTextureAtlas::RegisterImage(const char* szImageFilePath)
+{
+    int iReturn = -1;
+
+    if (!m_bBuilt && szImageFilePath)
+    {
+        // don't load the same image twice
+        iReturn = FindImage(szImageFilePath);
+        if (iReturn >= 0)
+            return iReturn;
+
+        Image image;
+        int   iComponents = 0;
+        unsigned char* pImageData = stbi_load(szImageFilePath, &image.vSize.X, &image.vSize.Y,
+                                              &iComponents, k_iAtlasComponents);
+        if (pImageData)
+        {
+            image.strName = szImageFilePath;
+            image.rgTexels.assign(pImageData, pImageData + (image.vSize.X * image.vSize.Y * k_iAtlasComponents));
+            image.nPage   = 0;
+            stbi_image_free(pImageData);
+
+            m_rgImages.push_back(std::move(image)); // note - may throw an exception
+            iReturn = static_cast<int>(m_rgImages.size() - 1);
+        }
+    }
+
+    return iReturn;
+}
+
+//---------------------------------------------------------------------------
+int CTextureAtlas::RegisterTexels(const char* szName, int iWidth, int iHeight,
+                                  const unsigned char* pTexels)
+{
+    int iReturn = -1;
+
+    if (!m_bBuilt && szName && pTexels && iWidth > 0 && iHeight > 0)
+    {
+        iReturn = FindImage(szName);
+        if (iReturn >= 0)
+            return iReturn;
+
+        Image image;
+        image.strName = szName;
+        image.vSize   = math::CVector2i(iWidth, iHeight);
+        image.rgTexels.assign(pTexels, pTexels + (iWidth * iHeight * k_iAtlasComponents)); // note - may throw an exception
+        image.nPage   = 0;
+
+        m_rgImages.push_back(std::move(image)); // note - may throw an exception
+        iReturn = static_cast<int>(m_rgImages.size() - 1);
+    }
+
+    return iReturn;
+}
+
+//---------------------------------------------------------------------------
+bool CTextureAtlas::Build(void)
+{
+    if (m_bBuilt)
+        return true;
+
+    // pack the tallest images first, it keeps the skyline flat
+    std::vector<size_t> rgOrder(m_rgImages.size());
+    for (size_t i = 0; i < rgOrder.size(); i++)
+        rgOrder[i] = i;
+
+    std::stable_sort(rgOrder.begin(), rgOrder.end(), [this](size_t a, size_t b)
+    {
+        return m_rgImages[a].vSize.Y > m_rgImages[b].vSize.Y;
+    });
+
+    for (auto nImage : rgOrder)
+    {
+        if (!Insert(m_rgImages[nImage]))
+        {
+            // nothing has been uploaded yet; drop the partly packed pages so
+            //  a failed Build() leaves the atlas as it was
+            m_rgPages.clear();
+            return false;
+        }
+    }
+
+    UploadPages();
+
+    const float fInvPageSize = 1.f / static_cast<float>(m_iPageSize);
+
+    m_rgRegions.resize(m_rgImages.size());
+    for (size_t i = 0; i < m_rgImages.size(); i++)
+    {
+        const Image&  image  = m_rgImages[i];
+        SpriteRegion& region = m_rgRegions[i];
+
+        region.nPage         = image.nPage;
+        region.vTexelSize    = image.vSize;
+        region.vTexCoordMins = math::CVector2f(image.vPosition.X * fInvPageSize,
+                                               image.vPosition.Y * fInvPageSize);
+        region.vTexCoordMaxs = math::CVector2f((image.vPosition.X + image.vSize.X) * fInvPageSize,
+                                               (image.vPosition.Y + image.vSize.Y) * fInvPageSize);
+
+        // the texels now live on the card
+        std::vector<unsigned char>().swap(m_rgImages[i].rgTexels);
+    }
+
+    m_bBuilt = true;
+    return true;
+}
+
+//---------------------------------------------------------------------------
+const SpriteRegion* CTextureAtlas::GetRegion(int iIndex) const noexcept
+{
+    const SpriteRegion* pRetResult = nullptr;
+
+    if (m_bBuilt && iIndex >= 0 && static_cast<size_t>(iIndex) < m_rgRegions.size())
+        pRetResult = &m_rgRegions[iIndex];
+
+    return pRetResult;
+}
+
+//---------------------------------------------------------------------------
+const SpriteRegion* CTextureAtlas::GetRegionByName(const char* szImageFilePath) const noexcept
+{
+    const SpriteRegion* pRetResult = nullptr;
+
+    if (m_bBuilt && szImageFilePath)
+    {
+        for (size_t i = 0; i < m_rgImages.size(); i++)
+        {
+            if (m_rgImages[i].strName == szImageFilePath)
+            {
+                pRetResult = &m_rgRegions[i];
+                break;
+            }
+        }
+    }
+
+    return pRetResult;
+}
+
+//---------------------------------------------------------------------------
+unsigned int CTextureAtlas::GetPageTextureID(size_t nPage) const noexcept
+{
+    return (nPage < m_rgPages.size()) ? m_rgPages[nPage].nTextureID : 0;
+}
+
+//---------------------------------------------------------------------------
+int CTextureAtlas::FindImage(const char* szName) const noexcept
+{
+    for (size_t i = 0; i < m_rgImages.size(); i++)
+    {
+        if (m_rgImages[i].strName == szName)
+            return static_cast<int>(i);
+    }
+    return -1;
+}
+
+//---------------------------------------------------------------------------
+// Places an image on the first page with room for it, opening a new page
+//  if none of the existing pages can hold it.
+//
+bool CTextureAtlas::Insert(Image& image)
+{
+    const int iWidth  = image.vSize.X + 2 * m_iPadding;
+    const int iHeight = image.vSize.Y + 2 * m_iPadding;
+
+    if (iWidth > m_iPageSize || iHeight > m_iPageSize)
+        return false;
+
+    for (size_t nPage = 0; ; nPage++)
+    {
+        if (nPage == m_rgPages.size())
+        {
+            Page page;
+            page.nTextureID = 0;
+            page.rgSkyline.push_back(SkylineNode{ 0, 0, m_iPageSize });
+            m_rgPages.push_back(std::move(page)); // note - may throw an exception
+        }
+
+        int    iX    = 0;
+        int    iY    = 0;
+        size_t nNode = 0;
+        if (FindPosition(m_rgPages[nPage], iWidth, iHeight, iX, iY, nNode))
+        {
+            AddSkylineLevel(m_rgPages[nPage], nNode, iX, iY, iWidth, iHeight);
+
+            image.nPage     = nPage;
+            image.vPosition = math::CVector2i(iX + m_iPadding, iY + m_iPadding);
+            return true;
+        }
+    }
+}
+
+//---------------------------------------------------------------------------
+// Skyline bottom-left: pick the node that leaves the rectangle's bottom edge
+//  highest up the page (smallest Y), breaking ties with the narrowest node.
+//
+bool CTextureAtlas::FindPosition(const Page& page, int iWidth, int iHeight,
+                                 int& iBestX, int& iBestY, size_t& nBestNode) const noexcept
+{
+    int  iBestBottom = std::numeric_limits<int>::max();
+    int  iBestWidth  = std::numeric_limits<int>::max();
+    bool bFound      = false;
+
+    const auto& rgSkyline = page.rgSkyline;
+    for (size_t i = 0; i < rgSkyline.size(); i++)
+    {
+        const int iX = rgSkyline[i].iX;
+        if (iX + iWidth > m_iPageSize)
+            break;
+
+        // the rectangle rests on the highest node it spans
+        int iY         = 0;
+        int iRemaining = iWidth;
+        for (size_t j = i; iRemaining > 0; j++)
+        {
+            iY          = std::max(iY, rgSkyline[j].iY);
+            iRemaining -= rgSkyline[j].iWidth;
+        }
+
+        if (iY + iHeight > m_iPageSize)
+            continue;
+
+        if ((iY + iHeight < iBestBottom) ||
+            (iY + iHeight == iBestBottom && rgSkyline[i].iWidth < iBestWidth))
+        {
+            iBestBottom = iY + iHeight;
+            iBestWidth  = rgSkyline[i].iWidth;
+            iBestX      = iX;
+            iBestY      = iY;
+            nBestNode   = i;
+            bFound      = true;
+        }
+    }
+
+    return bFound;
+}
+
+//---------------------------------------------------------------------------
+void CTextureAtlas::AddSkylineLevel(Page& page, size_t nNode, int iX, int iY, int iWidth, int iHeight)
+{
+    auto& rgSkyline = page.rgSkyline;
+
+    rgSkyline.insert(rgSkyline.begin() + nNode, SkylineNode{ iX, iY + iHeight, iWidth });
+
+    // trim or remove the nodes now covered by the new level
+    for (size_t i = nNode + 1; i < rgSkyline.size(); )
+    {
+        const int iPrevRight = rgSkyline[i - 1].iX + rgSkyline[i - 1].iWidth;
+        if (rgSkyline[i].iX >= iPrevRight)
+            break;
+
+        const int iShrink = iPrevRight - rgSkyline[i].iX;
+        rgSkyline[i].iX     += iShrink;
+        rgSkyline[i].iWidth -= iShrink;
+
+        if (rgSkyline[i].iWidth <= 0)
+        {
+            rgSkyline.erase(rgSkyline.begin() + i);
+            continue;
+        }
+        break;
+    }
+
+    // merge neighbouring nodes at the same level
+    for (size_t i = 0; i + 1 < rgSkyline.size(); )
+    {
+        if (rgSkyline[i].iY == rgSkyline[i + 1].iY)
+        {
+            rgSkyline[i].iWidth += rgSkyline[i + 1].iWidth;
+            rgSkyline.erase(rgSkyline.begin() + i + 1);
+        }
+        else
+        {
+            i++;
+        }
+    }
+}
+
+//---------------------------------------------------------------------------
+void CTextureAtlas::UploadPages(void)
+{
+    const size_t nRowBytes = static_cast<size_t>(m_iPageSize) * k_iAtlasComponents;
+    std::vector<unsigned char> rgPageTexels(nRowBytes * m_iPageSize);
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    for (size_t nPage = 0; nPage < m_rgPages.size(); nPage++)
+    {
+        std::fill(rgPageTexels.begin(), rgPageTexels.end(), static_cast<unsigned char>(0));
+
+        for (const auto& image : m_rgImages)
+        {
+            if (image.nPage != nPage)
+                continue;
+
+            const size_t nImageRowBytes = static_cast<size_t>(image.vSize.X) * k_iAtlasComponents;
+            for (int iRow = 0; iRow < image.vSize.Y; iRow++)
+            {
+                unsigned char* pDest = &rgPageTexels[(image.vPosition.Y + iRow) * nRowBytes +
+                                                     image.vPosition.X * k_iAtlasComponents];
+                memcpy(pDest, &image.rgTexels[iRow * nImageRowBytes], nImageRowBytes);
+            }
+        }
+
+        Page& page = m_rgPages[nPage];
+        glGenTextures(1, (GLuint*) &page.nTextureID);
+        glBindTexture(GL_TEXTURE_2D, page.nTextureID);
+
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, m_iPageSize, m_iPageSize, 0,
+                     GL_RGBA, GL_UNSIGNED_BYTE, rgPageTexels.data());
+
+        // the skyline is only needed while packing
+        std::vector<SkylineNode>().swap(page.rgSkyline);
+    }
+}
+
+} // namespace rdr
+} // namespace eng
@@ -0,0 +1,161 @@
+/**
+ *  @file       TextureAtlas.h
+ *  @brief      CTextureAtlas class interface
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ *  <b>Implementation:</b>
+ *
+ *   Images are registered with CTextureAtlas::RegisterImage(), or as texels
+ *   generated in memory with CTextureAtlas::RegisterTexels(), and packed into
+ *   one or more square RGBA pages by CTextureAtlas::Build().  Each registered
+ *   image is then addressed by a SpriteRegion (page + texture coordinates), so
+ *   any number of sprites sharing a page can be drawn with a single texture bind.
+ *
+ *   Packing uses a skyline bottom-left heuristic with images sorted by
+ *   descending height.
+ *
+ *  <b>Cite:</b>
+ *
+ *  @sa Jukka Jylanki, "A Thousand Ways to Pack the Bin", 2010
+ */
+#pragma once
+
+#if !defined(__TEXTURE_ATLAS_H__)
+#define __TEXTURE_ATLAS_H__
+
+#ifndef _STRING_
+    #include <string>
+#endif
+
+#ifndef _VECTOR_
+    #include <vector>
+#endif
+
+#ifndef __VECTOR2_H__
+    #include "Engine/Math/Vector2.h"
+#endif
+
+namespace eng
+{
+namespace rdr
+{
+
+/**
+ * @brief location of a packed image within an atlas page
+ */
+struct SpriteRegion
+{
+    size_t          nPage;          ///< index of the atlas page holding the image
+    math::CVector2f vTexCoordMins;  ///< normalized upper-left texture coordinate
+    math::CVector2f vTexCoordMaxs;  ///< normalized lower-right texture coordinate
+    math::CVector2i vTexelSize;     ///< size of the image in texels
+};
+
+class CTextureAtlas
+{
+    struct Image
+    {
+        std::string                 strName;
+        std::vector<unsigned char>  rgTexels;   ///< RGBA texels, released after Build()
+        math::CVector2i             vSize;
+        math::CVector2i             vPosition;  ///< upper-left texel within its page
+        size_t                      nPage;
+    };
+
+    struct SkylineNode
+    {
+        int iX;
+        int iY;
+        int iWidth;
+    };
+
+    struct Page
+    {
+        unsigned int                nTextureID;
+        std::vector<SkylineNode>    rgSkyline;
+    };
+
+    int                        m_iPageSize;   ///< width & height of each page, in texels
+    int                        m_iPadding;    ///< empty texels kept around each image
+    bool                       m_bBuilt;
+    std::vector<Image>         m_rgImages;
+    std::vector<SpriteRegion>  m_rgRegions;
+    std::vector<Page>          m_rgPages;
+
+public:
+    /// Conversion Constructor
+    explicit CTextureAtlas(int iPageSize = 1024, int iPadding = 1);
+    /// Default Destructor
+    ~CTextureAtlas() noexcept;
+
+/**
+ *  @brief loads an image file to be packed into the atlas
+ *
+ *  @param [in] szImageFilePath   image file to load
+ *
+ *  @retval int     containing the region index of the image
+ *  @retval -1      on error, or if the atlas has already been built
+ */
+    int                  RegisterImage    (const char* szImageFilePath);
+
+/**
+ *  @brief copies an RGBA image to be packed into the atlas
+ *
+ *  @param [in] szName      name the region is looked up by
+ *  @param [in] iWidth      width of the image, in texels
+ *  @param [in] iHeight     height of the image, in texels
+ *  @param [in] pTexels     iWidth * iHeight RGBA texels, top row first
+ *
+ *  @retval int     containing the region index of the image
+ *  @retval -1      on error, or if the atlas has already been built
+ */
+    int                  RegisterTexels   (const char* szName, int iWidth, int iHeight,
+                                           const unsigned char* pTexels);
+
+/**
+ *  @brief packs all registered images into pages and uploads them
+ *
+ *  @retval true    on success
+ *  @retval false   if an image is larger than a page; no page is kept and
+ *                  the registered images are left in place
+ */
+    bool                 Build            (void);
+
+/**
+ *  @brief deletes the page textures; regions stay valid but draw nothing
+ *
+ *  @note - requires the rendering context the pages were uploaded on
+ */
+    void                 Release          (void) noexcept;
+
+    const SpriteRegion*  GetRegion        (int iIndex) const noexcept;
+    const SpriteRegion*  GetRegionByName  (const char* szImageFilePath) const noexcept;
+
+    unsigned int         GetPageTextureID (size_t nPage) const noexcept;
+
+    inline size_t        get_PageCount    (void) const noexcept
+    { return m_rgPages.size(); };
+
+    constexpr int        get_PageSize     (void) const noexcept
+    { return m_iPageSize; };
+
+private:
+    int                  FindImage        (const char* szName) const noexcept;
+    bool                 Insert           (Image& image);
+    bool                 FindPosition     (const Page& page, int iWidth, int iHeight,
+                                           int& iBestX, int& iBestY, size_t& nBestNode) const noexcept;
+    void                 AddSkylineLevel  (Page& page, size_t nNode, int iX, int iY, int iWidth, int iHeight);
+    void                 UploadPages      (void);
+
+    /// Copy constructor
+    CTextureAtlas(const CTextureAtlas&) = delete;
+    /// Assignment operator
+    CTextureAtlas& operator=(const CTextureAtlas&) = delete;
+};
+
+} // namespace rdr
+} // namespace eng
+
+#endif
@@ -0,0 +1,187 @@
+/**
+ *  @file       TextureCache.cpp
+ *  @brief      CTextureCache class implementation
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ */
+
+// turn off silly warnings that encourage use of xxxx_s functions
+#define _CRT_SECURE_NO_WARNINGS
+#include "targetver.h"  // this needs to be the 1st header included
+
+#include <stdio.h>
+#include <climits>
+#include <filesystem>
+#include <system_error>
+
+#include "Engine/Utility/Hash.h"
+#include "Engine/Utility/MappedFile.h"
+
+#include "MipChain.h"
+#include "Texture.h"
+#include "TextureCache.h"
+
+namespace fs = std::filesystem;
+
+namespace eng
+{
+namespace rdr
+{
+
+//---------------------------------------------------------------------------
+CTextureCache::CTextureCache(const char* szDirectory)
+    : m_strDirectory(szDirectory ? szDirectory : ""), // note - may throw an exception
+      m_Stats{}
+{
+};
+
+//---------------------------------------------------------------------------
+std::string CTextureCache::EntryPath(uint64_t nSourceKey) const
+{
+    char szName[32] = { 0 };
+    snprintf(szName, sizeof(szName) - 1, "%016llx.texc", static_cast<unsigned long long>(nSourceKey));
+
+    return (fs::path(m_strDirectory) / szName).string(); // note - may throw an exception
+};
+
+//---------------------------------------------------------------------------
+bool CTextureCache::Lookup(uint64_t nSourceKey, CTexture& texture) noexcept
+{
+    bool bHit = false;
+
+    try
+    {
+        util::CMappedFile file;
+        if (nSourceKey && file.Open(EntryPath(nSourceKey).c_str()) && file.get_Size() >= sizeof(TextureCacheHeader))
+        {
+            const TextureCacheHeader* pHdr = reinterpret_cast<const TextureCacheHeader*>(file.get_Data());
+            const uint64_t nBaseBytes  = static_cast<uint64_t>(pHdr->nWidth) * pHdr->nHeight * pHdr->nComponents;
+            const uint64_t nEntryBytes = file.get_Size() - sizeof(TextureCacheHeader);
+
+            if (pHdr->nMagic == k_nTextureCacheMagic && pHdr->nVersion == k_nTextureCacheVersion &&
+                pHdr->nSourceKey == nSourceKey && pHdr->nWidth <= INT_MAX && pHdr->nHeight <= INT_MAX &&
+                nBaseBytes <= nEntryBytes)
+            {
+                // the stored levels are uploaded from the mapping as they are
+                const unsigned char* pBase = file.get_Data() + sizeof(TextureCacheHeader);
+
+                CMipChain chain;
+                if (chain.Attach(pBase, static_cast<int>(pHdr->nWidth), static_cast<int>(pHdr->nHeight), pHdr->nComponents,
+                                 pBase + nBaseBytes, static_cast<size_t>(nEntryBytes - nBaseBytes))) // note - may throw an exception
+                {
+                    bHit = texture.InitFromMipChain(chain);
+                }
+                if (bHit)
+                    m_Stats.dSecondsSaved += pHdr->dDecodeSeconds;
+            }
+        }
+    }
+    catch (...)
+    {
+        bHit = false;
+    }
+
+    if (bHit)
+        m_Stats.nHits++;
+    else
+        m_Stats.nMisses++;
+
+    return bHit;
+};
+
+//---------------------------------------------------------------------------
+bool CTextureCache::Store(uint64_t nSourceKey, const CMipChain& chain, double dDecodeSeconds) noexcept
+{
+    m_Stats.dDecodeSeconds += dDecodeSeconds;
+
+    if (nSourceKey == 0 || chain.get_LevelCount() == 0)
+        return false;
+
+    const MipLevel& base        = chain.get_Level(0);
+    const int       iComponents = chain.get_Components();
+
+    bool bResult = false;
+
+    try
+    {
+        std::error_code ec;
+        fs::create_directories(m_strDirectory, ec);
+
+        const std::string strPath = EntryPath(nSourceKey);
+        const std::string strTemp = strPath + ".tmp";
+
+        const TextureCacheHeader hdr = { k_nTextureCacheMagic, k_nTextureCacheVersion,
+                                         static_cast<uint16_t>(iComponents),
+                                         static_cast<uint32_t>(base.iWidth), static_cast<uint32_t>(base.iHeight),
+                                         nSourceKey, dDecodeSeconds };
+        const size_t nBaseBytes  = static_cast<size_t>(base.iWidth) * base.iHeight * iComponents;
+        const size_t nLevelBytes = chain.get_LevelBytes();
+
+        FILE* pFile = fopen(strTemp.c_str(), "wb");
+        if (pFile)
+        {
+            bResult = fwrite(&hdr, sizeof(hdr), 1, pFile) == 1 &&
+                      fwrite(chain.get_Texels(0), 1, nBaseBytes, pFile) == nBaseBytes &&
+                      fwrite(chain.get_LevelTexels(), 1, nLevelBytes, pFile) == nLevelBytes;
+            bResult = (fclose(pFile) == 0) && bResult;
+
+            if (bResult)
+            {
+                fs::rename(strTemp, strPath, ec);
+                bResult = !ec;
+            }
+            if (!bResult)
+                fs::remove(strTemp, ec);
+        }
+    }
+    catch (...)
+    {
+        bResult = false;
+    }
+
+    if (bResult)
+        m_Stats.nStores++;
+    else
+        m_Stats.nStoreFailures++;
+
+    return bResult;
+};
+
+//---------------------------------------------------------------------------
+uint64_t CTextureCache::MakeFileKey(const char* szImageFilePath, uint64_t nPathHash) noexcept
+{
+    if (szImageFilePath == nullptr)
+        return 0;
+
+    uint64_t nKey = 0;
+
+    try
+    {
+        std::error_code ec;
+
+        const fs::path  pathImage(szImageFilePath);
+        const auto      tmWrite = fs::last_write_time(pathImage, ec);
+        const uintmax_t nSize   = ec ? 0 : fs::file_size(pathImage, ec);
+
+        if (!ec)
+        {
+            const auto nTicks = tmWrite.time_since_epoch().count();
+
+            nKey = util::HashBytes(&nPathHash, sizeof(nPathHash));
+            nKey = util::HashBytes(&nTicks, sizeof(nTicks), nKey);
+            nKey = util::HashBytes(&nSize,  sizeof(nSize),  nKey);
+            nKey = nKey ? nKey : 1;   // 0 is reserved for "no key"
+        }
+    }
+    catch (...)
+    {
+        nKey = 0;
+    }
+
+    return nKey;
+};
+
+} // namespace rdr
+} // namespace eng
@@ -0,0 +1,124 @@
+/**
+ *  @file       TextureCache.h
+ *  @brief      CTextureCache class interface
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ *  <b>Implementation:</b>
+ *
+ *   An on-disk cache of decoded, upload-ready texels, one file per texture:
+ *
+ *      <directory>/<source key as 16 hex digits>.texc
+ *      TextureCacheHeader, then level 0 (width * height * components bytes),
+ *      then mip levels 1..n as CMipChain::get_LevelTexels() lays them out
+ *
+ *   The source key identifies the encoded image it was decoded from (path
+ *   hash + modification time + size for a loose file, the pack entry for a
+ *   packed one), so an edited source simply misses and is re-decoded.  A
+ *   hit maps the file and passes every level straight to glTexImage2D;
+ *   neither the image decoder nor the mip filter runs.  Entries are written to a temporary file and then
+ *   renamed, so a crash never leaves a truncated entry behind.
+ *
+ *   Not thread safe; called from CTextureManager on the GL thread.
+ */
+#pragma once
+
+#if !defined(__TEXTURE_CACHE_H__)
+#define __TEXTURE_CACHE_H__
+
+#ifndef _CSTDINT_
+    #include <cstdint>
+#endif
+
+#ifndef _STRING_
+    #include <string>
+#endif
+
+namespace eng
+{
+namespace rdr
+{
+
+class CMipChain;
+class CTexture;
+
+constexpr uint32_t k_nTextureCacheMagic   = 0x31435854;   ///< 'TXC1'
+constexpr uint16_t k_nTextureCacheVersion = 2;         ///< 2 stores the mip chain
+
+struct TextureCacheHeader
+{
+    uint32_t nMagic;
+    uint16_t nVersion;
+    uint16_t nComponents;
+    uint32_t nWidth;
+    uint32_t nHeight;
+    uint64_t nSourceKey;
+    double   dDecodeSeconds;    ///< time the original decode and mip build took, credited on every hit
+};
+
+static_assert(sizeof(TextureCacheHeader) == 32, "TextureCacheHeader layout is part of the file format");
+
+struct TextureCacheStats
+{
+    size_t nHits;
+    size_t nMisses;
+    size_t nStores;
+    size_t nStoreFailures;
+    double dDecodeSeconds;      ///< spent decoding and building mips on misses
+    double dSecondsSaved;       ///< decode time avoided by hits
+
+    constexpr double get_HitRate(void) const noexcept
+    { return (nHits + nMisses) ? static_cast<double>(nHits) / static_cast<double>(nHits + nMisses) : 0.0; };
+};
+
+class CTextureCache
+{
+    std::string       m_strDirectory;
+    TextureCacheStats m_Stats;
+
+public:
+/**
+ *  @param [in] szDirectory     created on first use if it does not exist
+ *
+ *  @note - may throw an exception
+ */
+    explicit CTextureCache(const char* szDirectory);
+
+/**
+ *  @brief uploads the cached texels for nSourceKey into texture
+ *
+ *  @retval true    on a hit
+ *  @retval false   on a miss; the caller decodes and calls Store()
+ */
+    bool        Lookup          (uint64_t nSourceKey, CTexture& texture) noexcept;
+
+/**
+ *  @brief writes a decoded image's full mip chain for later runs and
+ *         records the time it took to produce
+ *
+ *  @retval true    if the entry was written
+ */
+    bool        Store           (uint64_t nSourceKey, const CMipChain& chain, double dDecodeSeconds) noexcept;
+
+    constexpr const TextureCacheStats& get_Stats(void) const noexcept
+    { return m_Stats; };
+
+/**
+ *  @retval uint64_t    key for a loose image file, 0 if the file cannot be examined
+ */
+    static uint64_t MakeFileKey (const char* szImageFilePath, uint64_t nPathHash) noexcept;
+
+private:
+    std::string EntryPath       (uint64_t nSourceKey) const;
+
+    /// Copy constructor
+    CTextureCache(const CTextureCache&) = delete;
+    /// Assignment operator
+    CTextureCache& operator=(const CTextureCache&) = delete;
+};
+
+} // namespace rdr
+} // namespace eng
+
+#endif
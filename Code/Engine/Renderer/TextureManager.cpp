@@ -0,0 +1,488 @@
+/**
+ *  @file       TextureManager.cpp
+ *  @brief      CTextureManager class implementation
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ * <b>Cite:</b>
+ *
+ * @sa https://en.wikipedia.org/wiki/Linear_probing#Deletion
+ */
+
+#include "targetver.h"   // this needs to be the 1st header included
+
+#include <climits>
+
+#include "stb_image.h"
+
+#include "Engine/Utility/Hash.h"
+#include "Engine/Utility/TimeUtils.h"
+
+#include "MipChain.h"
+#include "TextureCache.h"
+#include "TextureManager.h"
+
+namespace eng
+{
+namespace rdr
+{
+
+constexpr size_t k_nInitialBuckets = 64;
+
+//---------------------------------------------------------------------------
+static inline size_t BucketIndex(uint64_t nPathHash, size_t nMask) noexcept
+{
+    // fold the high half in; FNV's low bits alone cluster on similar paths
+    return static_cast<size_t>(nPathHash ^ (nPathHash >> 32)) & nMask;
+};
+
+//---------------------------------------------------------------------------
+CTextureManager::CTextureManager(size_t nBudget /* = k_nDefaultTextureBudget */)
+    : m_rgSlots(),
+      m_rgFreeSlots(),
+      m_rgBuckets(k_nInitialBuckets, Bucket{ 0, k_nEmptyBucket }), // note - may throw an exception
+      m_strRoot(),
+      m_pAssetPack(nullptr),
+      m_pCache(nullptr),
+      m_nBudget(nBudget),
+      m_nUseClock(0),
+      m_Stats{}
+{
+};
+
+//---------------------------------------------------------------------------
+CTextureManager::~CTextureManager()
+{
+    Clear();
+};
+
+//---------------------------------------------------------------------------
+TextureHandle CTextureManager::Acquire(const char* szImageFilePath)
+{
+    if (szImageFilePath == nullptr)
+        return k_hInvalidTexture;
+
+    const uint64_t nPathHash = util::HashPath(szImageFilePath);
+
+    uint32_t nSlot = FindSlot(nPathHash);
+    if (nSlot == k_nEmptyBucket)
+    {
+        CTexture texture;
+        if (!LoadTexture(szImageFilePath, nPathHash, texture))
+            return k_hInvalidTexture;
+
+        try
+        {
+            if (m_rgFreeSlots.empty())
+            {
+                m_rgSlots.push_back(TextureSlot{ CTexture(), 0, 0, 1, 0, false, false }); // note - may throw an exception
+                // keep Evict() from ever having to allocate
+                m_rgFreeSlots.reserve(m_rgSlots.size());
+                nSlot = static_cast<uint32_t>(m_rgSlots.size() - 1);
+            }
+            else
+            {
+                nSlot = m_rgFreeSlots.back();
+                m_rgFreeSlots.pop_back();
+            }
+
+            InsertBucket(nPathHash, nSlot); // note - may throw an exception
+        }
+        catch (...)
+        {
+            if (nSlot != k_nEmptyBucket)
+                m_rgFreeSlots.push_back(nSlot);
+            texture.Release();
+            throw;
+        }
+
+        TextureSlot& slot = m_rgSlots[nSlot];
+        slot.texture   = texture;
+        slot.nPathHash = nPathHash;
+        slot.nRefCount = 0;
+        slot.bResident = true;
+        slot.bPinned   = false;
+
+        m_Stats.nResident++;
+        m_Stats.nBytesResident += texture.get_ByteSize();
+        m_Stats.nLoads++;
+    }
+
+    TextureSlot& slot = m_rgSlots[nSlot];
+    if (slot.nRefCount++ == 0)
+        m_Stats.nReferenced++;
+    slot.nLastUsed = ++m_nUseClock;
+
+    const TextureHandle hTexture = { nSlot, slot.nGeneration };
+
+    if (m_Stats.nBytesResident > m_nBudget)
+        EvictUnreferenced(m_nBudget);
+
+    return hTexture;
+};
+
+//---------------------------------------------------------------------------
+const CTexture* CTextureManager::AcquirePinned(const char* szImageFilePath)
+{
+    if (szImageFilePath == nullptr)
+        return nullptr;
+
+    TextureHandle hTexture = Find(util::HashPath(szImageFilePath));
+    TextureSlot*  pSlot    = Resolve(hTexture);
+
+    if (pSlot == nullptr)
+    {
+        hTexture = Acquire(szImageFilePath); // note - may throw an exception
+        pSlot    = Resolve(hTexture);
+        if (pSlot == nullptr)
+            return nullptr;
+
+        pSlot->bPinned = true;  // Acquire()'s reference is the pin
+    }
+    else if (!pSlot->bPinned)
+    {
+        AddRef(hTexture);
+        pSlot->bPinned = true;
+    }
+
+    return Get(hTexture);
+};
+
+//---------------------------------------------------------------------------
+bool CTextureManager::Reload(uint64_t nPathHash, const CMipChain& chain) noexcept
+{
+    const uint32_t nSlot = FindSlot(nPathHash);
+    if (nSlot == k_nEmptyBucket)
+        return false;   // not resident; the next Acquire() loads the new file anyway
+
+    CTexture texture;
+    if (!texture.InitFromMipChain(chain))
+        return false;
+
+    // the slot, and so every handle and CTexture* into it, stays put
+    TextureSlot& slot = m_rgSlots[nSlot];
+
+    m_Stats.nBytesResident -= slot.texture.get_ByteSize();
+    slot.texture.Release();
+    slot.texture = texture;
+    m_Stats.nBytesResident += texture.get_ByteSize();
+    m_Stats.nReloads++;
+
+    if (m_Stats.nBytesResident > m_nBudget)
+        EvictUnreferenced(m_nBudget);
+
+    return true;
+};
+
+//---------------------------------------------------------------------------
+TextureHandle CTextureManager::Find(uint64_t nPathHash) const noexcept
+{
+    const uint32_t nSlot = FindSlot(nPathHash);
+    if (nSlot == k_nEmptyBucket)
+        return k_hInvalidTexture;
+
+    return TextureHandle{ nSlot, m_rgSlots[nSlot].nGeneration };
+};
+
+//---------------------------------------------------------------------------
+bool CTextureManager::AddRef(TextureHandle hTexture) noexcept
+{
+    TextureSlot* pSlot = Resolve(hTexture);
+    if (pSlot == nullptr)
+        return false;
+
+    if (pSlot->nRefCount++ == 0)
+        m_Stats.nReferenced++;
+    return true;
+};
+
+//---------------------------------------------------------------------------
+bool CTextureManager::Release(TextureHandle hTexture) noexcept
+{
+    TextureSlot* pSlot = Resolve(hTexture);
+    if (pSlot == nullptr || pSlot->nRefCount == 0)
+        return false;
+
+    if (--pSlot->nRefCount == 0)
+    {
+        m_Stats.nReferenced--;
+
+        // now evictable; settle any budget overrun the references were holding up
+        if (m_Stats.nBytesResident > m_nBudget)
+            EvictUnreferenced(m_nBudget);
+    }
+    return true;
+};
+
+//---------------------------------------------------------------------------
+const CTexture* CTextureManager::Get(TextureHandle hTexture) noexcept
+{
+    TextureSlot* pSlot = Resolve(hTexture);
+    if (pSlot == nullptr)
+        return nullptr;
+
+    pSlot->nLastUsed = ++m_nUseClock;
+    return &pSlot->texture;
+};
+
+//---------------------------------------------------------------------------
+void CTextureManager::set_Budget(size_t nBytes) noexcept
+{
+    m_nBudget = nBytes;
+    if (m_Stats.nBytesResident > m_nBudget)
+        EvictUnreferenced(m_nBudget);
+};
+
+//---------------------------------------------------------------------------
+size_t CTextureManager::EvictUnreferenced(size_t nTargetBytes) noexcept
+{
+    size_t nEvicted = 0;
+
+    // texture counts are small; a scan per eviction beats keeping an LRU list current
+    while (m_Stats.nBytesResident > nTargetBytes)
+    {
+        uint32_t nOldest   = k_nEmptyBucket;
+        uint64_t nOldestAt = UINT64_MAX;
+
+        for (uint32_t i = 0; i < m_rgSlots.size(); i++)
+        {
+            const TextureSlot& slot = m_rgSlots[i];
+            if (slot.bResident && slot.nRefCount == 0 && slot.nLastUsed < nOldestAt)
+            {
+                nOldest   = i;
+                nOldestAt = slot.nLastUsed;
+            }
+        }
+
+        if (nOldest == k_nEmptyBucket)
+            break;  // everything left is referenced
+
+        Evict(nOldest);
+        nEvicted++;
+    }
+
+    return nEvicted;
+};
+
+//---------------------------------------------------------------------------
+void CTextureManager::Clear(void) noexcept
+{
+    for (uint32_t i = 0; i < m_rgSlots.size(); i++)
+    {
+        if (m_rgSlots[i].bResident)
+            Evict(i);
+    }
+};
+
+//---------------------------------------------------------------------------
+CTextureManager::TextureSlot* CTextureManager::Resolve(TextureHandle hTexture) noexcept
+{
+    if (!hTexture.IsValid() || hTexture.nIndex >= m_rgSlots.size())
+        return nullptr;
+
+    TextureSlot& slot = m_rgSlots[hTexture.nIndex];
+    if (!slot.bResident || slot.nGeneration != hTexture.nGeneration)
+        return nullptr;
+
+    return &slot;
+};
+
+//---------------------------------------------------------------------------
+void CTextureManager::Evict(uint32_t nSlot) noexcept
+{
+    TextureSlot& slot = m_rgSlots[nSlot];
+
+    m_Stats.nBytesResident -= slot.texture.get_ByteSize();
+    m_Stats.nResident--;
+    m_Stats.nEvictions++;
+    if (slot.nRefCount)
+        m_Stats.nReferenced--;
+
+    slot.texture.Release();
+    EraseBucket(slot.nPathHash);
+
+    // outstanding handles stop resolving
+    if (++slot.nGeneration == 0)
+        slot.nGeneration = 1;
+    slot.nRefCount = 0;
+    slot.bResident = false;
+    slot.bPinned   = false;
+
+    m_rgFreeSlots.push_back(nSlot); // capacity reserved in Acquire(), cannot throw
+};
+
+//---------------------------------------------------------------------------
+bool CTextureManager::LoadTexture(const char* szImageFilePath, uint64_t nPathHash, CTexture& texture) noexcept
+{
+    AssetView view       = { nullptr, 0, AF_RAW };
+    uint64_t  nSourceKey = 0;
+
+    if (m_pAssetPack)
+    {
+        const PackEntry* pEntry = m_pAssetPack->Find(nPathHash);
+        if (pEntry)
+        {
+            view       = m_pAssetPack->Get(nPathHash);
+            nSourceKey = util::HashBytes(pEntry, sizeof(*pEntry));
+        }
+    }
+
+    // the name is relative to the root; absolute paths are taken as they are
+    std::string strFilePath;
+    try
+    {
+        const bool bAbsolute = szImageFilePath[0] == '/' || szImageFilePath[0] == '\\' ||
+                               (szImageFilePath[0] && szImageFilePath[1] == ':');
+        if (!m_strRoot.empty() && !bAbsolute)
+            strFilePath = m_strRoot + '/'; // note - may throw an exception
+        strFilePath += szImageFilePath;    // note - may throw an exception
+    }
+    catch (...)
+    {
+        return false;
+    }
+
+    if (m_pCache)
+    {
+        if (!view.IsValid())
+            nSourceKey = CTextureCache::MakeFileKey(strFilePath.c_str(), nPathHash);
+
+        if (m_pCache->Lookup(nSourceKey, texture))
+            return true;
+    }
+
+    const double dStartTime = util::GetCurrentTimeInSeconds();
+
+    int iWidth = 0, iHeight = 0, iComponents = 0;
+    unsigned char* pTexels = nullptr;
+
+    // a packed image is decoded straight out of the mapping
+    if (view.IsValid() && view.nSize <= static_cast<size_t>(INT_MAX))
+        pTexels = stbi_load_from_memory(view.pData, static_cast<int>(view.nSize), &iWidth, &iHeight, &iComponents, STBI_default);
+    else
+        pTexels = stbi_load(strFilePath.c_str(), &iWidth, &iHeight, &iComponents, STBI_default);
+
+    // the mip chain is built here rather than by InitFromTexels() so the
+    //  cache stores it, and a hit skips both the decode and the filtering
+    CMipChain chain;
+    bool      bChain = false;
+    try
+    {
+        bChain = chain.Build(pTexels, iWidth, iHeight, iComponents); // note - may throw an exception
+    }
+    catch (...)
+    {
+        bChain = false;
+    }
+
+    const double dDecodeSeconds = util::GetCurrentTimeInSeconds() - dStartTime;
+
+    bool bResult = false;
+    if (bChain)
+    {
+        bResult = texture.InitFromMipChain(chain);
+
+        if (bResult && m_pCache)
+            m_pCache->Store(nSourceKey, chain, dDecodeSeconds);
+    }
+    else
+    {
+        bResult = texture.InitFromTexels(pTexels, iWidth, iHeight, iComponents);
+    }
+
+    stbi_image_free(pTexels);
+    return bResult;
+};
+
+//---------------------------------------------------------------------------
+uint32_t CTextureManager::FindSlot(uint64_t nPathHash) const noexcept
+{
+    const size_t nMask = m_rgBuckets.size() - 1;
+
+    for (size_t i = BucketIndex(nPathHash, nMask); ; i = (i + 1) & nMask)
+    {
+        const Bucket& bucket = m_rgBuckets[i];
+        if (bucket.nSlot == k_nEmptyBucket)
+            return k_nEmptyBucket;
+        if (bucket.nPathHash == nPathHash)
+            return bucket.nSlot;
+    }
+};
+
+//---------------------------------------------------------------------------
+void CTextureManager::InsertBucket(uint64_t nPathHash, uint32_t nSlot)
+{
+    if ((m_Stats.nResident + 1) * 2 > m_rgBuckets.size())
+        GrowBuckets(); // note - may throw an exception
+
+    const size_t nMask = m_rgBuckets.size() - 1;
+
+    size_t i = BucketIndex(nPathHash, nMask);
+    while (m_rgBuckets[i].nSlot != k_nEmptyBucket)
+        i = (i + 1) & nMask;
+
+    m_rgBuckets[i] = Bucket{ nPathHash, nSlot };
+};
+
+//---------------------------------------------------------------------------
+void CTextureManager::EraseBucket(uint64_t nPathHash) noexcept
+{
+    const size_t nMask = m_rgBuckets.size() - 1;
+
+    size_t i = BucketIndex(nPathHash, nMask);
+    for (;; i = (i + 1) & nMask)
+    {
+        if (m_rgBuckets[i].nSlot == k_nEmptyBucket)
+            return;
+        if (m_rgBuckets[i].nPathHash == nPathHash)
+            break;
+    }
+
+    // backward shift deletion: pull later entries of the probe run into the
+    // hole so lookups never need tombstones
+    for (size_t j = (i + 1) & nMask; m_rgBuckets[j].nSlot != k_nEmptyBucket; j = (j + 1) & nMask)
+    {
+        const size_t k = BucketIndex(m_rgBuckets[j].nPathHash, nMask);
+
+        // move j into the hole unless its home k lies cyclically in (i, j]
+        const bool bHomeBetween = (i <= j) ? (i < k && k <= j) : (i < k || k <= j);
+        if (!bHomeBetween)
+        {
+            m_rgBuckets[i] = m_rgBuckets[j];
+            i = j;
+        }
+    }
+
+    m_rgBuckets[i] = Bucket{ 0, k_nEmptyBucket };
+};
+
+//---------------------------------------------------------------------------
+void CTextureManager::GrowBuckets(void)
+{
+    std::vector<Bucket> rgOld(m_rgBuckets.size() * 2, Bucket{ 0, k_nEmptyBucket }); // note - may throw an exception
+    rgOld.swap(m_rgBuckets);
+
+    const size_t nMask = m_rgBuckets.size() - 1;
+    for (const Bucket& bucket : rgOld)
+    {
+        if (bucket.nSlot == k_nEmptyBucket)
+            continue;
+
+        size_t i = BucketIndex(bucket.nPathHash, nMask);
+        while (m_rgBuckets[i].nSlot != k_nEmptyBucket)
+            i = (i + 1) & nMask;
+        m_rgBuckets[i] = bucket;
+    }
+};
+
+//---------------------------------------------------------------------------
+CTextureManager& GetTextureManager(void)
+{
+    static CTextureManager s_TextureManager;
+
+    return s_TextureManager;
+};
+
+} // namespace rdr
+} // namespace eng
@@ -0,0 +1,241 @@
+/**
+ *  @file       TextureManager.h
+ *  @brief      CTextureManager class interface
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ *  <b>Implementation:</b>
+ *
+ *   Textures live in a slot array and are referred to by generational
+ *   handles (slot index + generation); a handle to an evicted texture simply
+ *   stops resolving instead of dangling.  Lookup by path goes through an
+ *   open-addressed (linear probing) hash table keyed by util::HashPath(), so
+ *   a constant path can be hashed at compile time and looked up without
+ *   building a string.
+ *
+ *   Acquire() / AddRef() / Release() maintain a reference count per texture.
+ *   A texture whose count drops to zero stays resident as a cache entry
+ *   until the resident byte total exceeds the budget, at which point the
+ *   least recently used unreferenced textures are deleted (GL name included)
+ *   until the total fits again.  Referenced textures are never evicted, so
+ *   the budget is a soft limit.
+ *
+ *   Textures are named by their path relative to the deploy root, e.g.
+ *   "Assets\\Images\\ScoreDigits.png", the same name the asset pack and
+ *   the hot reloader key them by; loose files are opened below the root
+ *   set with set_RootDirectory().  When an asset pack is attached,
+ *   Acquire() looks the name up in the pack first and decodes directly
+ *   from the mapped bytes, falling back to the loose file.  When a CTextureCache is attached, previously decoded texels
+ *   are uploaded from it and the image decoder is skipped entirely.
+ *
+ *   Not thread safe; call from the thread that owns the GL context.
+ */
+#pragma once
+
+#if !defined(__TEXTURE_MANAGER_H__)
+#define __TEXTURE_MANAGER_H__
+
+#ifndef _CSTDINT_
+    #include <cstdint>
+#endif
+
+#ifndef _STRING_
+    #include <string>
+#endif
+
+#ifndef _VECTOR_
+    #include <vector>
+#endif
+
+#ifndef __ASSET_PACK_H__
+    #include "Engine/Utility/AssetPack.h"
+#endif
+
+#ifndef __TEXTURE_H__
+    #include "Engine/Renderer/Texture.h"
+#endif
+
+namespace eng
+{
+namespace rdr
+{
+
+class CTextureCache;
+
+constexpr size_t k_nDefaultTextureBudget = 256 * 1024 * 1024;
+
+struct TextureHandle
+{
+    uint32_t nIndex;
+    uint32_t nGeneration;   ///< 0 is never issued, so a zeroed handle is invalid
+
+    constexpr bool IsValid(void) const noexcept
+    { return nGeneration != 0; };
+};
+
+constexpr TextureHandle k_hInvalidTexture = { 0, 0 };
+
+struct TextureStats
+{
+    size_t nResident;       ///< textures currently loaded
+    size_t nReferenced;     ///< ... of which held by at least one reference
+    size_t nBytesResident;
+    size_t nLoads;
+    size_t nEvictions;
+    size_t nReloads;        ///< payloads swapped in by Reload()
+};
+
+class CTextureManager
+{
+    struct TextureSlot
+    {
+        CTexture  texture;
+        uint64_t  nPathHash;
+        uint64_t  nLastUsed;     ///< value of m_nUseClock at the last lookup
+        uint32_t  nGeneration;
+        uint32_t  nRefCount;
+        bool      bResident;
+        bool      bPinned;       ///< one of the references is held by AcquirePinned()
+    };
+
+    struct Bucket
+    {
+        uint64_t  nPathHash;
+        uint32_t  nSlot;         ///< k_nEmptyBucket when unused
+    };
+
+    static constexpr uint32_t k_nEmptyBucket = 0xFFFFFFFF;
+
+    std::vector<TextureSlot> m_rgSlots;
+    std::vector<uint32_t>    m_rgFreeSlots;
+    std::vector<Bucket>      m_rgBuckets;     ///< power of two sized, load factor <= 1/2
+    std::string              m_strRoot;       ///< loose files are opened below it, empty for the working directory
+    const CAssetPack*        m_pAssetPack;    ///< not owned, may be nullptr
+    CTextureCache*           m_pCache;        ///< not owned, may be nullptr
+    size_t                   m_nBudget;
+    uint64_t                 m_nUseClock;
+    TextureStats             m_Stats;
+
+public:
+    /// Default Constructor
+    explicit CTextureManager(size_t nBudget = k_nDefaultTextureBudget);
+    /// Default Destructor, deletes every GL texture still resident
+    ~CTextureManager() noexcept;
+
+/**
+ *  @brief returns a referenced handle to the texture of an image file,
+ *         loading it on first use; balance with Release()
+ *
+ *  @param [in] szImageFilePath   name relative to the root directory
+ *
+ *  @retval k_hInvalidTexture    if the file cannot be loaded
+ *
+ *  @note - may throw an exception
+ */
+    TextureHandle   Acquire          (const char* szImageFilePath);
+
+/**
+ *  @brief returns the texture of an image file, loading it on first use;
+ *         a single reference is taken however often it is called, and held
+ *         until the texture is cleared, so the pointer stays valid
+ *
+ *  @retval nullptr     if the file cannot be loaded
+ *
+ *  @note - may throw an exception
+ */
+    const CTexture* AcquirePinned    (const char* szImageFilePath);
+
+/**
+ *  @brief looks up a resident texture by precomputed util::HashPath(),
+ *         without loading or referencing it
+ */
+    TextureHandle   Find             (uint64_t nPathHash) const noexcept;
+
+/**
+ *  @brief swaps a new payload into a resident texture in place; existing
+ *         handles and CTexture pointers keep working and see the new image
+ *
+ *  @retval false   if the texture is not resident or the upload fails
+ */
+    bool            Reload           (uint64_t nPathHash, const CMipChain& chain) noexcept;
+
+    bool            AddRef           (TextureHandle hTexture) noexcept;
+    bool            Release          (TextureHandle hTexture) noexcept;
+
+/**
+ *  @brief resolves a handle, marking the texture as recently used
+ *
+ *  @retval nullptr     if the handle is stale or invalid
+ */
+    const CTexture* Get              (TextureHandle hTexture) noexcept;
+
+    void            set_Budget       (size_t nBytes) noexcept;
+
+/**
+ *  @brief sets the directory texture names are relative to, normally the
+ *         deploy (module) directory the pack was built from
+ *
+ *  @note - may throw an exception
+ */
+    void            set_RootDirectory(const char* szRootDirectory)
+    { m_strRoot = szRootDirectory ? szRootDirectory : ""; };
+
+/**
+ *  @brief attaches a pack searched before loose files; the pack must stay
+ *         open while attached, pass nullptr to detach
+ */
+    void            set_AssetPack    (const CAssetPack* pAssetPack) noexcept
+    { m_pAssetPack = pAssetPack; };
+
+/**
+ *  @brief attaches a decoded texel cache consulted before decoding; pass
+ *         nullptr to detach
+ */
+    void            set_Cache        (CTextureCache* pCache) noexcept
+    { m_pCache = pCache; };
+
+    constexpr size_t get_Budget      (void) const noexcept
+    { return m_nBudget; };
+
+    constexpr size_t get_BytesResident(void) const noexcept
+    { return m_Stats.nBytesResident; };
+
+    constexpr const TextureStats& get_Stats(void) const noexcept
+    { return m_Stats; };
+
+/**
+ *  @brief deletes least recently used unreferenced textures until no more
+ *         than nTargetBytes are resident (or none are left to evict)
+ *
+ *  @retval size_t      number of textures evicted
+ */
+    size_t          EvictUnreferenced(size_t nTargetBytes) noexcept;
+
+    void            Clear            (void) noexcept;
+
+private:
+    TextureSlot*    Resolve          (TextureHandle hTexture) noexcept;
+    bool            LoadTexture      (const char* szImageFilePath, uint64_t nPathHash, CTexture& texture) noexcept;
+    void            Evict            (uint32_t nSlot) noexcept;
+
+    uint32_t        FindSlot         (uint64_t nPathHash) const noexcept;
+    void            InsertBucket     (uint64_t nPathHash, uint32_t nSlot);
+    void            EraseBucket      (uint64_t nPathHash) noexcept;
+    void            GrowBuckets      (void);
+
+    /// Copy constructor
+    CTextureManager(const CTextureManager&) = delete;
+    /// Assignment operator
+    CTextureManager& operator=(const CTextureManager&) = delete;
+};
+
+/**
+ *  @brief retrieves the process-wide texture manager
+ */
+CTextureManager& GetTextureManager(void);
+
+} // namespace rdr
+} // namespace eng
+
+#endif
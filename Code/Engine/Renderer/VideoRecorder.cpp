@@ -0,0 +1,376 @@
+/**
+ *  @file       VideoRecorder.cpp
+ *  @brief      CVideoRecorder class implementation
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ */
+
+// turn off silly warnings that encourage use of xxxx_s functions
+#define _CRT_SECURE_NO_WARNINGS
+#include "targetver.h"  // this needs to be the 1st header included
+
+#include <algorithm>
+#include <cstring>
+#include <emmintrin.h>
+
+#include "Renderer.h"
+#include "VideoRecorder.h"
+
+namespace eng
+{
+namespace rdr
+{
+
+// full range BT.601 coefficients, scaled by 256
+constexpr int k_iYR =  77, k_iYG = 150, k_iYB =  29;
+constexpr int k_iUR = -43, k_iUG = -85, k_iUB = 128;
+constexpr int k_iVR = 128, k_iVG =-107, k_iVB = -21;
+
+//-----------------------------------------------------------------------------------------------
+static inline void SplitRGB(__m128i px, __m128i& r, __m128i& g, __m128i& b) noexcept
+{
+    const __m128i vMask = _mm_set1_epi32(0xFF);
+
+    r = _mm_and_si128( px,                    vMask );
+    g = _mm_and_si128( _mm_srli_epi32(px, 8),  vMask );
+    b = _mm_and_si128( _mm_srli_epi32(px, 16), vMask );
+};
+
+//-----------------------------------------------------------------------------------------------
+// each 32-bit lane holds a value < 65536 in its low half, so madd_epi16
+// against a broadcast coefficient is a 32-bit multiply
+static inline __m128i Weigh(__m128i r, __m128i g, __m128i b, int iR, int iG, int iB) noexcept
+{
+    return _mm_add_epi32( _mm_add_epi32( _mm_madd_epi16(r, _mm_set1_epi32(iR)),
+                                         _mm_madd_epi16(g, _mm_set1_epi32(iG)) ),
+                          _mm_madd_epi16(b, _mm_set1_epi32(iB)) );
+};
+
+//-----------------------------------------------------------------------------------------------
+static inline __m128i LumaX4(__m128i px) noexcept
+{
+    __m128i r, g, b;
+    SplitRGB(px, r, g, b);
+
+    return _mm_srli_epi32( _mm_add_epi32(Weigh(r, g, b, k_iYR, k_iYG, k_iYB), _mm_set1_epi32(128)), 8 );
+};
+
+//-----------------------------------------------------------------------------------------------
+// sums the 2x2 blocks of two rows of 4 pixels; the two block sums land in lanes 0 and 1
+static inline __m128i PairSum(__m128i v0, __m128i v1) noexcept
+{
+    __m128i vSum = _mm_add_epi32(v0, v1);
+    vSum = _mm_add_epi32(vSum, _mm_srli_epi64(vSum, 32));
+    return _mm_shuffle_epi32(vSum, _MM_SHUFFLE(3, 1, 2, 0));
+};
+
+//-----------------------------------------------------------------------------------------------
+static inline __m128i ChromaX4(__m128i sr, __m128i sg, __m128i sb, int iR, int iG, int iB) noexcept
+{
+    // block sums are 4 pixels: divide by 4 * 256 and re-center on 128
+    const __m128i vBias = _mm_set1_epi32( (128 << 10) + 512 );
+
+    return _mm_srai_epi32( _mm_add_epi32(Weigh(sr, sg, sb, iR, iG, iB), vBias), 10 );
+};
+
+//-----------------------------------------------------------------------------------------------
+static inline unsigned char ClampByte(int iValue) noexcept
+{
+    return static_cast<unsigned char>( std::min(std::max(iValue, 0), 255) );
+};
+
+//-----------------------------------------------------------------------------------------------
+void ConvertRGBAToI420(const unsigned char* pRGBA, ptrdiff_t iRowStride, int iWidth, int iHeight,
+                       unsigned char* pY, unsigned char* pU, unsigned char* pV) noexcept
+{
+    const int iChromaWidth = iWidth / 2;
+
+    for (int iRow = 0; iRow + 1 < iHeight; iRow += 2)
+    {
+        const unsigned char* pSrc0 = pRGBA + (iRow * iRowStride);
+        const unsigned char* pSrc1 = pSrc0 + iRowStride;
+        unsigned char*       pY0   = pY + (iRow * iWidth);
+        unsigned char*       pY1   = pY0 + iWidth;
+        unsigned char*       pUDst = pU + ((iRow / 2) * iChromaWidth);
+        unsigned char*       pVDst = pV + ((iRow / 2) * iChromaWidth);
+
+        int x = 0;
+        for (; x + 8 <= iWidth; x += 8)
+        {
+            const __m128i vA0 = _mm_loadu_si128( reinterpret_cast<const __m128i*>(pSrc0 + (x * 4)) );
+            const __m128i vB0 = _mm_loadu_si128( reinterpret_cast<const __m128i*>(pSrc0 + (x * 4) + 16) );
+            const __m128i vA1 = _mm_loadu_si128( reinterpret_cast<const __m128i*>(pSrc1 + (x * 4)) );
+            const __m128i vB1 = _mm_loadu_si128( reinterpret_cast<const __m128i*>(pSrc1 + (x * 4) + 16) );
+
+            // luma, 8 pixels per row
+            const __m128i vY0 = _mm_packs_epi32( LumaX4(vA0), LumaX4(vB0) );
+            const __m128i vY1 = _mm_packs_epi32( LumaX4(vA1), LumaX4(vB1) );
+            _mm_storel_epi64( reinterpret_cast<__m128i*>(pY0 + x), _mm_packus_epi16(vY0, vY0) );
+            _mm_storel_epi64( reinterpret_cast<__m128i*>(pY1 + x), _mm_packus_epi16(vY1, vY1) );
+
+            // chroma, 4 samples from the 2x2 blocks
+            __m128i rA0, gA0, bA0, rB0, gB0, bB0, rA1, gA1, bA1, rB1, gB1, bB1;
+            SplitRGB(vA0, rA0, gA0, bA0);
+            SplitRGB(vB0, rB0, gB0, bB0);
+            SplitRGB(vA1, rA1, gA1, bA1);
+            SplitRGB(vB1, rB1, gB1, bB1);
+
+            const __m128i vSumR = _mm_unpacklo_epi64( PairSum(rA0, rA1), PairSum(rB0, rB1) );
+            const __m128i vSumG = _mm_unpacklo_epi64( PairSum(gA0, gA1), PairSum(gB0, gB1) );
+            const __m128i vSumB = _mm_unpacklo_epi64( PairSum(bA0, bA1), PairSum(bB0, bB1) );
+
+            __m128i vU = ChromaX4(vSumR, vSumG, vSumB, k_iUR, k_iUG, k_iUB);
+            __m128i vV = ChromaX4(vSumR, vSumG, vSumB, k_iVR, k_iVG, k_iVB);
+            vU = _mm_packus_epi16( _mm_packs_epi32(vU, vU), vU );
+            vV = _mm_packus_epi16( _mm_packs_epi32(vV, vV), vV );
+
+            const int iU = _mm_cvtsi128_si32(vU);
+            const int iV = _mm_cvtsi128_si32(vV);
+            memcpy(pUDst + (x / 2), &iU, 4);
+            memcpy(pVDst + (x / 2), &iV, 4);
+        }
+
+        // remaining pixel pairs
+        for (; x + 1 < iWidth; x += 2)
+        {
+            int iSumR = 0, iSumG = 0, iSumB = 0;
+            for (int i = 0; i < 4; i++)
+            {
+                const unsigned char* pPx = ((i < 2) ? pSrc0 : pSrc1) + ((x + (i & 1)) * 4);
+                unsigned char*       pYDst = ((i < 2) ? pY0 : pY1) + x + (i & 1);
+
+                *pYDst = ClampByte( ((k_iYR * pPx[0]) + (k_iYG * pPx[1]) + (k_iYB * pPx[2]) + 128) >> 8 );
+                iSumR += pPx[0];
+                iSumG += pPx[1];
+                iSumB += pPx[2];
+            }
+
+            pUDst[x / 2] = ClampByte( ((k_iUR * iSumR) + (k_iUG * iSumG) + (k_iUB * iSumB) + (128 << 10) + 512) >> 10 );
+            pVDst[x / 2] = ClampByte( ((k_iVR * iSumR) + (k_iVG * iSumG) + (k_iVB * iSumB) + (128 << 10) + 512) >> 10 );
+        }
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+CVideoRecorder::CVideoRecorder(size_t nQueueDepth /* = 8 */)
+    : m_Pool(nQueueDepth),
+      m_thWorker(),
+      m_mtxQueue(),
+      m_cvQueue(),
+      m_qPending(),
+      m_bShutdown(false),
+      m_bBlockWhenFull(false),
+      m_pFile(nullptr),
+      m_rgPlanes(),
+      m_iWidth(0),
+      m_iHeight(0),
+      m_iFrameRate(60),
+      m_strFileName(),
+      m_nWritten(0),
+      m_nDropped(0),
+      m_nFailed(0)
+{
+};
+
+//-----------------------------------------------------------------------------------------------
+CVideoRecorder::~CVideoRecorder()
+{
+    Stop();
+};
+
+//-----------------------------------------------------------------------------------------------
+bool CVideoRecorder::Start(const char* szFileName, int iFrameRate)
+{
+    if (m_thWorker.joinable() || szFileName == nullptr || iFrameRate <= 0)
+        return false;
+
+    m_pFile = fopen(szFileName, "wb");
+    if (m_pFile == nullptr)
+        return false;
+
+    m_strFileName = szFileName;
+    m_iFrameRate  = iFrameRate;
+    m_iWidth      = 0;
+    m_iHeight     = 0;
+    m_bShutdown   = false;
+
+    try
+    {
+        m_thWorker = std::thread(&CVideoRecorder::WorkerProc, this);
+    }
+    catch (...)
+    {
+        fclose(m_pFile);
+        m_pFile = nullptr;
+        return false;
+    }
+
+    return true;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CVideoRecorder::Stop(void) noexcept
+{
+    if (m_thWorker.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mtxQueue);
+            m_bShutdown = true;
+        }
+        m_cvQueue.notify_one();
+        m_thWorker.join();
+    }
+
+    if (m_pFile)
+    {
+        fclose(m_pFile);
+        m_pFile = nullptr;
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+FrameBuffer* CVideoRecorder::AcquireBuffer(int iWidth, int iHeight) noexcept
+{
+    FrameBuffer* pBuffer = m_bBlockWhenFull ? m_Pool.AcquireWait(iWidth, iHeight)
+                                            : m_Pool.Acquire(iWidth, iHeight);
+    if (pBuffer == nullptr)
+    {
+        // worker is behind; drop the video frame rather than stall the simulation
+        m_nDropped.fetch_add(1, std::memory_order_relaxed);
+    }
+    return pBuffer;
+};
+
+//-----------------------------------------------------------------------------------------------
+bool CVideoRecorder::OnFrameEnd(int iWidth, int iHeight) noexcept
+{
+    if (!m_thWorker.joinable() || iWidth <= 0 || iHeight <= 0)
+        return false;
+
+    FrameBuffer* pBuffer = AcquireBuffer(iWidth, iHeight);
+    if (pBuffer == nullptr)
+        return false;
+
+    g_theRdr.ReadPixels( iWidth, iHeight, pBuffer->rgPixels.data() );
+
+    Enqueue(pBuffer);
+    return true;
+};
+
+//-----------------------------------------------------------------------------------------------
+bool CVideoRecorder::SubmitFrame(const unsigned char* pPixels, int iWidth, int iHeight, size_t nStride) noexcept
+{
+    if (!m_thWorker.joinable() || pPixels == nullptr || iWidth <= 0 || iHeight <= 0)
+        return false;
+
+    FrameBuffer* pBuffer = AcquireBuffer(iWidth, iHeight);
+    if (pBuffer == nullptr)
+        return false;
+
+    // store bottom-up to match the layout glReadPixels produces
+    const size_t nRowBytes = pBuffer->get_RowBytes();
+    for (int iRow = 0; iRow < iHeight; iRow++)
+    {
+        memcpy(&pBuffer->rgPixels[(iHeight - 1 - iRow) * nRowBytes],
+               pPixels + iRow * nStride, nRowBytes);
+    }
+
+    Enqueue(pBuffer);
+    return true;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CVideoRecorder::Enqueue(FrameBuffer* pBuffer) noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mtxQueue);
+        try
+        {
+            m_qPending.push_back(pBuffer);
+        }
+        catch (...)
+        {
+            m_Pool.Release(pBuffer);
+            m_nDropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    }
+    m_cvQueue.notify_one();
+};
+
+//-----------------------------------------------------------------------------------------------
+void CVideoRecorder::WorkerProc(void) noexcept
+{
+    for (;;)
+    {
+        FrameBuffer* pBuffer = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(m_mtxQueue);
+            m_cvQueue.wait(lock, [this] { return m_bShutdown || !m_qPending.empty(); });
+
+            // drain whatever is still queued before honoring a shutdown
+            if (m_qPending.empty())
+                break;
+
+            pBuffer = m_qPending.front();
+            m_qPending.pop_front();
+        }
+
+        if (WriteFrame(*pBuffer))
+            m_nWritten.fetch_add(1, std::memory_order_relaxed);
+        else
+            m_nFailed.fetch_add(1, std::memory_order_relaxed);
+
+        m_Pool.Release(pBuffer);
+    }
+
+    fflush(m_pFile);
+};
+
+//-----------------------------------------------------------------------------------------------
+bool CVideoRecorder::WriteFrame(const FrameBuffer& frame) noexcept
+{
+    // the first frame fixes the stream size; 4:2:0 needs even dimensions
+    if (m_iWidth == 0)
+    {
+        m_iWidth  = frame.iWidth  & ~1;
+        m_iHeight = frame.iHeight & ~1;
+        if (m_iWidth == 0 || m_iHeight == 0)
+            return false;
+
+        try
+        {
+            m_rgPlanes.resize( static_cast<size_t>(m_iWidth) * m_iHeight * 3 / 2 );
+        }
+        catch (...)
+        {
+            m_iWidth = m_iHeight = 0;
+            return false;
+        }
+
+        fprintf(m_pFile, "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C420jpeg\n", m_iWidth, m_iHeight, m_iFrameRate);
+    }
+
+    // later frames (e.g. after a window resize) are cropped to the stream size
+    if (frame.iWidth < m_iWidth || frame.iHeight < m_iHeight)
+        return false;
+
+    // rows are bottom-up; start at the top row and walk backwards
+    const ptrdiff_t      iRowBytes = static_cast<ptrdiff_t>(frame.get_RowBytes());
+    const unsigned char* pTopRow   = frame.rgPixels.data() + ((frame.iHeight - 1) * iRowBytes);
+
+    const size_t nLuma   = static_cast<size_t>(m_iWidth) * m_iHeight;
+    unsigned char* pY    = m_rgPlanes.data();
+    unsigned char* pU    = pY + nLuma;
+    unsigned char* pV    = pU + (nLuma / 4);
+
+    ConvertRGBAToI420(pTopRow, -iRowBytes, m_iWidth, m_iHeight, pY, pU, pV);
+
+    return (fputs("FRAME\n", m_pFile) >= 0) &&
+           (fwrite(m_rgPlanes.data(), 1, m_rgPlanes.size(), m_pFile) == m_rgPlanes.size());
+};
+
+} // namespace rdr
+} // namespace eng
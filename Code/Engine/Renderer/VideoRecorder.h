@@ -0,0 +1,160 @@
+/**
+ *  @file       VideoRecorder.h
+ *  @brief      CVideoRecorder class interface
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ *  <b>Implementation:</b>
+ *
+ *   Streams every submitted frame to an uncompressed YUV4MPEG2 (.y4m) file,
+ *   which ffmpeg and most players read directly.  The render thread only
+ *   copies RGBA pixels into a pooled frame buffer; the RGB to YUV 4:2:0
+ *   conversion and the file writes run on a worker thread.
+ *
+ *   The pool doubles as the bounded frame queue.  When it is full the frame
+ *   is either dropped and counted (live play, so the simulation never waits)
+ *   or the caller waits for the worker (set_BlockWhenFull(), for offline
+ *   rendering where every frame must reach the file).
+ *
+ * <b>Cite:</b>
+ *
+ * @sa https://wiki.multimedia.cx/index.php/YUV4MPEG2
+ */
+#pragma once
+
+#if !defined(__VIDEO_RECORDER_H__)
+#define __VIDEO_RECORDER_H__
+
+#ifndef _ATOMIC_
+    #include <atomic>
+#endif
+
+#ifndef _CONDITION_VARIABLE_
+    #include <condition_variable>
+#endif
+
+#ifndef _DEQUE_
+    #include <deque>
+#endif
+
+#ifndef _INC_STDIO
+    #include <stdio.h>
+#endif
+
+#ifndef _STRING_
+    #include <string>
+#endif
+
+#ifndef _THREAD_
+    #include <thread>
+#endif
+
+#ifndef __FRAME_BUFFER_POOL_H__
+    #include "Engine/Renderer/FrameBufferPool.h"
+#endif
+
+namespace eng
+{
+namespace rdr
+{
+
+/**
+ *  @brief converts RGBA8 pixels to planar YUV 4:2:0 (full range BT.601,
+ *         "C420jpeg"), each chroma sample averaging a 2x2 block
+ *
+ *  @param [in]  pRGBA       first row to convert
+ *  @param [in]  iRowStride  byte offset between rows, negative for bottom-up source
+ *  @param [in]  iWidth      pixels per row, must be even
+ *  @param [in]  iHeight     rows, must be even
+ *  @param [out] pY          iWidth * iHeight bytes
+ *  @param [out] pU          (iWidth / 2) * (iHeight / 2) bytes
+ *  @param [out] pV          (iWidth / 2) * (iHeight / 2) bytes
+ */
+void ConvertRGBAToI420(const unsigned char* pRGBA, ptrdiff_t iRowStride, int iWidth, int iHeight,
+                       unsigned char* pY, unsigned char* pU, unsigned char* pV) noexcept;
+
+class CVideoRecorder
+{
+    CFrameBufferPool            m_Pool;
+    std::thread                 m_thWorker;
+    std::mutex                  m_mtxQueue;
+    std::condition_variable     m_cvQueue;
+    std::deque<FrameBuffer*>    m_qPending;
+    bool                        m_bShutdown;
+    bool                        m_bBlockWhenFull;
+
+    // owned by the worker thread once Start() succeeds
+    FILE*                       m_pFile;
+    std::vector<unsigned char>  m_rgPlanes;
+    int                         m_iWidth;       ///< fixed by the first frame, even
+    int                         m_iHeight;      ///< fixed by the first frame, even
+    int                         m_iFrameRate;
+    std::string                 m_strFileName;
+
+    std::atomic<size_t>         m_nWritten;
+    std::atomic<size_t>         m_nDropped;
+    std::atomic<size_t>         m_nFailed;
+
+public:
+/**
+ *  @param [in] nQueueDepth     frames that may wait on the worker before
+ *                              frames are dropped (or the caller waits)
+ */
+    explicit CVideoRecorder(size_t nQueueDepth = 8);
+    /// Default Destructor, flushes pending frames and closes the file
+    ~CVideoRecorder() noexcept;
+
+/**
+ *  @brief opens the output file and starts the worker thread
+ *
+ *  @retval true     on success
+ */
+    bool          Start         (const char* szFileName, int iFrameRate);
+    void          Stop          (void) noexcept;
+
+    inline bool   IsRecording   (void) const noexcept
+    { return m_thWorker.joinable(); };
+
+    inline void   set_BlockWhenFull (bool bSet) noexcept
+    { m_bBlockWhenFull = bSet; };
+
+/**
+ *  @brief call once per frame, after rendering and before swapping buffers
+ *
+ *  @retval true    if the frame was queued for writing
+ */
+    bool          OnFrameEnd    (int iWidth, int iHeight) noexcept;
+
+/**
+ *  @brief queues an RGBA frame from a source other than the GL back buffer
+ *
+ *  @param [in] pPixels      top-down RGBA8 rows
+ */
+    bool          SubmitFrame   (const unsigned char* pPixels, int iWidth, int iHeight, size_t nStride) noexcept;
+
+    inline size_t get_Written   (void) const noexcept
+    { return m_nWritten.load(std::memory_order_relaxed); };
+
+    inline size_t get_Dropped   (void) const noexcept
+    { return m_nDropped.load(std::memory_order_relaxed); };
+
+    inline size_t get_Failed    (void) const noexcept
+    { return m_nFailed.load(std::memory_order_relaxed); };
+
+private:
+    FrameBuffer*  AcquireBuffer (int iWidth, int iHeight) noexcept;
+    void          Enqueue       (FrameBuffer* pBuffer) noexcept;
+    void          WorkerProc    (void) noexcept;
+    bool          WriteFrame    (const FrameBuffer& frame) noexcept;
+
+    /// Copy constructor
+    CVideoRecorder(const CVideoRecorder&) = delete;
+    /// Assignment operator
+    CVideoRecorder& operator=(const CVideoRecorder&) = delete;
+};
+
+} // namespace rdr
+} // namespace eng
+
+#endif
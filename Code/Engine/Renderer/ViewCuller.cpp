@@ -0,0 +1,82 @@
+/**
+ *  @file       ViewCuller.cpp
+ *  @brief      CViewCuller class implementation
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ */
+
+#include "targetver.h"  // this needs to be the 1st header included
+
+#include "ViewCuller.h"
+
+namespace eng
+{
+namespace rdr
+{
+
+//-----------------------------------------------------------------------------------------------
+CViewCuller::CViewCuller(const CAABB2& aabbView, const CAABB2& aabbWrap) noexcept
+    : m_aabbView(aabbView),
+      m_aabbWrap(aabbWrap),
+      m_Stats{ 0, 0, 0 }
+{
+};
+
+//-----------------------------------------------------------------------------------------------
+void CViewCuller::BeginFrame(void) noexcept
+{
+    m_Stats.nDrawn  = 0;
+    m_Stats.nCulled = 0;
+    m_Stats.nGhosts = 0;
+};
+
+//-----------------------------------------------------------------------------------------------
+bool CViewCuller::Overlaps(const math::CVector2f& vCenter, float fRadius) const noexcept
+{
+    // circle vs. AABB: distance from the center to the closest point in the box
+    const math::CVector2f vClosest = vCenter.Clamp(m_aabbView.get_Min(), m_aabbView.get_Max());
+
+    return vCenter.CalcDistanceSquared(vClosest) <= (fRadius * fRadius);
+};
+
+//-----------------------------------------------------------------------------------------------
+size_t CViewCuller::Classify(const math::CVector2f& vCenter, float fRadius,
+                             math::CVector2f rgOffsets[k_nMaxViewInstances]) noexcept
+{
+    const float fWrapWidth  = m_aabbWrap.get_Max().X - m_aabbWrap.get_Min().X;
+    const float fWrapHeight = m_aabbWrap.get_Max().Y - m_aabbWrap.get_Min().Y;
+
+    // the primary instance first, then its ghosts one wrap width / height away
+    const float rgWrapX[3] = { 0.f, -fWrapWidth,  fWrapWidth  };
+    const float rgWrapY[3] = { 0.f, -fWrapHeight, fWrapHeight };
+
+    size_t nInstances = 0;
+    for (size_t y = 0; y < _countof(rgWrapY); y++)
+    {
+        for (size_t x = 0; x < _countof(rgWrapX); x++)
+        {
+            const math::CVector2f vOffset(rgWrapX[x], rgWrapY[y]);
+
+            // a view narrower than the wrap bounds holds at most two instances per axis
+            if (nInstances < k_nMaxViewInstances && Overlaps(vCenter + vOffset, fRadius))
+                rgOffsets[nInstances++] = vOffset;
+        }
+    }
+
+    if (nInstances == 0)
+    {
+        m_Stats.nCulled++;
+    }
+    else
+    {
+        m_Stats.nDrawn++;
+        m_Stats.nGhosts += nInstances - 1;
+    }
+
+    return nInstances;
+};
+
+} // namespace rdr
+} // namespace eng
@@ -0,0 +1,98 @@
+/**
+ *  @file       ViewCuller.h
+ *  @brief      CViewCuller class interface
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ *  <b>Implementation:</b>
+ *
+ *   Objects live on a torus, the wrap bounds, which may extend beyond the
+ *   view so objects leave the screen entirely before reappearing on the far
+ *   side.  An object near a wrap seam is also present one wrap width (or
+ *   height) away.  Classify() tests the primary instance and those wrap
+ *   "ghosts" against the view and returns the translation of every instance
+ *   that needs to be drawn, or none if the object lies entirely outside the
+ *   view, e.g. while it crosses the margin between view and wrap bounds.
+ */
+#pragma once
+
+#if !defined(__VIEW_CULLER_H__)
+#define __VIEW_CULLER_H__
+
+#ifndef __AABB2_H__
+    #include "Engine/Renderer/AABB2.h"
+#endif
+
+namespace eng
+{
+namespace rdr
+{
+
+/// primary instance + horizontal, vertical and corner ghosts
+constexpr size_t k_nMaxViewInstances = 4;
+
+struct CullStats
+{
+    size_t nDrawn;   ///< objects with at least one visible instance
+    size_t nCulled;  ///< objects entirely outside the view
+    size_t nGhosts;  ///< additional wrap instances drawn across a seam
+};
+
+class CViewCuller
+{
+    CAABB2    m_aabbView;
+    CAABB2    m_aabbWrap;
+    CullStats m_Stats;
+
+public:
+/**
+ *  @param [in] aabbView    the visible area
+ *  @param [in] aabbWrap    the bounds objects wrap around, containing the view
+ */
+    CViewCuller(const CAABB2& aabbView, const CAABB2& aabbWrap) noexcept;
+    /// Default Destructor
+    ~CViewCuller() = default;
+
+/**
+ *  @brief resets the per-frame statistics
+ */
+    void              BeginFrame  (void) noexcept;
+
+/**
+ *  @brief determines which instances of a bounding circle intersect the view
+ *
+ *  @param [in]  vCenter     object center, within the wrap bounds
+ *  @param [in]  fRadius     bounding radius of the rendered object
+ *  @param [out] rgOffsets   translations to apply for each visible instance,
+ *                           the primary instance (if visible) is always first
+ *
+ *  @retval size_t      number of visible instances written to rgOffsets
+ *  @retval 0           if the object was culled
+ */
+    size_t            Classify    (const math::CVector2f& vCenter, float fRadius,
+                                   math::CVector2f rgOffsets[k_nMaxViewInstances]) noexcept;
+
+    inline void       set_View    (const CAABB2& aabbView) noexcept
+    { m_aabbView = aabbView; };
+
+    inline void       set_Wrap    (const CAABB2& aabbWrap) noexcept
+    { m_aabbWrap = aabbWrap; };
+
+    constexpr const CAABB2&    get_View  (void) const noexcept
+    { return m_aabbView; };
+
+    constexpr const CAABB2&    get_Wrap  (void) const noexcept
+    { return m_aabbWrap; };
+
+    constexpr const CullStats& get_Stats (void) const noexcept
+    { return m_Stats; };
+
+private:
+    bool              Overlaps    (const math::CVector2f& vCenter, float fRadius) const noexcept;
+};
+
+} // namespace rdr
+} // namespace eng
+
+#endif
@@ -0,0 +1,236 @@
+/**
+ *  @file       AssetPack.cpp
+ *  @brief      CAssetPack and CAssetPackBuilder class implementations
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ */
+
+// turn off silly warnings that encourage use of xxxx_s functions
+#define _CRT_SECURE_NO_WARNINGS
+#include "targetver.h"  // this needs to be the 1st header included
+
+#include <stdio.h>
+#include <algorithm>
+#include <cstring>
+
+#include "Hash.h"
+#include "AssetPack.h"
+
+namespace eng
+{
+
+//-----------------------------------------------------------------------------------------------
+CAssetPack::CAssetPack() noexcept
+    : m_File(),
+      m_pEntries(nullptr),
+      m_nEntries(0)
+{
+};
+
+//-----------------------------------------------------------------------------------------------
+bool CAssetPack::Open(const char* szPackPath) noexcept
+{
+    Close();
+
+    if (!m_File.Open(szPackPath))
+        return false;
+
+    const unsigned char* pBase = m_File.get_Data();
+    const uint64_t       nSize = m_File.get_Size();
+
+    if (nSize < sizeof(PackHeader))
+    {
+        Close();
+        return false;
+    }
+
+    PackHeader hdr;
+    memcpy(&hdr, pBase, sizeof(hdr));
+
+    if (hdr.nMagic != k_nPackMagic || hdr.nVersion != k_nPackVersion ||
+        hdr.nIndexOffset % alignof(PackEntry) != 0 ||
+        hdr.nIndexOffset > nSize ||
+        hdr.nEntryCount > (nSize - hdr.nIndexOffset) / sizeof(PackEntry))
+    {
+        Close();
+        return false;
+    }
+
+    const PackEntry* pEntries = reinterpret_cast<const PackEntry*>(pBase + hdr.nIndexOffset);
+
+    // validate once here so Find/Get never have to range check
+    for (uint32_t i = 0; i < hdr.nEntryCount; i++)
+    {
+        const PackEntry& entry = pEntries[i];
+        if (entry.nOffset > nSize || entry.nSize > nSize - entry.nOffset ||
+            (i > 0 && pEntries[i - 1].nNameHash >= entry.nNameHash))
+        {
+            Close();
+            return false;
+        }
+    }
+
+    m_pEntries = pEntries;
+    m_nEntries = hdr.nEntryCount;
+    return true;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CAssetPack::Close(void) noexcept
+{
+    m_pEntries = nullptr;
+    m_nEntries = 0;
+    m_File.Close();
+};
+
+//-----------------------------------------------------------------------------------------------
+const PackEntry* CAssetPack::Find(uint64_t nNameHash) const noexcept
+{
+    const PackEntry* pEnd = m_pEntries + m_nEntries;
+    const PackEntry* pIt  = std::lower_bound(m_pEntries, pEnd, nNameHash,
+                                             [](const PackEntry& e, uint64_t n) { return e.nNameHash < n; });
+
+    return (pIt != pEnd && pIt->nNameHash == nNameHash) ? pIt : nullptr;
+};
+
+//-----------------------------------------------------------------------------------------------
+AssetView CAssetPack::Get(uint64_t nNameHash) const noexcept
+{
+    AssetView view = { nullptr, 0, AF_RAW };
+
+    const PackEntry* pEntry = Find(nNameHash);
+    if (pEntry)
+    {
+        view.pData   = m_File.get_Data() + pEntry->nOffset;
+        view.nSize   = static_cast<size_t>(pEntry->nSize);
+        view.eFormat = static_cast<ASSET_FORMAT>(pEntry->nFormat);
+    }
+    return view;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CAssetPackBuilder::AddFile(const char* szName, const char* szFilePath, ASSET_FORMAT eFormat)
+{
+    if (szName && szFilePath)
+    {
+        m_rgPending.push_back( { szName, szFilePath, util::HashPath(szName), eFormat } ); // note - may throw an exception
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+ASSET_FORMAT CAssetPackBuilder::FormatFromExtension(const char* szFilePath) noexcept
+{
+    ASSET_FORMAT eFormat = AF_RAW;
+
+    const char* szExt = szFilePath ? strrchr(szFilePath, '.') : nullptr;
+    if (szExt)
+    {
+        const uint64_t nExt = util::HashPath(szExt);
+
+        if (nExt == util::HashPath(".wav"))
+            eFormat = AF_WAVE;
+        else if (nExt == util::HashPath(".png") || nExt == util::HashPath(".tga") ||
+                 nExt == util::HashPath(".jpg") || nExt == util::HashPath(".bmp"))
+            eFormat = AF_IMAGE;
+    }
+    return eFormat;
+};
+
+//-----------------------------------------------------------------------------------------------
+bool CAssetPackBuilder::Write(const char* szPackPath)
+{
+    m_strLastError.clear();
+
+    std::sort(m_rgPending.begin(), m_rgPending.end(),
+              [](const PendingEntry& a, const PendingEntry& b) { return a.nNameHash < b.nNameHash; });
+
+    for (size_t i = 1; i < m_rgPending.size(); i++)
+    {
+        if (m_rgPending[i - 1].nNameHash == m_rgPending[i].nNameHash)
+        {
+            m_strLastError = "name hash collision: " + m_rgPending[i - 1].strName + " and " + m_rgPending[i].strName;
+            return false;
+        }
+    }
+
+    FILE* pOut = fopen(szPackPath, "wb");
+    if (pOut == nullptr)
+    {
+        m_strLastError = std::string("cannot create ") + szPackPath;
+        return false;
+    }
+
+    std::vector<PackEntry>     rgEntries(m_rgPending.size());
+    std::vector<unsigned char> rgBuffer;
+
+    const uint64_t nIndexOffset = sizeof(PackHeader);
+    uint64_t       nOffset      = nIndexOffset + rgEntries.size() * sizeof(PackEntry);
+
+    // reserve the header and index; both are rewritten once the offsets are known
+    std::vector<unsigned char> rgZero(static_cast<size_t>(nOffset), 0);
+    bool bResult = fwrite(rgZero.data(), 1, rgZero.size(), pOut) == rgZero.size();
+
+    static const unsigned char s_rgPad[k_nPackAlignment] = { 0 };
+
+    for (size_t i = 0; bResult && i < m_rgPending.size(); i++)
+    {
+        const PendingEntry& pending = m_rgPending[i];
+
+        FILE* pIn = fopen(pending.strFilePath.c_str(), "rb");
+        if (pIn == nullptr)
+        {
+            m_strLastError = "cannot open " + pending.strFilePath;
+            bResult = false;
+            break;
+        }
+
+        fseek(pIn, 0, SEEK_END);
+        const long lSize = ftell(pIn);
+        fseek(pIn, 0, SEEK_SET);
+
+        rgBuffer.resize(lSize > 0 ? static_cast<size_t>(lSize) : 0);
+        bResult = fread(rgBuffer.data(), 1, rgBuffer.size(), pIn) == rgBuffer.size();
+        fclose(pIn);
+
+        if (!bResult)
+        {
+            m_strLastError = "cannot read " + pending.strFilePath;
+            break;
+        }
+
+        const size_t nPad = static_cast<size_t>((k_nPackAlignment - nOffset % k_nPackAlignment) % k_nPackAlignment);
+        nOffset += nPad;
+
+        const uint64_t nContentHash = util::HashBytes(rgBuffer.data(), rgBuffer.size());
+
+        rgEntries[i] = { pending.nNameHash, nOffset, rgBuffer.size(), static_cast<uint32_t>(pending.eFormat),
+                         static_cast<uint32_t>(nContentHash ^ (nContentHash >> 32)) };
+
+        bResult = fwrite(s_rgPad, 1, nPad, pOut) == nPad &&
+                  fwrite(rgBuffer.data(), 1, rgBuffer.size(), pOut) == rgBuffer.size();
+        nOffset += rgBuffer.size();
+    }
+
+    if (bResult)
+    {
+        const PackHeader hdr = { k_nPackMagic, k_nPackVersion, 0, static_cast<uint32_t>(rgEntries.size()), 0, nIndexOffset };
+
+        bResult = fseek(pOut, 0, SEEK_SET) == 0 &&
+                  fwrite(&hdr, sizeof(hdr), 1, pOut) == 1 &&
+                  fwrite(rgEntries.data(), sizeof(PackEntry), rgEntries.size(), pOut) == rgEntries.size();
+
+        if (!bResult)
+            m_strLastError = std::string("cannot write ") + szPackPath;
+    }
+
+    bResult = (fclose(pOut) == 0) && bResult;
+
+    if (!bResult)
+        remove(szPackPath);
+
+    return bResult;
+};
+
+} // namespace eng
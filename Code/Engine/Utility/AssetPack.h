@@ -0,0 +1,183 @@
+/**
+ *  @file       AssetPack.h
+ *  @brief      CAssetPack and CAssetPackBuilder class interfaces
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ *  <b>Implementation:</b>
+ *
+ *   A pack is one file holding every asset, so a cold start costs a single
+ *   open and a page fault per touched page instead of an open/read/close
+ *   per loose file.  Layout (little-endian):
+ *
+ *      PackHeader
+ *      PackEntry[nEntryCount]      sorted by nNameHash
+ *      data blocks                 each aligned to k_nPackAlignment
+ *
+ *   Names are hashed with eng::util::HashPath, so "Assets\\Audio\\Fire.wav"
+ *   and "assets/audio/fire.wav" refer to the same entry.  The runtime maps
+ *   the pack read-only and AssetView points straight into the mapping.
+ */
+#pragma once
+
+#if !defined(__ASSET_PACK_H__)
+#define __ASSET_PACK_H__
+
+#ifndef _CSTDINT_
+    #include <cstdint>
+#endif
+
+#ifndef _STRING_
+    #include <string>
+#endif
+
+#ifndef _VECTOR_
+    #include <vector>
+#endif
+
+#ifndef __MAPPED_FILE_H__
+    #include "MappedFile.h"
+#endif
+
+namespace eng
+{
+
+enum ASSET_FORMAT : uint32_t
+{
+    AF_RAW   = 0,   ///< opaque bytes
+    AF_IMAGE = 1,   ///< encoded image (png, tga, jpg, ...) for stb_image
+    AF_WAVE  = 2,   ///< RIFF WAVE file
+};
+
+constexpr uint32_t k_nPackMagic     = 0x4B415041;   ///< 'APAK'
+constexpr uint16_t k_nPackVersion   = 1;
+constexpr uint64_t k_nPackAlignment = 16;
+
+struct PackHeader
+{
+    uint32_t nMagic;
+    uint16_t nVersion;
+    uint16_t nReserved;
+    uint32_t nEntryCount;
+    uint32_t nReserved2;
+    uint64_t nIndexOffset;
+};
+
+struct PackEntry
+{
+    uint64_t nNameHash;
+    uint64_t nOffset;       ///< from the start of the file
+    uint64_t nSize;
+    uint32_t nFormat;       ///< ASSET_FORMAT
+    uint32_t nContentHash;  ///< folded FNV-1a of the data, lets derived caches detect a changed asset
+};
+
+static_assert(sizeof(PackHeader) == 24, "PackHeader layout is part of the file format");
+static_assert(sizeof(PackEntry)  == 32, "PackEntry layout is part of the file format");
+
+/**
+ * @brief zero-copy view of one packed asset, valid while the pack is open
+ */
+struct AssetView
+{
+    const unsigned char* pData;
+    size_t               nSize;
+    ASSET_FORMAT         eFormat;
+
+    constexpr bool IsValid(void) const noexcept
+    { return pData != nullptr; };
+};
+
+//-----------------------------------------------------------------------------------------------
+class CAssetPack
+{
+    util::CMappedFile  m_File;
+    const PackEntry*   m_pEntries;
+    size_t             m_nEntries;
+
+public:
+    /// Default Constructor
+    CAssetPack() noexcept;
+    /// Default Destructor
+    ~CAssetPack() noexcept = default;
+
+/**
+ *  Maps the pack and validates its header and index
+ *
+ *  @retval true    on success
+ *  @retval false   if the file is missing, truncated, or not a pack
+ */
+    bool             Open           (const char* szPackPath) noexcept;
+    void             Close          (void) noexcept;
+
+    constexpr bool   IsOpen         (void) const noexcept
+    { return m_pEntries != nullptr; };
+
+    constexpr size_t get_EntryCount (void) const noexcept
+    { return m_nEntries; };
+
+/**
+ *  @retval const PackEntry*    the entry for the name hash
+ *  @retval nullptr             if not present
+ */
+    const PackEntry* Find           (uint64_t nNameHash) const noexcept;
+/**
+ *  @retval AssetView           pointing into the mapped pack, invalid if not present
+ */
+    AssetView        Get            (uint64_t nNameHash) const noexcept;
+
+private:
+    /// Copy constructor
+    CAssetPack(const CAssetPack&) = delete;
+    /// Assignment operator
+    CAssetPack& operator=(const CAssetPack&) = delete;
+};
+
+//-----------------------------------------------------------------------------------------------
+class CAssetPackBuilder
+{
+    struct PendingEntry
+    {
+        std::string  strName;
+        std::string  strFilePath;
+        uint64_t     nNameHash;
+        ASSET_FORMAT eFormat;
+    };
+
+    std::vector<PendingEntry> m_rgPending;
+    std::string               m_strLastError;
+
+public:
+    /// Default Constructor
+    CAssetPackBuilder() = default;
+
+/**
+ *  Queues a file to be packed under szName
+ *
+ *  @note - may throw an exception
+ */
+    void   AddFile          (const char* szName, const char* szFilePath, ASSET_FORMAT eFormat);
+/**
+ *  Writes every queued file into a new pack
+ *
+ *  @retval true    on success
+ *  @retval false   on I/O error or name-hash collision, see get_LastError
+ */
+    bool   Write            (const char* szPackPath);
+
+    size_t get_Count        (void) const noexcept
+    { return m_rgPending.size(); };
+
+    const std::string& get_LastError(void) const noexcept
+    { return m_strLastError; };
+
+/**
+ *  @retval ASSET_FORMAT    guessed from the file extension
+ */
+    static ASSET_FORMAT FormatFromExtension(const char* szFilePath) noexcept;
+};
+
+} // namespace eng
+
+#endif
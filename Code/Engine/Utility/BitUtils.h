@@ -0,0 +1,65 @@
+/**
+ *  @file       BitUtils.h
+ *  @brief      bit scan helpers for the voice and event masks
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ *  <b>Implementation:</b>
+ *
+ *   One instruction on both compilers: _BitScanForward under MSVC,
+ *   __builtin_ctz elsewhere.  Masks are walked lowest bit first with
+ *
+ *      for (uint32_t nMask = ...; nMask; nMask &= nMask - 1)
+ *          Visit( eng::util::LowestSetBit(nMask) );
+ */
+#pragma once
+
+#if !defined(__BIT_UTILS_H__)
+#define __BIT_UTILS_H__
+
+#ifndef _CSTDINT_
+    #include <cstdint>
+#endif
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+namespace eng
+{
+namespace util
+{
+
+//-----------------------------------------------------------------------------------------------
+/// @retval int   index of the lowest set bit, -1 when nMask is 0
+inline int LowestSetBit(uint32_t nMask) noexcept
+{
+#if defined(_MSC_VER)
+    unsigned long iBit = 0;
+    return _BitScanForward(&iBit, nMask) ? static_cast<int>(iBit) : -1;
+#else
+    return nMask ? __builtin_ctz(nMask) : -1;
+#endif
+};
+
+//-----------------------------------------------------------------------------------------------
+/// @retval int   index of the lowest set bit, -1 when nMask is 0
+inline int LowestSetBit(uint64_t nMask) noexcept
+{
+#if defined(_MSC_VER)
+    // _BitScanForward64 is x64 only; scan the halves for the Win32 build
+    unsigned long iBit = 0;
+    if (_BitScanForward(&iBit, static_cast<uint32_t>(nMask)))
+        return static_cast<int>(iBit);
+
+    return _BitScanForward(&iBit, static_cast<uint32_t>(nMask >> 32)) ? static_cast<int>(iBit) + 32 : -1;
+#else
+    return nMask ? __builtin_ctzll(nMask) : -1;
+#endif
+};
+
+} // namespace util
+} // namespace eng
+
+#endif
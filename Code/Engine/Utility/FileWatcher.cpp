@@ -0,0 +1,347 @@
+/**
+ *  @file       FileWatcher.cpp
+ *  @brief      CFileWatcher class implementation
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ * <b>Cite:</b>
+ *
+ * @sa https://docs.microsoft.com/en-us/windows/win32/api/winbase/nf-winbase-readdirectorychangesw
+ * @sa https://man7.org/linux/man-pages/man7/inotify.7.html
+ */
+
+#define WIN32_LEAN_AND_MEAN
+#include "targetver.h"  // this needs to be the 1st header included
+
+#include <algorithm>
+#include <filesystem>
+
+#ifdef _WIN32
+    #include <Windows.h>
+#else
+    #include <poll.h>
+    #include <sys/inotify.h>
+    #include <unistd.h>
+#endif
+
+#include "FileWatcher.h"
+
+namespace eng
+{
+namespace util
+{
+
+//-----------------------------------------------------------------------------------------------
+CFileWatcher::CFileWatcher() noexcept
+    : m_strRoot(),
+      m_thWatcher(),
+      m_mtxPending(),
+      m_mapPending(),
+      m_bShutdown(false),
+#ifdef _WIN32
+      m_hDirectory(nullptr),
+      m_hStopEvent(nullptr)
+#else
+      m_iNotify(-1),
+      m_mapWatches()
+#endif
+{
+};
+
+//-----------------------------------------------------------------------------------------------
+CFileWatcher::~CFileWatcher()
+{
+    Stop();
+};
+
+//-----------------------------------------------------------------------------------------------
+void CFileWatcher::Record(std::string&& strPath) noexcept
+{
+    std::replace(strPath.begin(), strPath.end(), '\\', '/');
+
+    std::lock_guard<std::mutex> lock(m_mtxPending);
+    try
+    {
+        m_mapPending[std::move(strPath)] = std::chrono::steady_clock::now();
+    }
+    catch (...)
+    {
+        // a lost change notification only means a missed reload
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+size_t CFileWatcher::PollChanges(std::vector<std::string>& rgPaths)
+{
+    const time_point tmNow    = std::chrono::steady_clock::now();
+    const size_t     nInitial = rgPaths.size();
+
+    std::lock_guard<std::mutex> lock(m_mtxPending);
+    for (auto it = m_mapPending.begin(); it != m_mapPending.end(); )
+    {
+        if (tmNow - it->second >= k_tmFileWatchDebounce)
+        {
+            rgPaths.push_back(it->first); // note - may throw an exception
+            it = m_mapPending.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    return rgPaths.size() - nInitial;
+};
+
+#ifdef _WIN32
+
+//-----------------------------------------------------------------------------------------------
+bool CFileWatcher::Start(const char* szRootDirectory)
+{
+    if (IsRunning() || szRootDirectory == nullptr)
+        return IsRunning();
+
+    HANDLE hDirectory = ::CreateFileA(szRootDirectory, FILE_LIST_DIRECTORY,
+                                      FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+                                      OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
+    if (hDirectory == INVALID_HANDLE_VALUE)
+        return false;
+
+    HANDLE hStopEvent = ::CreateEvent(nullptr, TRUE, FALSE, nullptr);
+    if (hStopEvent == nullptr)
+    {
+        ::CloseHandle(hDirectory);
+        return false;
+    }
+
+    m_strRoot    = szRootDirectory; // note - may throw an exception
+    m_hDirectory = hDirectory;
+    m_hStopEvent = hStopEvent;
+    m_bShutdown  = false;
+
+    try
+    {
+        m_thWatcher = std::thread(&CFileWatcher::WatchProc, this); // note - may throw an exception
+    }
+    catch (...)
+    {
+        Stop();
+        throw;
+    }
+    return true;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CFileWatcher::Stop(void) noexcept
+{
+    m_bShutdown = true;
+
+    if (m_thWatcher.joinable())
+    {
+        ::SetEvent(m_hStopEvent);
+        m_thWatcher.join();
+    }
+
+    if (m_hDirectory)
+        ::CloseHandle(m_hDirectory);
+    if (m_hStopEvent)
+        ::CloseHandle(m_hStopEvent);
+
+    m_hDirectory = nullptr;
+    m_hStopEvent = nullptr;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CFileWatcher::WatchProc(void) noexcept
+{
+    constexpr DWORD k_dwFilter = FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_SIZE;
+
+    alignas(DWORD) BYTE rgBuffer[16 * 1024];
+    char                szPath[MAX_PATH * 3] = { 0 };
+
+    OVERLAPPED ov = { };
+    ov.hEvent = ::CreateEvent(nullptr, TRUE, FALSE, nullptr);
+    if (ov.hEvent == nullptr)
+        return;
+
+    while (!m_bShutdown)
+    {
+        ::ResetEvent(ov.hEvent);
+        if (!::ReadDirectoryChangesW(m_hDirectory, rgBuffer, sizeof(rgBuffer), TRUE, k_dwFilter, nullptr, &ov, nullptr))
+            break;
+
+        HANDLE rgWait[2] = { ov.hEvent, m_hStopEvent };
+        if (::WaitForMultipleObjects(2, rgWait, FALSE, INFINITE) != WAIT_OBJECT_0)
+        {
+            DWORD dwIgnored = 0;
+            ::CancelIo(m_hDirectory);
+            ::GetOverlappedResult(m_hDirectory, &ov, &dwIgnored, TRUE);
+            break;
+        }
+
+        DWORD dwBytes = 0;
+        if (!::GetOverlappedResult(m_hDirectory, &ov, &dwBytes, FALSE))
+            break;
+
+        // 0 bytes means the buffer overflowed and this batch of changes was lost
+        for (DWORD dwOffset = 0; dwBytes > 0; )
+        {
+            const FILE_NOTIFY_INFORMATION* pInfo = reinterpret_cast<const FILE_NOTIFY_INFORMATION*>(rgBuffer + dwOffset);
+
+            if (pInfo->Action == FILE_ACTION_ADDED || pInfo->Action == FILE_ACTION_MODIFIED ||
+                pInfo->Action == FILE_ACTION_RENAMED_NEW_NAME)
+            {
+                const int iLen = ::WideCharToMultiByte(CP_UTF8, 0, pInfo->FileName,
+                                                       static_cast<int>(pInfo->FileNameLength / sizeof(WCHAR)),
+                                                       szPath, static_cast<int>(sizeof(szPath) - 1), nullptr, nullptr);
+                if (iLen > 0)
+                {
+                    try
+                    {
+                        Record(std::string(szPath, iLen));
+                    }
+                    catch (...)
+                    {
+                    }
+                }
+            }
+
+            if (pInfo->NextEntryOffset == 0)
+                break;
+            dwOffset += pInfo->NextEntryOffset;
+        }
+    }
+
+    ::CloseHandle(ov.hEvent);
+};
+
+#else
+
+//-----------------------------------------------------------------------------------------------
+bool CFileWatcher::Start(const char* szRootDirectory)
+{
+    if (IsRunning() || szRootDirectory == nullptr)
+        return IsRunning();
+
+    m_iNotify = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (m_iNotify < 0)
+        return false;
+
+    m_strRoot   = szRootDirectory; // note - may throw an exception
+    m_bShutdown = false;
+
+    // inotify is not recursive; every directory gets its own watch
+    AddWatches(std::string());
+    if (m_mapWatches.empty())
+    {
+        Stop();
+        return false;
+    }
+
+    try
+    {
+        m_thWatcher = std::thread(&CFileWatcher::WatchProc, this); // note - may throw an exception
+    }
+    catch (...)
+    {
+        Stop();
+        throw;
+    }
+    return true;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CFileWatcher::AddWatches(const std::string& strRelDir) noexcept
+{
+    constexpr uint32_t k_nMask = IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE;
+
+    try
+    {
+        const std::filesystem::path pathRoot(m_strRoot);
+        const std::filesystem::path pathDir = strRelDir.empty() ? pathRoot : pathRoot / strRelDir;
+
+        const int iWatch = ::inotify_add_watch(m_iNotify, pathDir.c_str(), k_nMask);
+        if (iWatch >= 0)
+            m_mapWatches[iWatch] = strRelDir;
+
+        std::error_code ec;
+        for (std::filesystem::recursive_directory_iterator it(pathDir, ec), itEnd; !ec && it != itEnd; it.increment(ec))
+        {
+            if (it->is_directory(ec))
+            {
+                const int iSubWatch = ::inotify_add_watch(m_iNotify, it->path().c_str(), k_nMask);
+                if (iSubWatch >= 0)
+                    m_mapWatches[iSubWatch] = it->path().lexically_relative(pathRoot).generic_string();
+            }
+        }
+    }
+    catch (...)
+    {
+        // unwatched directories only miss reloads
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+void CFileWatcher::Stop(void) noexcept
+{
+    m_bShutdown = true;
+
+    if (m_thWatcher.joinable())
+        m_thWatcher.join();
+
+    if (m_iNotify >= 0)
+        ::close(m_iNotify);
+
+    m_iNotify = -1;
+    m_mapWatches.clear();
+};
+
+//-----------------------------------------------------------------------------------------------
+void CFileWatcher::WatchProc(void) noexcept
+{
+    alignas(inotify_event) char rgBuffer[16 * 1024];
+
+    while (!m_bShutdown)
+    {
+        // wake periodically so Stop() never waits on a quiet directory for long
+        pollfd pfd = { m_iNotify, POLLIN, 0 };
+        if (::poll(&pfd, 1, 100) <= 0)
+            continue;
+
+        const ssize_t nBytes = ::read(m_iNotify, rgBuffer, sizeof(rgBuffer));
+        for (ssize_t nOffset = 0; nOffset < nBytes; )
+        {
+            const inotify_event* pEvent = reinterpret_cast<const inotify_event*>(rgBuffer + nOffset);
+            nOffset += sizeof(inotify_event) + pEvent->len;
+
+            const auto it = m_mapWatches.find(pEvent->wd);
+            if (it == m_mapWatches.end() || pEvent->len == 0)
+                continue;
+
+            try
+            {
+                std::string strPath = it->second.empty() ? std::string(pEvent->name)
+                                                         : it->second + '/' + pEvent->name;
+                if (pEvent->mask & IN_ISDIR)
+                {
+                    if (pEvent->mask & (IN_CREATE | IN_MOVED_TO))
+                        AddWatches(strPath);
+                }
+                else if (pEvent->mask & (IN_CLOSE_WRITE | IN_MOVED_TO))
+                {
+                    // IN_CREATE alone is followed by IN_CLOSE_WRITE once the file is written
+                    Record(std::move(strPath));
+                }
+            }
+            catch (...)
+            {
+            }
+        }
+    }
+};
+
+#endif
+
+} // namespace util
+} // namespace eng
@@ -0,0 +1,115 @@
+/**
+ *  @file       FileWatcher.h
+ *  @brief      CFileWatcher class interface
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ *  <b>Implementation:</b>
+ *
+ *   Watches a directory tree on a background thread (ReadDirectoryChangesW
+ *   on Windows, inotify elsewhere) and collects the relative paths of
+ *   files that were written, created or renamed into place.  Editors tend
+ *   to save in several writes, so a path is only reported by PollChanges()
+ *   once it has been quiet for the debounce interval.
+ *
+ *   Paths are relative to the watched root and use '/' separators.
+ */
+#pragma once
+
+#if !defined(__FILE_WATCHER_H__)
+#define __FILE_WATCHER_H__
+
+#ifndef _ATOMIC_
+    #include <atomic>
+#endif
+
+#ifndef _CHRONO_
+    #include <chrono>
+#endif
+
+#ifndef _MUTEX_
+    #include <mutex>
+#endif
+
+#ifndef _STRING_
+    #include <string>
+#endif
+
+#ifndef _THREAD_
+    #include <thread>
+#endif
+
+#ifndef _UNORDERED_MAP_
+    #include <unordered_map>
+#endif
+
+#ifndef _VECTOR_
+    #include <vector>
+#endif
+
+namespace eng
+{
+namespace util
+{
+
+constexpr std::chrono::milliseconds k_tmFileWatchDebounce(150);
+
+class CFileWatcher
+{
+    typedef std::chrono::steady_clock::time_point time_point;
+
+    std::string                             m_strRoot;
+    std::thread                             m_thWatcher;
+    std::mutex                              m_mtxPending;
+    std::unordered_map<std::string, time_point> m_mapPending;   ///< path -> time of the last change
+    std::atomic<bool>                       m_bShutdown;
+#ifdef _WIN32
+    void*                                   m_hDirectory;       ///< HANDLE
+    void*                                   m_hStopEvent;       ///< HANDLE
+#else
+    int                                     m_iNotify;
+    std::unordered_map<int, std::string>    m_mapWatches;       ///< watch descriptor -> relative directory
+#endif
+
+public:
+    /// Default Constructor
+    CFileWatcher() noexcept;
+    /// Default Destructor, stops the watcher thread
+    ~CFileWatcher() noexcept;
+
+/**
+ *  @retval true    if the directory is being watched
+ *  @retval false   if it cannot be opened or the thread cannot be started
+ */
+    bool   Start        (const char* szRootDirectory);
+    void   Stop         (void) noexcept;
+
+    bool   IsRunning    (void) const noexcept
+    { return m_thWatcher.joinable(); };
+
+/**
+ *  @brief moves paths that have settled into rgPaths; never waits on I/O
+ *
+ *  @retval size_t      number of paths appended
+ */
+    size_t PollChanges  (std::vector<std::string>& rgPaths);
+
+private:
+    void   WatchProc    (void) noexcept;
+    void   Record       (std::string&& strPath) noexcept;
+
+#ifndef _WIN32
+    void   AddWatches   (const std::string& strRelDir) noexcept;
+#endif
+
+    /// Copy constructor
+    CFileWatcher(const CFileWatcher&) = delete;
+    /// Assignment operator
+    CFileWatcher& operator=(const CFileWatcher&) = delete;
+};
+
+} // namespace util
+} // namespace eng
+
+#endif
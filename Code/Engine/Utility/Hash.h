@@ -0,0 +1,122 @@
+/**
+ *  @file       Hash.h
+ *  @brief      compile-time capable string and path hashing
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ *  <b>Implementation:</b>
+ *
+ *   64-bit FNV-1a.  The string and path functions are constexpr, so a
+ *   literal path can be hashed once at compile time and used as a lookup
+ *   key, e.g.:
+ *
+ *      constexpr uint64_t k_nShipTexture = eng::util::HashPath("Data/Images/Ship.png");
+ *
+ * <b>Cite:</b>
+ *
+ * @sa http://www.isthe.com/chongo/tech/comp/fnv/index.html
+ */
+#pragma once
+
+#if !defined(__HASH_H__)
+#define __HASH_H__
+
+#ifndef _CSTDDEF_
+    #include <cstddef>
+#endif
+
+#ifndef _CSTDINT_
+    #include <cstdint>
+#endif
+
+namespace eng
+{
+namespace util
+{
+
+constexpr uint64_t k_nFnvOffsetBasis = 14695981039346656037ull;
+constexpr uint64_t k_nFnvPrime       = 1099511628211ull;
+
+//-----------------------------------------------------------------------------------------------
+inline uint64_t HashBytes(const void* pData, size_t nBytes, uint64_t nHash = k_nFnvOffsetBasis) noexcept
+{
+    const unsigned char* pByte = static_cast<const unsigned char*>(pData);
+    for (size_t i = 0; i < nBytes; i++)
+    {
+        nHash ^= pByte[i];
+        nHash *= k_nFnvPrime;
+    }
+    return nHash;
+};
+
+//-----------------------------------------------------------------------------------------------
+constexpr uint64_t HashString(const char* sz, uint64_t nHash = k_nFnvOffsetBasis) noexcept
+{
+    if (sz)
+    {
+        for (; *sz; sz++)
+        {
+            nHash ^= static_cast<unsigned char>(*sz);
+            nHash *= k_nFnvPrime;
+        }
+    }
+    return nHash;
+};
+
+//-----------------------------------------------------------------------------------------------
+/**
+ *  @brief hashes a file path the way the file system compares it: ASCII
+ *         case is ignored and '\\' and '/' are the same separator
+ */
+constexpr uint64_t HashPath(const char* szPath, uint64_t nHash = k_nFnvOffsetBasis) noexcept
+{
+    if (szPath)
+    {
+        for (; *szPath; szPath++)
+        {
+            unsigned char ch = static_cast<unsigned char>(*szPath);
+            if (ch >= 'A' && ch <= 'Z')
+                ch = static_cast<unsigned char>(ch - 'A' + 'a');
+            else if (ch == '\\')
+                ch = '/';
+
+            nHash ^= ch;
+            nHash *= k_nFnvPrime;
+        }
+    }
+    return nHash;
+};
+
+//-----------------------------------------------------------------------------------------------
+/**
+ *  @brief wide-character overload for TCHAR paths; ASCII paths hash the
+ *         same as the narrow version, other code units are folded to their
+ *         low byte
+ */
+constexpr uint64_t HashPath(const wchar_t* szPath, uint64_t nHash = k_nFnvOffsetBasis) noexcept
+{
+    if (szPath)
+    {
+        for (; *szPath; szPath++)
+        {
+            unsigned char ch = static_cast<unsigned char>(*szPath);
+            if (ch >= 'A' && ch <= 'Z')
+                ch = static_cast<unsigned char>(ch - 'A' + 'a');
+            else if (ch == '\\')
+                ch = '/';
+
+            nHash ^= ch;
+            nHash *= k_nFnvPrime;
+        }
+    }
+    return nHash;
+};
+
+static_assert(HashPath(L"Assets\\Audio\\Fire.wav") == HashPath("assets/audio/fire.wav"),
+              "narrow and wide path hashes must agree");
+
+}
+}
+
+#endif
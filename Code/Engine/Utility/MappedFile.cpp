@@ -0,0 +1,183 @@
+/**
+ *  @file       MappedFile.cpp
+ *  @brief      CMappedFile class implementation
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ * <b>Cite:</b>
+ *
+ * @sa https://docs.microsoft.com/en-us/windows/win32/memory/file-mapping
+ */
+
+#define WIN32_LEAN_AND_MEAN
+#include "targetver.h"  // this needs to be the 1st header included
+
+#ifdef _WIN32
+    #include <Windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#include "MappedFile.h"
+
+namespace eng
+{
+namespace util
+{
+
+//-----------------------------------------------------------------------------------------------
+CMappedFile::CMappedFile() noexcept
+    : m_pData(nullptr),
+      m_nSize(0),
+#ifdef _WIN32
+      m_hFile(nullptr),
+      m_hMapping(nullptr)
+#else
+      m_iFile(-1)
+#endif
+{
+};
+
+//-----------------------------------------------------------------------------------------------
+CMappedFile::CMappedFile(CMappedFile&& o) noexcept
+    : m_pData(o.m_pData),
+      m_nSize(o.m_nSize),
+#ifdef _WIN32
+      m_hFile(o.m_hFile),
+      m_hMapping(o.m_hMapping)
+#else
+      m_iFile(o.m_iFile)
+#endif
+{
+    o.m_pData    = nullptr;
+    o.m_nSize    = 0;
+#ifdef _WIN32
+    o.m_hFile    = nullptr;
+    o.m_hMapping = nullptr;
+#else
+    o.m_iFile    = -1;
+#endif
+};
+
+//-----------------------------------------------------------------------------------------------
+CMappedFile::~CMappedFile()
+{
+    Close();
+};
+
+#ifdef _WIN32
+
+//-----------------------------------------------------------------------------------------------
+bool CMappedFile::Open(const char* szFilePath) noexcept
+{
+    Close();
+
+    if (szFilePath == nullptr)
+        return false;
+
+    HANDLE hFile = ::CreateFileA(szFilePath, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                 FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+    if (hFile == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER liSize = { };
+    if (!::GetFileSizeEx(hFile, &liSize) || liSize.QuadPart == 0 ||
+        static_cast<unsigned long long>(liSize.QuadPart) > static_cast<size_t>(-1))
+    {
+        ::CloseHandle(hFile);
+        return false;
+    }
+
+    HANDLE hMapping = ::CreateFileMapping(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (hMapping == nullptr)
+    {
+        ::CloseHandle(hFile);
+        return false;
+    }
+
+    const void* pView = ::MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+    if (pView == nullptr)
+    {
+        ::CloseHandle(hMapping);
+        ::CloseHandle(hFile);
+        return false;
+    }
+
+    m_hFile    = hFile;
+    m_hMapping = hMapping;
+    m_pData    = static_cast<const unsigned char*>(pView);
+    m_nSize    = static_cast<size_t>(liSize.QuadPart);
+    return true;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CMappedFile::Close(void) noexcept
+{
+    if (m_pData)
+        ::UnmapViewOfFile(m_pData);
+    if (m_hMapping)
+        ::CloseHandle(m_hMapping);
+    if (m_hFile)
+        ::CloseHandle(m_hFile);
+
+    m_pData    = nullptr;
+    m_nSize    = 0;
+    m_hMapping = nullptr;
+    m_hFile    = nullptr;
+};
+
+#else
+
+//-----------------------------------------------------------------------------------------------
+bool CMappedFile::Open(const char* szFilePath) noexcept
+{
+    Close();
+
+    if (szFilePath == nullptr)
+        return false;
+
+    const int iFile = ::open(szFilePath, O_RDONLY);
+    if (iFile < 0)
+        return false;
+
+    struct stat st = { };
+    if (::fstat(iFile, &st) != 0 || st.st_size <= 0)
+    {
+        ::close(iFile);
+        return false;
+    }
+
+    void* pView = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, iFile, 0);
+    if (pView == MAP_FAILED)
+    {
+        ::close(iFile);
+        return false;
+    }
+
+    m_iFile = iFile;
+    m_pData = static_cast<const unsigned char*>(pView);
+    m_nSize = static_cast<size_t>(st.st_size);
+    return true;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CMappedFile::Close(void) noexcept
+{
+    if (m_pData)
+        ::munmap(const_cast<unsigned char*>(m_pData), m_nSize);
+    if (m_iFile >= 0)
+        ::close(m_iFile);
+
+    m_pData = nullptr;
+    m_nSize = 0;
+    m_iFile = -1;
+};
+
+#endif
+
+} // namespace util
+} // namespace eng
@@ -0,0 +1,74 @@
+/**
+ *  @file       MappedFile.h
+ *  @brief      CMappedFile class interface
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ *  <b>Implementation:</b>
+ *
+ *   Read-only memory mapping of a whole file (MapViewOfFile on Windows,
+ *   mmap elsewhere).  Pages are faulted in by the OS on first touch, so
+ *   opening a large file costs no reads and data can be handed to decoders
+ *   without copying.
+ */
+#pragma once
+
+#if !defined(__MAPPED_FILE_H__)
+#define __MAPPED_FILE_H__
+
+#ifndef _CSTDDEF_
+    #include <cstddef>
+#endif
+
+namespace eng
+{
+namespace util
+{
+
+class CMappedFile
+{
+    const unsigned char* m_pData;
+    size_t               m_nSize;
+#ifdef _WIN32
+    void*                m_hFile;       ///< HANDLE
+    void*                m_hMapping;    ///< HANDLE
+#else
+    int                  m_iFile;
+#endif
+
+public:
+    /// Default Constructor
+    CMappedFile() noexcept;
+    /// Move Constructor
+    CMappedFile(CMappedFile&& o) noexcept;
+    /// Default Destructor, unmaps the file
+    ~CMappedFile() noexcept;
+
+/**
+ *  @retval true    if the file is open and mapped
+ *  @retval false   if the file cannot be opened, is empty, or cannot be mapped
+ */
+    bool                 Open       (const char* szFilePath) noexcept;
+    void                 Close      (void) noexcept;
+
+    constexpr bool       IsOpen     (void) const noexcept
+    { return m_pData != nullptr; };
+
+    constexpr const unsigned char* get_Data (void) const noexcept
+    { return m_pData; };
+
+    constexpr size_t     get_Size   (void) const noexcept
+    { return m_nSize; };
+
+private:
+    /// Copy constructor
+    CMappedFile(const CMappedFile&) = delete;
+    /// Assignment operator
+    CMappedFile& operator=(const CMappedFile&) = delete;
+};
+
+} // namespace util
+} // namespace eng
+
+#endif
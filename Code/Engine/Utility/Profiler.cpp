@@ -0,0 +1,191 @@
+/**
+ *  @file       Profiler.cpp
+ *  @brief      CProfiler class implementation
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ * <b>Cite:</b>
+ *
+ * @sa https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU (Trace Event Format)
+ */
+
+#define _CRT_SECURE_NO_WARNINGS
+#include "targetver.h"  // this needs to be the 1st header included
+
+#include <new>
+
+#include "Profiler.h"
+
+namespace eng
+{
+namespace util
+{
+
+//-----------------------------------------------------------------------------------------------
+CProfiler::CProfiler() noexcept
+    : m_rgRings(),
+      m_nRings(0),
+      m_bRunning(false),
+      m_nStartStamp(0),
+      m_tmStart()
+{
+    for (int i = 0; i < k_nMaxProfileThreads; i++)
+        m_rgRings[i].store(nullptr, std::memory_order_relaxed);
+};
+
+//-----------------------------------------------------------------------------------------------
+CProfiler::~CProfiler() noexcept
+{
+    for (int i = 0; i < k_nMaxProfileThreads; i++)
+        delete m_rgRings[i].load(std::memory_order_acquire);
+};
+
+//-----------------------------------------------------------------------------------------------
+void CProfiler::Start( void ) noexcept
+{
+    if (IsRunning())
+        return;
+
+    m_tmStart     = std::chrono::steady_clock::now();
+    m_nStartStamp = ReadTimeStamp();
+    m_bRunning.store(true, std::memory_order_release);
+};
+
+//-----------------------------------------------------------------------------------------------
+void CProfiler::Stop( void ) noexcept
+{
+    m_bRunning.store(false, std::memory_order_release);
+};
+
+//-----------------------------------------------------------------------------------------------
+CProfiler::ThreadRing* CProfiler::AcquireRing( void ) noexcept
+{
+    // a thread claims a slot on its first zone and keeps it
+    struct ThreadSlot
+    {
+        const CProfiler* pOwner;
+        ThreadRing*      pRing;
+    };
+    static thread_local ThreadSlot t_slot = { nullptr, nullptr };
+
+    if (t_slot.pOwner == this)
+        return t_slot.pRing;
+
+    t_slot.pOwner = this;
+    t_slot.pRing  = nullptr;
+
+    const int iSlot = m_nRings.fetch_add(1, std::memory_order_relaxed);
+    if (iSlot >= k_nMaxProfileThreads)
+        return nullptr;     // this thread's zones are not kept
+
+    ThreadRing* pRing = new (std::nothrow) ThreadRing;
+    if (pRing == nullptr)
+        return nullptr;
+
+    pRing->nWrite.store(0, std::memory_order_relaxed);
+    pRing->iThread = iSlot + 1;
+
+    m_rgRings[iSlot].store(pRing, std::memory_order_release);
+    t_slot.pRing = pRing;
+    return pRing;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CProfiler::Record( const char* szName, uint64_t nBegin, uint64_t nEnd ) noexcept
+{
+    if (!m_bRunning.load(std::memory_order_acquire) || nBegin < m_nStartStamp)
+        return;
+
+    ThreadRing* pRing = AcquireRing();
+    if (pRing == nullptr)
+        return;
+
+    const uint32_t nWrite = pRing->nWrite.load(std::memory_order_relaxed);
+    pRing->rgZones[nWrite & (k_nProfileRing - 1)] = ProfileZone{ szName, nBegin, nEnd };
+    pRing->nWrite.store(nWrite + 1, std::memory_order_release);
+};
+
+//-----------------------------------------------------------------------------------------------
+size_t CProfiler::get_ZoneCount( void ) const noexcept
+{
+    size_t nZones = 0;
+
+    for (int i = 0; i < k_nMaxProfileThreads; i++)
+    {
+        const ThreadRing* pRing = m_rgRings[i].load(std::memory_order_acquire);
+        if (pRing)
+        {
+            const uint32_t nWrite = pRing->nWrite.load(std::memory_order_acquire);
+            nZones += (nWrite < k_nProfileRing) ? nWrite : k_nProfileRing;
+        }
+    }
+    return nZones;
+};
+
+//-----------------------------------------------------------------------------------------------
+bool CProfiler::WriteChromeTrace( const char* szFileName ) const noexcept
+{
+    if (szFileName == nullptr)
+        return false;
+
+    FILE* pFile = fopen(szFileName, "w");
+    if (pFile == nullptr)
+        return false;
+
+    WriteChromeTrace(pFile);
+    return fclose(pFile) == 0;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CProfiler::WriteChromeTrace( FILE* pFile ) const noexcept
+{
+    if (pFile == nullptr)
+        return;
+
+    // counter ticks per microsecond, over the whole run so far
+    const double dMicroseconds = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - m_tmStart).count();
+    const double dTicks        = static_cast<double>(ReadTimeStamp() - m_nStartStamp);
+    const double dTicksPerUs   = (dMicroseconds > 0.0 && dTicks > 0.0) ? dTicks / dMicroseconds : 1.0;
+
+    fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", pFile);
+
+    bool bFirst = true;
+    for (int i = 0; i < k_nMaxProfileThreads; i++)
+    {
+        const ThreadRing* pRing = m_rgRings[i].load(std::memory_order_acquire);
+        if (pRing == nullptr)
+            continue;
+
+        const uint32_t nWrite = pRing->nWrite.load(std::memory_order_acquire);
+        const uint32_t nHeld  = (nWrite < k_nProfileRing) ? nWrite : static_cast<uint32_t>(k_nProfileRing);
+
+        fprintf(pFile, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"thread %d\"}}",
+                bFirst ? "" : ",\n", pRing->iThread, pRing->iThread);
+        bFirst = false;
+
+        // oldest first
+        for (uint32_t n = nWrite - nHeld; n != nWrite; n++)
+        {
+            const ProfileZone& zone = pRing->rgZones[n & (k_nProfileRing - 1)];
+
+            const double dBegin = static_cast<double>(zone.nBegin - m_nStartStamp) / dTicksPerUs;
+            const double dSpan  = (zone.nEnd > zone.nBegin) ? static_cast<double>(zone.nEnd - zone.nBegin) / dTicksPerUs : 0.0;
+
+            fputs(",\n{\"name\":\"", pFile);
+            for (const char* p = zone.szName ? zone.szName : "?"; *p; p++)
+            {
+                if (*p == '"' || *p == '\\')
+                    fputc('\\', pFile);
+                fputc(*p, pFile);
+            }
+            fprintf(pFile, "\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+                    pRing->iThread, dBegin, dSpan);
+        }
+    }
+
+    fputs("\n]}\n", pFile);
+};
+
+} // namespace util
+} // namespace eng
@@ -0,0 +1,186 @@
+/**
+ *  @file       Profiler.h
+ *  @brief      CProfiler class interface and the PROFILE_SCOPE macro
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ *  <b>Implementation:</b>
+ *
+ *   PROFILE_SCOPE("name") times the rest of the enclosing block.  The zone
+ *   is stamped with the CPU time stamp counter on entry and exit and, once
+ *   the profiler is started, appended to a ring owned by the calling
+ *   thread: one plain store and one release increment, no lock and no
+ *   allocation after the thread's first zone.  A full ring overwrites its
+ *   oldest zones, so a long run keeps its most recent k_nProfileRing zones
+ *   per thread.
+ *
+ *   Zones nest by time; WriteChromeTrace() writes them as complete ("X")
+ *   trace_event records, which chrome://tracing and Perfetto draw as a
+ *   per-thread flame graph.  The counter is converted to microseconds with
+ *   a rate measured against the steady clock between Start() and the
+ *   export.  Export once the instrumented threads are idle.
+ *
+ *   Unless ENG_ENABLE_PROFILER is defined, PROFILE_SCOPE compiles to
+ *   nothing and the instrumented code carries no cost.  The Profile
+ *   solution configuration is Release plus that define, and builds
+ *   EngineP.lib and GameP.exe beside the Release outputs.
+ */
+#pragma once
+
+#if !defined(__PROFILER_H__)
+#define __PROFILER_H__
+
+#ifndef _ATOMIC_
+    #include <atomic>
+#endif
+
+#ifndef _CHRONO_
+    #include <chrono>
+#endif
+
+#ifndef _CSTDINT_
+    #include <cstdint>
+#endif
+
+#ifndef _CSTDIO_
+    #include <cstdio>
+#endif
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h>
+#endif
+
+namespace eng
+{
+namespace util
+{
+
+constexpr size_t k_nProfileRing       = 1 << 16;   ///< zones kept per thread, power of two
+constexpr int    k_nMaxProfileThreads = 16;
+
+static_assert((k_nProfileRing & (k_nProfileRing - 1)) == 0, "k_nProfileRing must be a power of two");
+
+/**
+ * @brief one timed zone, in time stamp counter ticks
+ */
+struct ProfileZone
+{
+    const char* szName;         ///< string literal, not copied
+    uint64_t    nBegin;
+    uint64_t    nEnd;
+};
+
+//-----------------------------------------------------------------------------------------------
+inline uint64_t ReadTimeStamp(void) noexcept
+{
+#if defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return static_cast<uint64_t>( std::chrono::steady_clock::now().time_since_epoch().count() );
+#endif
+};
+
+class CProfiler
+{
+    struct ThreadRing
+    {
+        std::atomic<uint32_t> nWrite;           ///< zones ever written, advanced by the owning thread
+        int                   iThread;          ///< trace tid
+        ProfileZone           rgZones[k_nProfileRing];
+    };
+
+    std::atomic<ThreadRing*>  m_rgRings[k_nMaxProfileThreads];
+    std::atomic<int>          m_nRings;
+    std::atomic<bool>         m_bRunning;
+    uint64_t                  m_nStartStamp;
+    std::chrono::steady_clock::time_point m_tmStart;
+
+public:
+    /// Default constructor
+    CProfiler() noexcept;
+    /// Default destructor
+    ~CProfiler() noexcept;
+
+/**
+ *  @brief starts keeping zones; those ended before are dropped
+ */
+    void Start       ( void ) noexcept;
+    void Stop        ( void ) noexcept;
+
+    bool IsRunning   ( void ) const noexcept
+    { return m_bRunning.load(std::memory_order_relaxed); };
+
+/**
+ *  @brief appends a zone to the calling thread's ring
+ */
+    void Record      ( const char* szName, uint64_t nBegin, uint64_t nEnd ) noexcept;
+
+/**
+ *  @retval size_t   zones held across every thread's ring
+ */
+    size_t get_ZoneCount ( void ) const noexcept;
+
+/**
+ *  @brief writes every zone held as a Chrome trace_event JSON file
+ *
+ *  @retval false  if the file cannot be created
+ */
+    bool WriteChromeTrace ( const char* szFileName ) const noexcept;
+    void WriteChromeTrace ( FILE* pFile ) const noexcept;
+
+private:
+    ThreadRing* AcquireRing ( void ) noexcept;
+
+    /// Copy constructor
+    CProfiler(const CProfiler&) = delete;
+    /// Assignment operator
+    CProfiler& operator=(const CProfiler&) = delete;
+};
+
+} // namespace util
+
+_declspec(selectany) util::CProfiler g_theProfiler;
+
+namespace util
+{
+
+/**
+ * @brief times its own lifetime, see PROFILE_SCOPE
+ */
+class CProfileScope
+{
+    const char* m_szName;
+    uint64_t    m_nBegin;
+
+public:
+    explicit CProfileScope(const char* szName) noexcept
+        : m_szName(szName),
+          m_nBegin(ReadTimeStamp())
+    { };
+
+    ~CProfileScope() noexcept
+    { g_theProfiler.Record(m_szName, m_nBegin, ReadTimeStamp()); };
+
+private:
+    /// Copy constructor
+    CProfileScope(const CProfileScope&) = delete;
+    /// Assignment operator
+    CProfileScope& operator=(const CProfileScope&) = delete;
+};
+
+} // namespace util
+} // namespace eng
+
+#define PROFILE_CONCAT_INNER(a, b)  a##b
+#define PROFILE_CONCAT(a, b)        PROFILE_CONCAT_INNER(a, b)
+
+#if defined(ENG_ENABLE_PROFILER)
+    #define PROFILE_SCOPE(szName)   eng::util::CProfileScope PROFILE_CONCAT(profileScope_, __LINE__)(szName)
+#else
+    #define PROFILE_SCOPE(szName)   ((void)0)
+#endif
+
+#endif
@@ -0,0 +1,220 @@
+/**
+ *  @file       Stats.cpp
+ *  @brief      CStats class implementation
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ */
+
+#define _CRT_SECURE_NO_WARNINGS
+#include "targetver.h"  // this needs to be the 1st header included
+
+#include <algorithm>
+#include <cstring>
+
+#include "Stats.h"
+
+namespace eng
+{
+namespace util
+{
+
+//-----------------------------------------------------------------------------------------------
+/// @retval double   value at fraction fRank of the sorted window, rgSorted must not be empty
+static double Percentile(const std::vector<float>& rgSorted, double dRank) noexcept
+{
+    const size_t nIndex = static_cast<size_t>(dRank * static_cast<double>(rgSorted.size() - 1) + 0.5);
+    return rgSorted[std::min(nIndex, rgSorted.size() - 1)];
+};
+
+//-----------------------------------------------------------------------------------------------
+CStats::CStats() noexcept
+    : m_rgEntries(),
+      m_nEntries(0),
+      m_mtxEntries()
+{
+};
+
+//-----------------------------------------------------------------------------------------------
+int CStats::Register(const char* szName, const char* szUnit, bool bSampled) noexcept
+{
+    if (szName == nullptr)
+        return -1;
+
+    std::lock_guard<std::mutex> lock(m_mtxEntries);
+
+    const int nEntries = m_nEntries.load(std::memory_order_relaxed);
+    for (int i = 0; i < nEntries; i++)
+    {
+        if (strcmp(m_rgEntries[i].szName, szName) == 0)
+            return i;
+    }
+
+    if (nEntries >= k_nMaxStats)
+        return -1;
+
+    Entry& entry = m_rgEntries[nEntries];
+    if (bSampled)
+    {
+        try
+        {
+            entry.rgWindow.reserve(k_nStatWindow);
+        }
+        catch (...)
+        {
+            return -1;
+        }
+    }
+
+    entry.szName   = szName;
+    entry.szUnit   = szUnit ? szUnit : "";
+    entry.bSampled = bSampled;
+    entry.nCount   = 0;
+    entry.dMin     = 0.0;
+    entry.dMax     = 0.0;
+    entry.dSum     = 0.0;
+
+    // publish only after the entry is filled in
+    m_nEntries.store(nEntries + 1, std::memory_order_release);
+    return nEntries;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CStats::Add(int iStat, uint64_t nValue /* = 1 */) noexcept
+{
+    if (iStat >= 0 && iStat < get_Count())
+        m_rgEntries[iStat].nCount.fetch_add(nValue, std::memory_order_relaxed);
+};
+
+//-----------------------------------------------------------------------------------------------
+void CStats::Record(int iStat, double dValue) noexcept
+{
+    if (iStat < 0 || iStat >= get_Count() || !m_rgEntries[iStat].bSampled)
+        return;
+
+    Entry& entry = m_rgEntries[iStat];
+
+    std::lock_guard<std::mutex> lock(entry.mtxValues);
+
+    const uint64_t nCount = entry.nCount.load(std::memory_order_relaxed);
+    if (nCount == 0)
+    {
+        entry.dMin = dValue;
+        entry.dMax = dValue;
+    }
+    else
+    {
+        entry.dMin = std::min(entry.dMin, dValue);
+        entry.dMax = std::max(entry.dMax, dValue);
+    }
+    entry.dSum += dValue;
+
+    // capacity was reserved at Register(), neither branch allocates
+    if (entry.rgWindow.size() < k_nStatWindow)
+        entry.rgWindow.push_back(static_cast<float>(dValue));
+    else
+        entry.rgWindow[nCount % k_nStatWindow] = static_cast<float>(dValue);
+
+    entry.nCount.store(nCount + 1, std::memory_order_relaxed);
+};
+
+//-----------------------------------------------------------------------------------------------
+bool CStats::get_Summary(int iStat, StatSummary& summary) const noexcept
+{
+    if (iStat < 0 || iStat >= get_Count())
+        return false;
+
+    const Entry& entry = m_rgEntries[iStat];
+
+    summary = StatSummary{ entry.szName, entry.szUnit, entry.bSampled, 0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+
+    if (!entry.bSampled)
+    {
+        summary.nCount = entry.nCount.load(std::memory_order_relaxed);
+        return true;
+    }
+
+    std::vector<float> rgSorted;
+    {
+        std::lock_guard<std::mutex> lock(entry.mtxValues);
+
+        summary.nCount = entry.nCount.load(std::memory_order_relaxed);
+        if (summary.nCount == 0)
+            return true;
+
+        summary.dMin  = entry.dMin;
+        summary.dMax  = entry.dMax;
+        summary.dMean = entry.dSum / static_cast<double>(summary.nCount);
+
+        try
+        {
+            rgSorted = entry.rgWindow;
+        }
+        catch (...)
+        {
+            // percentiles stay 0
+            return true;
+        }
+    }
+
+    std::sort(rgSorted.begin(), rgSorted.end());
+    summary.dP50 = Percentile(rgSorted, 0.50);
+    summary.dP95 = Percentile(rgSorted, 0.95);
+    summary.dP99 = Percentile(rgSorted, 0.99);
+    return true;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CStats::Reset(void) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mtxEntries);
+
+    const int nEntries = m_nEntries.load(std::memory_order_relaxed);
+    for (int i = 0; i < nEntries; i++)
+    {
+        std::lock_guard<std::mutex> lockValues(m_rgEntries[i].mtxValues);
+
+        m_rgEntries[i].nCount = 0;
+        m_rgEntries[i].dMin   = 0.0;
+        m_rgEntries[i].dMax   = 0.0;
+        m_rgEntries[i].dSum   = 0.0;
+        m_rgEntries[i].rgWindow.clear();
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+void CStats::WriteReport(FILE* pFile) const noexcept
+{
+    if (pFile == nullptr)
+        return;
+
+    const int nEntries = get_Count();
+    for (int i = 0; i < nEntries; i++)
+    {
+        StatSummary s;
+        if (!get_Summary(i, s))
+            continue;
+
+        if (s.bSampled)
+            fprintf(pFile, "%-28s %10llu samples  min %10.2f  mean %10.2f  p50 %10.2f  p95 %10.2f  p99 %10.2f  max %10.2f %s\n",
+                    s.szName, static_cast<unsigned long long>(s.nCount), s.dMin, s.dMean, s.dP50, s.dP95, s.dP99, s.dMax, s.szUnit);
+        else
+            fprintf(pFile, "%-28s %10llu %s\n", s.szName, static_cast<unsigned long long>(s.nCount), s.szUnit);
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+bool CStats::WriteReport(const char* szFileName) const noexcept
+{
+    FILE* pFile = (szFileName && *szFileName) ? fopen(szFileName, "wt") : nullptr;
+    if (pFile == nullptr)
+        return false;
+
+    WriteReport(pFile);
+    fclose(pFile);
+    return true;
+};
+
+} // namespace util
+} // namespace eng
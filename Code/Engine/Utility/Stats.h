@@ -0,0 +1,153 @@
+/**
+ *  @file       Stats.h
+ *  @brief      CStats class interface, the engine's runtime statistics registry
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ *  <b>Implementation:</b>
+ *
+ *   Subsystems register named statistics once at startup and then feed
+ *   them by id from any thread:
+ *
+ *    - counters (Add) are a single atomic sum;
+ *    - sampled statistics (Record) keep count, min, max and mean over the
+ *      whole run plus the most recent k_nStatWindow values, from which
+ *      the report derives the median and tail percentiles.  Recording
+ *      takes a short lock owned by that statistic, so threads feeding
+ *      different statistics never contend.
+ *
+ *   Entries live in a fixed table and are never moved, so an id stays
+ *   valid for the life of the registry.  WriteReport() prints one line per
+ *   statistic; the game writes it at Shutdown, to a file with -stats.
+ */
+#pragma once
+
+#if !defined(__STATS_H__)
+#define __STATS_H__
+
+#ifndef _ATOMIC_
+    #include <atomic>
+#endif
+
+#ifndef _CSTDINT_
+    #include <cstdint>
+#endif
+
+#ifndef _CSTDIO_
+    #include <cstdio>
+#endif
+
+#ifndef _MUTEX_
+    #include <mutex>
+#endif
+
+#ifndef _VECTOR_
+    #include <vector>
+#endif
+
+namespace eng
+{
+namespace util
+{
+
+constexpr int    k_nMaxStats   = 64;
+constexpr size_t k_nStatWindow = 1024;      ///< recent values kept per sampled statistic
+
+/**
+ * @brief a statistic as reported
+ */
+struct StatSummary
+{
+    const char* szName;
+    const char* szUnit;
+    bool        bSampled;
+    uint64_t    nCount;         ///< counter value, or number of values recorded
+    double      dMin;
+    double      dMax;
+    double      dMean;
+    double      dP50;           ///< percentiles of the recent window
+    double      dP95;
+    double      dP99;
+};
+
+class CStats
+{
+    struct Entry
+    {
+        const char*           szName;       ///< string literal, not copied
+        const char*           szUnit;
+        bool                  bSampled;
+        std::atomic<uint64_t> nCount;
+        double                dMin;
+        double                dMax;
+        double                dSum;
+        std::vector<float>    rgWindow;     ///< ring of recent values
+        mutable std::mutex    mtxValues;    ///< guards dMin .. rgWindow of a sampled entry
+    };
+
+    Entry               m_rgEntries[k_nMaxStats];
+    std::atomic<int>    m_nEntries;
+    mutable std::mutex  m_mtxEntries;       ///< serializes Register() and Reset()
+
+public:
+    /// Default constructor
+    CStats() noexcept;
+
+/**
+ *  @brief registers a statistic, or finds the one already registered under szName
+ *
+ *  @param [in] szName     static string, e.g. "audio.latency"
+ *  @param [in] szUnit     static string used in the report
+ *  @param [in] bSampled   Record() values rather than Add() counts
+ *
+ *  @retval int   containing the statistic id
+ *  @retval -1    if the table is full
+ */
+    int  Register    ( const char* szName, const char* szUnit, bool bSampled ) noexcept;
+
+/**
+ *  @brief adds to a counter; ignored for a bad id
+ */
+    void Add         ( int iStat, uint64_t nValue = 1 ) noexcept;
+/**
+ *  @brief records one value of a sampled statistic; ignored for a bad id
+ */
+    void Record      ( int iStat, double dValue ) noexcept;
+
+    int  get_Count   ( void ) const noexcept
+    { return m_nEntries.load(std::memory_order_acquire); };
+
+/**
+ *  @retval false  for a bad id
+ */
+    bool get_Summary ( int iStat, StatSummary& summary ) const noexcept;
+
+/**
+ *  @brief clears every value, registrations are kept
+ */
+    void Reset       ( void ) noexcept;
+
+/**
+ *  @brief prints one line per statistic
+ */
+    void WriteReport ( FILE* pFile ) const noexcept;
+/**
+ *  @retval false  if the file cannot be created
+ */
+    bool WriteReport ( const char* szFileName ) const noexcept;
+
+private:
+    /// Copy constructor
+    CStats(const CStats&) = delete;
+    /// Assignment operator
+    CStats& operator=(const CStats&) = delete;
+};
+
+} // namespace util
+
+_declspec(selectany) util::CStats g_theStats;
+
+} // namespace eng
+
+#endif
@@ -0,0 +1,71 @@
+/**
+ *  @file       ActionList.h
+ *  @brief      List of player actions and their default bindings
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ */
+
+#pragma once
+
+#if !defined(__ACTION_LIST_H__)
+#define __ACTION_LIST_H__
+
+#ifndef __KEYBOARD_STATE_H__
+    #include "KeyboardState.h"
+#endif
+
+#ifndef _XINPUT_H_
+    #include <Xinput.h>
+#endif
+
+enum ACTION_T
+{
+    ACT_THRUST,
+    ACT_TURN_LEFT,
+    ACT_TURN_RIGHT,
+    ACT_FIRE,
+    ACT_RESPAWN,
+    ACT_SPAWN_ASTEROID,
+    ACT_DESTROY_ASTEROID,
+    ACT_CAPTURE_BURST,
+    ACT_SHOW_AXES,
+    ACT_BENCH_POLYGONS,     ///< -bench only
+    ACT_BENCH_RESAMPLER,    ///< -bench only
+
+    ACT_COUNT
+};
+
+/**
+ * @brief one key and / or controller button that drives an action
+ *
+ * An action may appear on several rows; it is active while any of its keys
+ * or buttons is down.
+ */
+struct ActionBinding
+{
+    ACTION_T eAction;
+    Keys     eKey;          ///< Keys::None for a button only binding
+    WORD     wButtons;      ///< XINPUT_GAMEPAD_* flags, 0 for a key only binding
+};
+
+const constexpr ActionBinding k_rgActionBindings[] =
+{
+    { ACT_THRUST,           Keys::W,        XINPUT_GAMEPAD_DPAD_UP    },
+    { ACT_THRUST,           Keys::Up,       0                         },
+    { ACT_TURN_LEFT,        Keys::A,        XINPUT_GAMEPAD_DPAD_LEFT  },
+    { ACT_TURN_LEFT,        Keys::Left,     0                         },
+    { ACT_TURN_RIGHT,       Keys::D,        XINPUT_GAMEPAD_DPAD_RIGHT },
+    { ACT_TURN_RIGHT,       Keys::Right,    0                         },
+    { ACT_FIRE,             Keys::Space,    XINPUT_GAMEPAD_A          },
+    { ACT_RESPAWN,          Keys::P,        XINPUT_GAMEPAD_START      },
+    { ACT_SPAWN_ASTEROID,   Keys::O,        0                         },
+    { ACT_DESTROY_ASTEROID, Keys::L,        0                         },
+    { ACT_CAPTURE_BURST,    Keys::F12,      0                         },
+    { ACT_SHOW_AXES,        Keys::T,        0                         },
+    { ACT_BENCH_POLYGONS,   Keys::F11,      0                         },
+    { ACT_BENCH_RESAMPLER,  Keys::F10,      0                         }
+};
+
+#endif
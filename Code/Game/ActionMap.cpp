@@ -0,0 +1,87 @@
+/**
+ *  @file       ActionMap.cpp
+ *  @brief      CActionMap class implementation
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ */
+
+#define WIN32_LEAN_AND_MEAN
+#include "targetver.h"  // this needs to be the 1st header included
+
+#include <Windows.h>
+#include <cstring>
+
+#include "InputSampler.h"
+#include "ActionMap.h"
+
+//-----------------------------------------------------------------------------------------------
+void CActionMap::Compile( const ActionBinding* rgBindings, size_t nBindings ) noexcept
+{
+    memset(m_rgKeyMasks, 0, sizeof(m_rgKeyMasks));
+    memset(m_rgButtonMasks, 0, sizeof(m_rgButtonMasks));
+    memset(m_rgKeyCounts, 0, sizeof(m_rgKeyCounts));
+
+    for (size_t i = 0; i < nBindings; i++)
+    {
+        const ActionBinding& binding = rgBindings[i];
+        if (binding.eAction < 0 || binding.eAction >= ACT_COUNT)
+            continue;
+
+        const int iAction = binding.eAction;
+        m_rgButtonMasks[iAction] |= binding.wButtons;
+
+        const int iKey = static_cast<int>(binding.eKey);
+        if (binding.eKey == Keys::None || iKey > static_cast<int>(Keys::OemClear))
+            continue;
+
+        m_rgKeyMasks[iAction][iKey >> 5] |= 1u << (iKey & 0x1f);
+
+        if (m_rgKeyCounts[iAction] < k_nMaxActionKeys)
+            m_rgKeys[iAction][m_rgKeyCounts[iAction]++] = binding.eKey;
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+void CActionMap::Resolve( const KeyboardState& stKeyboard, WORD wButtons,
+                          const CInputSampler* pSampler, ActionState& state ) const noexcept
+{
+    // KeyboardState is byte aligned, read it as words through a copy
+    uint32_t rgWords[k_nKeyWords];
+    memcpy(rgWords, &stKeyboard, sizeof(rgWords));
+
+    const uint32_t nLastHeld = state.nHeld;
+    uint32_t       nHeld     = 0;
+
+    for (int iAction = 0; iAction < ACT_COUNT; iAction++)
+    {
+        const uint32_t* pMask = m_rgKeyMasks[iAction];
+
+        uint32_t nKeys = 0;
+        for (size_t j = 0; j < k_nKeyWords; j++)
+            nKeys |= rgWords[j] & pMask[j];
+
+        const bool bButton = (wButtons & m_rgButtonMasks[iAction]) != 0;
+        float      fAmount = (bButton || nKeys) ? 1.f : 0.f;
+
+        if (pSampler && !bButton)
+        {
+            // keys released before the tick ended still count for their part of it
+            fAmount = 0.f;
+            for (uint8_t k = 0; k < m_rgKeyCounts[iAction]; k++)
+            {
+                const float fHeld = pSampler->get_KeyHeldFraction(m_rgKeys[iAction][k]);
+                if (fHeld > fAmount)
+                    fAmount = fHeld;
+            }
+        }
+
+        state.rgAmount[iAction] = fAmount;
+        if (fAmount > 0.f)
+            nHeld |= 1u << iAction;
+    }
+
+    state.nHeld    = nHeld;
+    state.nPressed = nHeld & ~nLastHeld;
+};
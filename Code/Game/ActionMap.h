@@ -0,0 +1,94 @@
+/**
+ *  @file       ActionMap.h
+ *  @brief      CActionMap class interface
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ *  <b>Implementation:</b>
+ *
+ *   Gameplay and rendering ask about actions (ACT_THRUST, ACT_FIRE, ...)
+ *   instead of keys and buttons.  Compile() folds a binding table into,
+ *   per action, a 256-bit mask laid out like KeyboardState and a mask over
+ *   the XINPUT_GAMEPAD button word.  Resolve() then settles every action
+ *   once per tick: one AND / OR pass over the eight keyboard words and the
+ *   button word per action, producing an ActionState that is only read
+ *   for the rest of the tick.
+ *
+ *   With a CInputSampler, an action's amount is the fraction of the tick
+ *   its keys were held, so a tap between two frames still registers; a
+ *   bound button held counts as the whole tick.
+ */
+#pragma once
+
+#if !defined(__ACTION_MAP_H__)
+#define __ACTION_MAP_H__
+
+#ifndef _CSTDINT_
+    #include <cstdint>
+#endif
+
+#ifndef __ACTION_LIST_H__
+    #include "ActionList.h"
+#endif
+
+class CInputSampler;
+
+constexpr size_t k_nMaxActionKeys = 4;      ///< keys per action whose held fraction is tracked
+
+static_assert(ACT_COUNT <= 32, "ActionState keeps one bit per action");
+
+/**
+ * @brief every action, resolved for one tick
+ */
+struct ActionState
+{
+    uint32_t nHeld;                 ///< actions active during the tick
+    uint32_t nPressed;              ///< actions that became active this tick
+    float    rgAmount[ACT_COUNT];   ///< 0 .. 1, the part of the tick an action was active
+
+    constexpr bool  IsHeld      ( ACTION_T eAction ) const noexcept
+    { return (nHeld & (1u << eAction)) != 0; };
+
+    constexpr bool  WasPressed  ( ACTION_T eAction ) const noexcept
+    { return (nPressed & (1u << eAction)) != 0; };
+
+    constexpr float get_Amount  ( ACTION_T eAction ) const noexcept
+    { return rgAmount[eAction]; };
+};
+
+class CActionMap
+{
+    static constexpr size_t k_nKeyWords = sizeof(KeyboardState) / sizeof(uint32_t);
+
+    uint32_t m_rgKeyMasks[ACT_COUNT][k_nKeyWords];
+    WORD     m_rgButtonMasks[ACT_COUNT];
+    Keys     m_rgKeys[ACT_COUNT][k_nMaxActionKeys];
+    uint8_t  m_rgKeyCounts[ACT_COUNT];
+
+public:
+    /// Default constructor, no action is bound
+    constexpr CActionMap() noexcept
+        : m_rgKeyMasks{},
+          m_rgButtonMasks{},
+          m_rgKeys{},
+          m_rgKeyCounts{}
+    { };
+
+/**
+ *  @brief replaces the bindings with rgBindings
+ */
+    void Compile ( const ActionBinding* rgBindings, size_t nBindings ) noexcept;
+
+/**
+ *  @brief resolves every action for this tick
+ *
+ *  @param [in]     wButtons   button word of the controller that plays
+ *  @param [in]     pSampler   may be nullptr, amounts are then 0 or 1
+ *  @param [in,out] state      last tick's state on entry
+ */
+    void Resolve ( const KeyboardState& stKeyboard, WORD wButtons,
+                   const CInputSampler* pSampler, ActionState& state ) const noexcept;
+};
+
+#endif
@@ -12,13 +12,32 @@
 #include "CommonDef.h"
 
 #include <Windows.h>
+#include <string.h>
+#include <stdlib.h>
+#include <filesystem>
 
 #include "Engine/Utility/DebugUtils.h"
 #include "Engine/Utility/TimeUtils.h"
 #include "Engine/Renderer/Renderer.h"
+#include "Engine/Renderer/FrameCapture.h"
+#include "Engine/Renderer/VideoRecorder.h"
+#include "Engine/Renderer/PolygonCache.h"
+#include "Engine/Renderer/CoreProfileBackend.h"
+#include "Engine/Renderer/TextureCache.h"
+#include "Engine/Renderer/TextureManager.h"
+#include "Engine/Utility/AssetPack.h"
+#include "Engine/Utility/Stats.h"
+#include "Engine/Utility/Profiler.h"
+#include "Engine/Core/AssetReloader.h"
+#include "Engine/Audio/AudioMixer.h"
 
 #include "Game.h"
 #include "SoundManager.h"
+#include "SoundEvents.h"
+#include "InputRecorder.h"
+#include "ControllerMonitor.h"
+#include "InputSampler.h"
+#include "InputDevice.h"
 #include "Application.h"
 
 
@@ -45,8 +64,49 @@ CApplication::~CApplication()
     if (m_pGame)
         delete m_pGame;
 
+    if (m_pSoundEvents)
+        delete m_pSoundEvents;
+
     if (m_pSoundManager)
         delete m_pSoundManager;
+
+    if (m_pInputRecorder)
+        delete m_pInputRecorder;
+
+    // samples the pads the monitor reports
+    if (m_pInputSampler)
+        delete m_pInputSampler;
+
+    if (m_pInputDevice)
+        delete m_pInputDevice;
+
+    if (m_pControllerMonitor)
+        delete m_pControllerMonitor;
+
+    if (m_pFrameCapture)
+        delete m_pFrameCapture;
+
+    if (m_pVideoRecorder)
+        delete m_pVideoRecorder;
+
+    if (m_pAssetPack)
+        delete m_pAssetPack;
+
+    if (m_pTextureCache)
+        delete m_pTextureCache;
+
+    if (m_pAssetReloader)
+        delete m_pAssetReloader;
+
+    if (m_prgReloaded)
+        delete m_prgReloaded;
+
+    // after the sound manager, which plays through the mixer
+    if (m_pAudioMixer)
+        delete m_pAudioMixer;
+
+    if (m_pAudioSink)
+        delete m_pAudioSink;
 };
 
 //-----------------------------------------------------------------------------------------------
@@ -131,6 +191,30 @@ void CApplication::CreateOpenGLWindow( void ) noexcept
 */
     wglMakeCurrent( m_hdcDisplay, g_hglrc );
 
+    if (m_Options.bCoreProfile)
+    {
+        // the legacy context stays alive until the core profile backend is
+        // known to work, so any failure falls back to fixed function
+        HGLRC hglrcCore = eng::rdr::CreateCoreProfileContext( m_hdcDisplay, g_hglrc );
+        if (hglrcCore && eng::g_theRdr.Initialize( eng::rdr::RB_CORE_PROFILE_33 ))
+        {
+            wglDeleteContext( g_hglrc );
+            g_hglrc = hglrcCore;
+        }
+        else if (hglrcCore)
+        {
+            wglMakeCurrent  ( m_hdcDisplay, g_hglrc );
+            wglDeleteContext( hglrcCore );
+        }
+    }
+
+    if (!eng::g_theRdr.IsInitialized())
+        eng::g_theRdr.Initialize( eng::rdr::RB_FIXED_FUNCTION );
+
+#ifdef _DEBUG
+    eng::util::DebugTrace(_T("Renderer: %hs \n"), eng::g_theRdr.get_BackendName());
+#endif
+
 /*
     The glOrtho function multiplies the current matrix by an orthographic matrix.
 */
@@ -138,33 +222,655 @@ void CApplication::CreateOpenGLWindow( void ) noexcept
     eng::g_theRdr.SetOrtho( eng::math::CVector2f(VIEW_LEFT, VIEW_BOTTOM),
                             eng::math::CVector2f(VIEW_RIGHT, VIEW_TOP) );
 
-    eng::g_theRdr.Initialize();
+    // the WM_SIZE sent while the window was created found no backend yet
+    OnSize();
 };
 
 //-----------------------------------------------------------------------------------------------
-void CApplication::Initialize( HINSTANCE hInstance )
+void CApplication::Initialize( HINSTANCE hInstance, LPCSTR szCmdLine /* = nullptr */ )
 {
     m_hInstance = hInstance;
 
+    m_Options.nInputSampleHz = k_nInputSampleHz;
+    ParseCommandLine( szCmdLine );
+
+    // seeds rand(), so before anything is spawned
+    InitInputRecorder( );
+
+    if (m_Options.szTracePath[0])
+    {
+#if defined(ENG_ENABLE_PROFILER)
+        eng::g_theProfiler.Start();
+#else
+        eng::util::DebugTrace(_T("Profiler: built without ENG_ENABLE_PROFILER (use the Profile configuration), no trace will be written \n"));
+#endif
+    }
+
     eng::util::GetModulePath(g_szModulePath, _countof(g_szModulePath) - 1);
 
     CreateOpenGLWindow( );
 
+    InitAssetPack( );
+    InitTextureCache( );
+
     m_Keyboard.SetHandler(CApplication::KeyboardHandler);
+    m_ActionMap.Compile(k_rgActionBindings, _countof(k_rgActionBindings));
+
+    InitInputDevice( );
+    InitControllerMonitor( );
+    InitInputSampler( );
 
-    m_pSoundManager = new CSoundManager();
+    m_iStatAudioFailures = eng::g_theStats.Register("audio.update_failures", "frames", false);
+    m_iStatAudioResets   = eng::g_theStats.Register("audio.resets",          "",       false);
+
+    InitAudioMixer( );
+
+    m_pSoundManager = new CSoundManager(m_pAudioMixer);
     if (m_pSoundManager)
-        m_pSoundManager->InitSounds();
+    {
+        m_pSoundManager->InitSounds(m_pAssetPack);
+        m_pSoundManager->SetListenerField(VIEW_LEFT, VIEW_BOTTOM, VIEW_RIGHT, VIEW_TOP);
+    }
+
+    m_pSoundEvents = new CSoundEvents(m_pSoundManager);
 
-    m_pGame = new CGame(m_pSoundManager);
+    m_pGame = new CGame(m_pSoundEvents);
     if (m_pGame)
         m_pGame->InitActors();
 
+    InitFrameCapture();
+    InitVideoRecorder();
+    InitAssetReloader();
+};
+
+//-----------------------------------------------------------------------------------------------
+// engine clock time the message being dispatched was generated at; the
+// message time is a millisecond tick count, so its age is taken from now
+static double GetMessageTimeInSeconds( void ) noexcept
+{
+    const double dNow = eng::util::GetCurrentTimeInSeconds();
+    const LONG   nAge = static_cast<LONG>( ::GetTickCount() - static_cast<DWORD>( ::GetMessageTime() ) );
+
+    return (nAge > 0 && nAge < 1000) ? dNow - nAge * 0.001 : dNow;
+};
+
+//-----------------------------------------------------------------------------------------------
+// copies the next whitespace delimited (optionally quoted) token, returns
+// false at the end of the command line
+static bool NextCommandLineToken( LPCSTR& pszCur, char* szToken, size_t cchToken ) noexcept
+{
+    while (*pszCur == ' ' || *pszCur == '\t')
+        pszCur++;
+
+    if (*pszCur == '\0')
+        return false;
+
+    const bool bQuoted = (*pszCur == '"');
+    if (bQuoted)
+        pszCur++;
+
+    size_t nLen = 0;
+    while (*pszCur && (bQuoted ? (*pszCur != '"') : (*pszCur != ' ' && *pszCur != '\t')))
+    {
+        if (nLen + 1 < cchToken)
+            szToken[nLen++] = *pszCur;
+        pszCur++;
+    }
+    szToken[nLen] = '\0';
+
+    if (bQuoted && *pszCur == '"')
+        pszCur++;
+
+    return true;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CApplication::ParseCommandLine( LPCSTR szCmdLine ) noexcept
+{
+    if (szCmdLine == nullptr)
+        return;
+
+    char szToken[MAX_PATH] = { 0 };
+    while (NextCommandLineToken(szCmdLine, szToken, _countof(szToken)))
+    {
+        if (_stricmp(szToken, "-video") == 0)
+        {
+            NextCommandLineToken(szCmdLine, m_Options.szVideoPath, _countof(m_Options.szVideoPath));
+        }
+        else if (_stricmp(szToken, "-gl33") == 0)
+        {
+            m_Options.bCoreProfile = true;
+        }
+        else if (_stricmp(szToken, "-hotreload") == 0)
+        {
+            m_Options.bHotReload = true;
+        }
+        else if (_stricmp(szToken, "-audio") == 0)
+        {
+            NextCommandLineToken(szCmdLine, m_Options.szAudioSink, _countof(m_Options.szAudioSink));
+        }
+        else if (_stricmp(szToken, "-music") == 0)
+        {
+            NextCommandLineToken(szCmdLine, m_Options.szMusicPath, _countof(m_Options.szMusicPath));
+        }
+        else if (_stricmp(szToken, "-stats") == 0)
+        {
+            NextCommandLineToken(szCmdLine, m_Options.szStatsPath, _countof(m_Options.szStatsPath));
+        }
+        else if (_stricmp(szToken, "-record") == 0)
+        {
+            NextCommandLineToken(szCmdLine, m_Options.szRecordPath, _countof(m_Options.szRecordPath));
+        }
+        else if (_stricmp(szToken, "-replay") == 0)
+        {
+            NextCommandLineToken(szCmdLine, m_Options.szReplayPath, _countof(m_Options.szReplayPath));
+        }
+        else if (_stricmp(szToken, "-headless") == 0)
+        {
+            m_Options.bHeadless = true;
+        }
+        else if (_stricmp(szToken, "-inputhz") == 0)
+        {
+            if (NextCommandLineToken(szCmdLine, szToken, _countof(szToken)))
+                m_Options.nInputSampleHz = static_cast<unsigned int>( atoi(szToken) );
+        }
+        else if (_stricmp(szToken, "-input") == 0)
+        {
+            NextCommandLineToken(szCmdLine, m_Options.szInputDevice, _countof(m_Options.szInputDevice));
+        }
+        else if (_stricmp(szToken, "-trace") == 0)
+        {
+            NextCommandLineToken(szCmdLine, m_Options.szTracePath, _countof(m_Options.szTracePath));
+        }
+        else if (_stricmp(szToken, "-bench") == 0)
+        {
+            m_Options.bBenchmarks = true;
+        }
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+void CApplication::InitAudioMixer( void )
+{
+    if (m_Options.szAudioSink[0] == '\0')
+        return;
+
+    m_pAudioSink = eng::audio::CreateAudioSink( m_Options.szAudioSink );
+    if (m_pAudioSink == nullptr)
+        return;
+
+    try
+    {
+        m_pAudioMixer = new eng::audio::CAudioMixer();
+        m_pAudioMixer->AttachStats( &eng::g_theStats );
+        if (!m_pAudioMixer->StartOutput( m_pAudioSink ))
+        {
+            eng::util::DebugTrace(_T("Audio: cannot open the '%hs' sink, using XAudio2 \n"), m_pAudioSink->get_Name());
+            delete m_pAudioMixer;
+            m_pAudioMixer = nullptr;
+        }
+    }
+    catch (...)
+    {
+        // fall back to the XAudio2 path
+        delete m_pAudioMixer;
+        m_pAudioMixer = nullptr;
+    }
+
+    if (m_pAudioMixer == nullptr)
+    {
+        delete m_pAudioSink;
+        m_pAudioSink = nullptr;
+        return;
+    }
+
+    if (m_Options.szMusicPath[0])
+    {
+        // the mixer holds the only reference; the stream goes with its voice
+        try
+        {
+            auto pMusic = std::make_shared<eng::audio::CWaveStream>();
+            if (pMusic->Open( m_Options.szMusicPath, m_pAudioMixer->get_SampleRate(), true ))
+                m_pAudioMixer->PlayStream( pMusic, k_fMusicVolume );
+            else
+                eng::util::DebugTrace(_T("Audio: cannot stream '%hs' \n"), m_Options.szMusicPath);
+        }
+        catch (...)
+        {
+            // music is optional
+        }
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+void CApplication::InitInputRecorder( void )
+{
+    if (m_Options.szReplayPath[0] == '\0' && m_Options.szRecordPath[0] == '\0')
+        return;     // rand() keeps the CRT's default seed
+
+    try
+    {
+        m_pInputRecorder = new CInputRecorder();
+    }
+    catch (...)
+    {
+        return;
+    }
+
+    // a replay wins over a recording asked for in the same run
+    if (m_Options.szReplayPath[0])
+    {
+        if (m_pInputRecorder->StartReplay( m_Options.szReplayPath ))
+        {
+            srand( m_pInputRecorder->get_Seed() );
+            m_iStatReplayFrame = eng::g_theStats.Register("replay.frame", "ms", true);
+            return;
+        }
+        eng::util::DebugTrace(_T("Input: cannot replay '%hs' \n"), m_Options.szReplayPath);
+    }
+    else
+    {
+        const uint32_t nSeed = static_cast<uint32_t>( ::GetTickCount() );
+        if (m_pInputRecorder->StartRecording( m_Options.szRecordPath, nSeed, MAX_CONTROLLERS ))
+        {
+            srand( nSeed );
+            return;
+        }
+        eng::util::DebugTrace(_T("Input: cannot record to '%hs' \n"), m_Options.szRecordPath);
+    }
+
+    delete m_pInputRecorder;
+    m_pInputRecorder = nullptr;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CApplication::InitInputDevice( void )
+{
+    if (m_Options.szInputDevice[0] == '\0' || (m_pInputRecorder && m_pInputRecorder->IsReplaying()))
+        return;
+
+    m_pInputDevice = CreateInputDevice( m_Options.szInputDevice );
+    if (m_pInputDevice && m_pInputDevice->Open())
+        return;
+
+    // the keyboard and XInput stay in charge
+    eng::util::DebugTrace(_T("Input: cannot open the '%hs' input device \n"), m_Options.szInputDevice);
+    delete m_pInputDevice;
+    m_pInputDevice = nullptr;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CApplication::InitControllerMonitor( void )
+{
+    // a replay installs recorded controller states, an input device polls its own
+    if ((m_pInputRecorder && m_pInputRecorder->IsReplaying()) || m_pInputDevice)
+        return;
+
+    try
+    {
+        m_pControllerMonitor = new CControllerMonitor();
+        m_pControllerMonitor->Start( MAX_CONTROLLERS, k_nControllerProbeMs );
+    }
+    catch (...)
+    {
+        // without it every slot is polled each frame
+        delete m_pControllerMonitor;
+        m_pControllerMonitor = nullptr;
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+void CApplication::InitInputSampler( void )
+{
+    // a recording holds one input state per tick, so it is sampled once per tick
+    if (m_pInputRecorder || m_pInputDevice || m_Options.nInputSampleHz == 0)
+        return;
+
+    try
+    {
+        m_pInputSampler = new CInputSampler();
+        m_pInputSampler->AttachStats( &eng::g_theStats );
+        m_pInputSampler->Start( m_pControllerMonitor, MAX_CONTROLLERS, m_Options.nInputSampleHz, g_bDeadZoneOn );
+    }
+    catch (...)
+    {
+        // controllers are then polled once per frame
+        delete m_pInputSampler;
+        m_pInputSampler = nullptr;
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+void CApplication::InitVideoRecorder( void )
+{
+    if (m_Options.szVideoPath[0] == '\0')
+        return;
+
+    // frames are only captured from Render(), which -headless skips; refuse
+    //  rather than leave an empty file behind
+    if (m_Options.bHeadless)
+    {
+        eng::util::DebugTrace(_T("Video: -video needs rendering and is ignored with -headless \n"));
+        return;
+    }
+
+    // live play is stamped at a fixed k_iVideoFrameRate whatever the real
+    //  frame times; a replay writes one frame per recorded tick, stamped at
+    //  the recording's mean tick rate so the video runs as long as the session
+    int iFrameRate = k_iVideoFrameRate;
+    const bool bReplay = m_pInputRecorder && m_pInputRecorder->IsReplaying();
+    if (bReplay)
+    {
+        uint32_t nTicks   = 0;
+        double   dSeconds = 0.0;
+        if (CInputRecorder::MeasureReplay( m_Options.szReplayPath, nTicks, dSeconds ) && dSeconds > 0.0)
+        {
+            const int iMeanRate = static_cast<int>( nTicks / dSeconds + 0.5 );
+            iFrameRate = (iMeanRate > 0) ? iMeanRate : 1;
+        }
+    }
+
+    try
+    {
+        m_pVideoRecorder = new eng::rdr::CVideoRecorder( k_nVideoQueueDepth );
+
+        // a replay is rendered offline; wait for the encoder rather than drop frames
+        m_pVideoRecorder->set_BlockWhenFull( bReplay );
+
+        if (!m_pVideoRecorder->Start( m_Options.szVideoPath, iFrameRate ))
+        {
+            delete m_pVideoRecorder;
+            m_pVideoRecorder = nullptr;
+        }
+    }
+    catch (...)
+    {
+        // recording is optional; play on without it
+        delete m_pVideoRecorder;
+        m_pVideoRecorder = nullptr;
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+void CApplication::InitAssetPack( void )
+{
+    try
+    {
+        // textures are named relative to the module path, packed or not
+        eng::rdr::GetTextureManager().set_RootDirectory( std::filesystem::path(g_szModulePath).string().c_str() );
+
+        std::filesystem::path pathPack = std::filesystem::path(g_szModulePath) / k_szAssetPackFile;
+
+        m_pAssetPack = new eng::CAssetPack();
+        if (m_pAssetPack->Open( pathPack.string().c_str() ))
+        {
+            eng::rdr::GetTextureManager().set_AssetPack( m_pAssetPack );
+        }
+        else
+        {
+            // no pack deployed; everything loads from loose files
+            delete m_pAssetPack;
+            m_pAssetPack = nullptr;
+        }
+    }
+    catch (...)
+    {
+        delete m_pAssetPack;
+        m_pAssetPack = nullptr;
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+void CApplication::InitTextureCache( void )
+{
+    try
+    {
+        std::filesystem::path pathCache = std::filesystem::path(g_szModulePath) / "Cache" / "Textures";
+
+        m_pTextureCache = new eng::rdr::CTextureCache( pathCache.string().c_str() );
+        eng::rdr::GetTextureManager().set_Cache( m_pTextureCache );
+    }
+    catch (...)
+    {
+        // the cache only saves decode time; run without it
+        delete m_pTextureCache;
+        m_pTextureCache = nullptr;
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+void CApplication::InitAssetReloader( void )
+{
+    if (!m_Options.bHotReload)
+        return;
+
+    try
+    {
+        m_prgReloaded    = new std::vector<eng::ReloadedAssetPtr>();
+        m_pAssetReloader = new eng::CAssetReloader();
+
+        // the game writes below these itself; F12 captures must not be decoded as edits
+        m_pAssetReloader->Exclude( "Captures" );
+        m_pAssetReloader->Exclude( "Cache" );
+
+        if (!m_pAssetReloader->Start( std::filesystem::path(g_szModulePath).string().c_str() ))
+        {
+            delete m_pAssetReloader;
+            m_pAssetReloader = nullptr;
+        }
+    }
+    catch (...)
+    {
+        // hot reload is a development aid; run without it
+        delete m_pAssetReloader;
+        m_pAssetReloader = nullptr;
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+// swaps assets decoded by the reloader's worker into place; runs between
+// frames so nothing is replaced while it is being drawn or played
+void CApplication::ApplyAssetReloads( void )
+{
+    if (m_pAssetReloader == nullptr || m_prgReloaded == nullptr || m_pAssetReloader->TakeReady(*m_prgReloaded) == 0)
+        return;
+
+    for (const eng::ReloadedAssetPtr& pAsset : *m_prgReloaded)
+    {
+        bool bApplied = false;
+
+        if (pAsset->eFormat == eng::AF_IMAGE)
+            bApplied = eng::rdr::GetTextureManager().Reload( pAsset->nNameHash, pAsset->chain );
+        else if (pAsset->eFormat == eng::AF_WAVE && m_pSoundManager)
+            bApplied = m_pSoundManager->ReloadSound( pAsset->nNameHash, pAsset->get_View() );
+
+#ifdef _DEBUG
+        eng::util::DebugTrace(_T("Hot reload: %hs %hs \n"), pAsset->strName.c_str(), bApplied ? "applied" : "not in use");
+#else
+        (void) bApplied;
+#endif
+    }
+
+    m_prgReloaded->clear();
+};
+
+//-----------------------------------------------------------------------------------------------
+void CApplication::InitFrameCapture( void )
+{
+    try
+    {
+        std::filesystem::path pathCaptures = std::filesystem::path(g_szModulePath) / "Captures";
+        std::filesystem::create_directories(pathCaptures);
+
+        m_pFrameCapture = new eng::rdr::CFrameCapture( (pathCaptures / "frame").string().c_str(),
+                                                       k_nCapturePoolSize );
+        m_pFrameCapture->set_Interval( k_nCaptureInterval );
+        m_pFrameCapture->Start();
+    }
+    catch (...)
+    {
+        // capture is a diagnostic aid; run without it
+        delete m_pFrameCapture;
+        m_pFrameCapture = nullptr;
+    }
 };
 
 //-----------------------------------------------------------------------------------------------
 void CApplication::Shutdown( void ) noexcept
 {
+    if (m_pAssetReloader)
+        m_pAssetReloader->Stop();
+
+    // flush any frames still waiting to be encoded
+    if (m_pFrameCapture)
+        m_pFrameCapture->Stop();
+
+    if (m_pVideoRecorder)
+    {
+        m_pVideoRecorder->Stop();
+#ifdef _DEBUG
+        eng::util::DebugTrace(_T("Video: %zu frames written, %zu dropped, %zu failed \n"),
+                              m_pVideoRecorder->get_Written(), m_pVideoRecorder->get_Dropped(),
+                              m_pVideoRecorder->get_Failed());
+#endif
+    }
+
+    if (m_pSoundEvents)
+    {
+        const SoundEventStats& stats = m_pSoundEvents->get_Stats();
+        eng::util::DebugTrace(_T("Sound events: %u triggers, %u merged, %u rate limited, %u voices, %u loop edges \n"),
+                              stats.nTriggers, stats.nMerged, stats.nRateLimited, stats.nStarted, stats.nEdges);
+        m_pSoundEvents->Reset();
+    }
+
+    if (m_pAudioMixer)
+    {
+        m_pAudioMixer->StopOutput();
+
+        const eng::audio::MixerStats stats = m_pAudioMixer->get_Stats();
+        eng::util::DebugTrace(_T("Audio mixer: %llu blocks, %.3f us per voice block, %llu underruns, %llu stream starves, %.1f sec output \n"),
+                              stats.nBlocks, stats.get_MicrosecondsPerVoiceBlock(), stats.nUnderruns, stats.nStreamStarves,
+                              static_cast<double>(stats.nFramesOut) / m_pAudioMixer->get_SampleRate());
+    }
+
+    if (m_pInputSampler)
+    {
+        m_pInputSampler->Stop();
+        eng::util::DebugTrace(_T("Input: %u pad polls, %u changes dropped \n"),
+                              m_pInputSampler->get_Polls(), m_pInputSampler->get_Dropped());
+    }
+
+    if (m_pControllerMonitor)
+    {
+        m_pControllerMonitor->Stop();
+        eng::util::DebugTrace(_T("Controllers: %u connected, %u disconnected \n"),
+                              m_pControllerMonitor->get_Connects(), m_pControllerMonitor->get_Disconnects());
+    }
+
+    if (m_pInputDevice)
+    {
+        eng::util::DebugTrace(_T("Input: %.1f sec from the '%hs' input device \n"), m_dInputTime, m_pInputDevice->get_Name());
+        m_pInputDevice->Close();
+    }
+
+    if (m_pInputRecorder)
+    {
+        eng::util::DebugTrace(_T("Input: %u ticks %hs \n"), m_pInputRecorder->get_Ticks(),
+                              m_Options.szReplayPath[0] ? "replayed" : "recorded");
+        m_pInputRecorder->Close();
+    }
+
+    // textures load on first use, so the totals are only meaningful now
+    if (m_pTextureCache)
+    {
+        const eng::rdr::TextureCacheStats& stats = m_pTextureCache->get_Stats();
+        eng::util::DebugTrace(_T("Texture cache: %zu hits, %zu misses (%.1f%% hit rate), %.3f sec decode saved, %.3f sec decoded \n"),
+                              stats.nHits, stats.nMisses, stats.get_HitRate() * 100.0,
+                              stats.dSecondsSaved, stats.dDecodeSeconds);
+    }
+
+    ReportStats();
+
+    // a no-op when WM_DESTROY has already released them
+    ReleaseRenderResources();
+};
+
+//-----------------------------------------------------------------------------------------------
+// deletes every GL object the game and engine hold; must run while the
+// context is still current, so WM_DESTROY calls it before deleting the
+// context, and Shutdown() for the paths that quit without closing the window
+void CApplication::ReleaseRenderResources( void ) noexcept
+{
+    if (m_pGame)
+        m_pGame->ReleaseRenderResources();
+
+    eng::rdr::GetTextureManager().Clear();
+    eng::rdr::GetTextureManager().set_AssetPack( nullptr );
+    eng::rdr::GetTextureManager().set_Cache( nullptr );
+    eng::g_theRdr.Shutdown();
+};
+
+//-----------------------------------------------------------------------------------------------
+void CApplication::UpdateAudio( float fDeltaTime ) noexcept
+{
+    if (m_pSoundManager == nullptr)
+        return;
+
+    if (m_pSoundManager->Update())
+    {
+        m_fAudioRetryTimer = 0.f;
+        return;
+    }
+
+    eng::g_theStats.Add(m_iStatAudioFailures);
+
+    // no device, a lost device or a dead sink; resetting enumerates devices,
+    // so it is retried on an interval rather than every frame
+    m_fAudioRetryTimer -= fDeltaTime;
+    if (m_fAudioRetryTimer > 0.f)
+        return;
+
+    m_fAudioRetryTimer = k_fAudioRetrySeconds;
+
+    if (m_pSoundManager->Reset())
+    {
+        eng::g_theStats.Add(m_iStatAudioResets);
+        eng::util::DebugTrace(_T("Audio: output reset \n"));
+
+        // voices were stopped; held loops start again on their next trigger
+        if (m_pSoundEvents)
+            m_pSoundEvents->Reset();
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+void CApplication::ReportStats( void ) noexcept
+{
+    const int nStats = eng::g_theStats.get_Count();
+    for (int i = 0; i < nStats; i++)
+    {
+        eng::util::StatSummary s;
+        if (!eng::g_theStats.get_Summary(i, s))
+            continue;
+
+        if (s.bSampled)
+            eng::util::DebugTrace(_T("Stats: %hs %llu samples, mean %.2f, p95 %.2f, p99 %.2f, max %.2f %hs \n"),
+                                  s.szName, s.nCount, s.dMean, s.dP95, s.dP99, s.dMax, s.szUnit);
+        else
+            eng::util::DebugTrace(_T("Stats: %hs %llu %hs \n"), s.szName, s.nCount, s.szUnit);
+    }
+
+    if (m_Options.szStatsPath[0] && !eng::g_theStats.WriteReport(m_Options.szStatsPath))
+        eng::util::DebugTrace(_T("Stats: cannot write '%hs' \n"), m_Options.szStatsPath);
+
+    if (eng::g_theProfiler.IsRunning())
+    {
+        eng::g_theProfiler.Stop();
+        if (eng::g_theProfiler.WriteChromeTrace(m_Options.szTracePath))
+            eng::util::DebugTrace(_T("Profiler: %zu zones written to '%hs' \n"), eng::g_theProfiler.get_ZoneCount(), m_Options.szTracePath);
+        else
+            eng::util::DebugTrace(_T("Profiler: cannot write '%hs' \n"), m_Options.szTracePath);
+    }
 };
 
 //-----------------------------------------------------------------------------------------------
@@ -175,64 +881,185 @@ void CApplication::RunFrame( void )
     float deltaSeconds                 = static_cast< float >( timeThisFrameBegan - s_timeLastFrameBegan );
     s_timeLastFrameBegan               = timeThisFrameBegan;
 
+    PROFILE_SCOPE("Frame");
+
+    ApplyAssetReloads();
+
 // Note: FPS = 1 / deltaSeconds
     Update( deltaSeconds );
 
-    Render();
+    if (!m_Options.bHeadless)
+        Render();
+
+    // wall clock cost of a replayed tick, the benchmark's figure of merit
+    if (m_iStatReplayFrame >= 0)
+        eng::g_theStats.Record( m_iStatReplayFrame, (eng::util::GetCurrentTimeInSeconds() - timeThisFrameBegan) * 1000.0 );
 };
 
 //-----------------------------------------------------------------------------------------------
 void CApplication::Update ( float fDeltaTime )
 {
-    m_Keyboard.UpdateStates();
+    PROFILE_SCOPE("Update");
+
+    if (!UpdateInput( fDeltaTime ))
+        return;
 
     if (m_pGame)
     {
-        UpdateControllerStates();
-
-        if (m_Keyboard.IsKeyPressed(Keys::O))
+        if (m_Actions.WasPressed(ACT_SPAWN_ASTEROID))
         {
             m_pGame->SpawnLargeAsteroid();
         }
-        if (m_Keyboard.IsKeyPressed(Keys::L))
+        if (m_Actions.WasPressed(ACT_DESTROY_ASTEROID))
         {
             m_pGame->DestroyRandomAsteroid();
         }
-        if (m_Keyboard.IsKeyPressed(Keys::Space) || s_rgControllers[0].get_A() )
+        if (m_Actions.WasPressed(ACT_FIRE))
         {
+            // the game triggers the launch sound at the projectile's spawn point
             if (m_pGame->IsShipActive ())
             {
                 m_pGame->FireProjectile ();
-                PlaySound (SND_MISSILE_FIRE);
             }
         }
-        if (m_Keyboard.IsKeyPressed(Keys::P) || s_rgControllers[0].get_Start() )
+        if (m_Actions.WasPressed(ACT_RESPAWN))
         {
             m_pGame->SpawnShip();
         }
+        if (m_Actions.WasPressed(ACT_CAPTURE_BURST) && m_pFrameCapture)
+        {
+            m_pFrameCapture->TriggerBurst(k_nCaptureBurstFrames);
+        }
+        if (m_Options.bBenchmarks && m_Actions.WasPressed(ACT_BENCH_POLYGONS))
+        {
+            // timings are only meaningful from an optimized build
+            const eng::rdr::PolygonBenchmark bench = eng::rdr::BenchmarkPolygonGeneration(k_nPolygonBenchmarkCount);
+            eng::util::DebugTrace(_T("DrawPolygon: %10.0f polygons/sec direct, %10.0f polygons/sec cached (%.2fx) \n"),
+                                  bench.dDirectPerSecond, bench.dCachedPerSecond,
+                                  bench.dDirectPerSecond > 0.0 ? bench.dCachedPerSecond / bench.dDirectPerSecond : 0.0);
+        }
+        if (m_Options.bBenchmarks && m_Actions.WasPressed(ACT_BENCH_RESAMPLER))
+        {
+            const eng::audio::ResamplerBenchmark bench = eng::audio::BenchmarkResampler(k_nResamplerBenchmarkVoices, k_nResamplerBenchmarkBlocks);
+            eng::util::DebugTrace(_T("Mixer: %zu voices, %8.0f voice blocks/ms direct, %8.0f voice blocks/ms resampled \n"),
+                                  bench.nVoices, bench.dDirectPerMs, bench.dResampledPerMs);
+        }
 
         m_pGame->Update( fDeltaTime );
 
-        if (m_pSoundManager)
+        if (m_pSoundEvents)
+            m_pSoundEvents->Flush( fDeltaTime );
+
+        UpdateAudio( fDeltaTime );
+    }
+}
+//-----------------------------------------------------------------------------------------------
+/**
+  @brief latches this tick's keyboard and controller states
+
+  While recording, the states the game is about to read are logged with the
+  tick's delta time.  While replaying, the recorded delta time and states
+  replace the frame's own, and the game sees exactly the ticks of the
+  captured session.
+
+  @retval false   when a replay has ended and the tick is to be skipped
+ */
+bool CApplication::UpdateInput( float& fDeltaTime ) noexcept
+{
+    if (m_pInputRecorder && m_pInputRecorder->IsReplaying())
+    {
+        KeyboardState state;
+        if (!m_pInputRecorder->ReplayTick( fDeltaTime, state, s_rgControllers, MAX_CONTROLLERS ))
         {
-            if (m_pSoundManager->Update() == false)
-            {
-                if (m_pSoundManager->IsAudioDevicePresent() == false)
-                {
-                    // TODO
-                }
-            }
+            eng::util::DebugTrace(_T("Input: replay of '%hs' complete \n"), m_Options.szReplayPath);
+            m_pInputRecorder->Close();
+            ::PostQuitMessage(0);
+            return false;
         }
+
+        m_Keyboard.SetState( state );
+        m_Keyboard.UpdateStates();
     }
-}
+    else if (m_pInputDevice)
+    {
+        if (!PollInputDevice( fDeltaTime ))
+        {
+            eng::util::DebugTrace(_T("Input: the '%hs' input device has ended \n"), m_pInputDevice->get_Name());
+            ::PostQuitMessage(0);
+            return false;
+        }
+    }
+    else
+    {
+        m_Keyboard.UpdateStates();
+
+        if (m_pInputSampler)
+            m_pInputSampler->BeginTick( eng::util::GetCurrentTimeInSeconds(), m_Keyboard.GetState(), s_rgControllers, MAX_CONTROLLERS );
+        else
+            UpdateControllerStates();
+    }
+
+    if (m_pInputRecorder && m_pInputRecorder->IsRecording() &&
+        !m_pInputRecorder->RecordTick( fDeltaTime, m_Keyboard.GetState(), s_rgControllers, MAX_CONTROLLERS ))
+    {
+        eng::util::DebugTrace(_T("Input: cannot write '%hs', recording stopped \n"), m_Options.szRecordPath);
+    }
+
+    // pad 0 plays; the rest of the tick reads m_Actions only
+    m_ActionMap.Resolve( m_Keyboard.GetState(), s_rgControllers[0].get_State().Gamepad.wButtons,
+                         m_pInputSampler, m_Actions );
+    return true;
+};
+
+//-----------------------------------------------------------------------------------------------
+bool CApplication::PollInputDevice( float fDeltaTime ) noexcept
+{
+    m_dInputTime += fDeltaTime;
+
+    InputSnapshot snapshot;
+    if (!m_pInputDevice->Poll( m_dInputTime, snapshot ))
+        return false;
+
+    m_Keyboard.SetState( snapshot.stKeyboard );
+    m_Keyboard.UpdateStates();
+
+    static_assert(sizeof(PadState) == sizeof(XINPUT_GAMEPAD), "PadState must mirror XINPUT_GAMEPAD");
+
+    for (DWORD i = 0; i < MAX_CONTROLLERS && i < k_nMaxInputPads; i++)
+    {
+        const bool bConnected = (snapshot.nConnectedPads & (1u << i)) != 0;
+
+        XINPUT_STATE state = { 0 };
+        state.dwPacketNumber = s_rgControllers[i].get_State().dwPacketNumber + 1;
+        memcpy(&state.Gamepad, &snapshot.rgPads[i], sizeof(XINPUT_GAMEPAD));
+
+        s_rgControllers[i].SetControllerState( state, bConnected );
+        if (bConnected && g_bDeadZoneOn)
+            s_rgControllers[i].ApplyRadialDeadZone();
+    }
+    return true;
+};
+
 //-----------------------------------------------------------------------------------------------
 bool CApplication::PlaySound(int iIndex) noexcept
 {
     bool bReturn = false;
 
-    if (m_pSoundManager)
+    if (m_pSoundEvents)
     {
-        m_pSoundManager->Play(iIndex);
+        m_pSoundEvents->Trigger(iIndex);
+        bReturn = true;
+    }
+    return bReturn;
+};
+//-----------------------------------------------------------------------------------------------
+bool CApplication::PlaySound(int iIndex, const eng::math::CVector2f& vPosition) noexcept
+{
+    bool bReturn = false;
+
+    if (m_pSoundEvents)
+    {
+        m_pSoundEvents->Trigger(iIndex, vPosition);
         bReturn = true;
     }
     return bReturn;
@@ -242,9 +1069,21 @@ bool CApplication::StopSound(int iIndex) noexcept
 {
     bool bReturn = false;
 
-    if (m_pSoundManager)
+    if (m_pSoundEvents)
     {
-        m_pSoundManager->Stop(iIndex);
+        m_pSoundEvents->Release(iIndex);
+        bReturn = true;
+    }
+    return bReturn;
+};
+//-----------------------------------------------------------------------------------------------
+bool CApplication::SetSoundPitch(int iIndex, float fPitch) noexcept
+{
+    bool bReturn = false;
+
+    if (m_pSoundEvents)
+    {
+        m_pSoundEvents->SetPitch(iIndex, fPitch);
         bReturn = true;
     }
     return bReturn;
@@ -252,10 +1091,21 @@ bool CApplication::StopSound(int iIndex) noexcept
 //-----------------------------------------------------------------------------------------------
 void CApplication::Render( void )
 {
+    PROFILE_SCOPE("Render");
+
     if (m_pGame)
         m_pGame->Render();
 
-    ::SwapBuffers( m_hdcDisplay );
+    if (m_pFrameCapture)
+        m_pFrameCapture->OnFrameEnd( m_iMainWinWidth, m_iMainWinHeight );
+
+    if (m_pVideoRecorder)
+        m_pVideoRecorder->OnFrameEnd( m_iMainWinWidth, m_iMainWinHeight );
+
+    {
+        PROFILE_SCOPE("SwapBuffers");
+        ::SwapBuffers( m_hdcDisplay );
+    }
 };
 
 //-----------------------------------------------------------------------------------------------
@@ -274,34 +1124,31 @@ void CApplication::OnSize(void)
 //-----------------------------------------------------------------------------------------------
 void CApplication::UpdateControllerStates(void)
 {
+    // empty slots are probed by the monitor thread, an XInputGetState() on one stalls
+    const uint32_t nConnected = m_pControllerMonitor ? m_pControllerMonitor->get_ConnectedMask()
+                                                     : ((1u << MAX_CONTROLLERS) - 1);
+
     for (DWORD i = 0; i < MAX_CONTROLLERS; i++)
     {
-        s_rgControllers[i].UpdateControllerState();
+        CXboxController& controller = s_rgControllers[i];
 
-        if (s_rgControllers[i].m_bConnected)
+        if ((nConnected & (1u << i)) == 0)
         {
-            if (g_bDeadZoneOn)
-            {
-                // Zero value if thumbsticks are within the dead zone
-                if (( s_rgControllers[i].m_stInput.Gamepad.sThumbLX <  XINPUT_GAMEPAD_LEFT_THUMB_DEADZONE &&
-                      s_rgControllers[i].m_stInput.Gamepad.sThumbLX > -XINPUT_GAMEPAD_LEFT_THUMB_DEADZONE ) &&
-                    ( s_rgControllers[i].m_stInput.Gamepad.sThumbLY <  XINPUT_GAMEPAD_LEFT_THUMB_DEADZONE &&
-                      s_rgControllers[i].m_stInput.Gamepad.sThumbLY > -XINPUT_GAMEPAD_LEFT_THUMB_DEADZONE ))
-                {
-                    s_rgControllers[i].m_stInput.Gamepad.sThumbLX = 0;
-                    s_rgControllers[i].m_stInput.Gamepad.sThumbLY = 0;
-                }
-
-                if (( s_rgControllers[i].m_stInput.Gamepad.sThumbRX <  XINPUT_GAMEPAD_RIGHT_THUMB_DEADZONE &&
-                      s_rgControllers[i].m_stInput.Gamepad.sThumbRX > -XINPUT_GAMEPAD_RIGHT_THUMB_DEADZONE ) &&
-                    ( s_rgControllers[i].m_stInput.Gamepad.sThumbRY <  XINPUT_GAMEPAD_RIGHT_THUMB_DEADZONE &&
-                      s_rgControllers[i].m_stInput.Gamepad.sThumbRY > -XINPUT_GAMEPAD_RIGHT_THUMB_DEADZONE))
-                {
-                    s_rgControllers[i].m_stInput.Gamepad.sThumbRX = 0;
-                    s_rgControllers[i].m_stInput.Gamepad.sThumbRY = 0;
-                }
-            }
+            // an empty slot reads as a released, centred pad
+            const XINPUT_STATE stEmpty = { 0 };
+            controller.SetControllerState(stEmpty, false);
+            continue;
         }
+
+        if (!controller.UpdateControllerState())
+        {
+            if (m_pControllerMonitor)
+                m_pControllerMonitor->MarkDisconnected(i);
+            continue;
+        }
+
+        if (g_bDeadZoneOn)
+            controller.ApplyRadialDeadZone();
     }
 };
 
@@ -346,6 +1193,8 @@ LRESULT CALLBACK CApplication::MainWndProc( HWND hWnd, UINT uMsg, WPARAM wParam,
             // if the thread has a current rendering context ...
             if ( hglrc )
             {
+                // GL objects can only be deleted while it is current
+                g_theApp.ReleaseRenderResources();
 
                 // obtain its associated device context
                 hdc = wglGetCurrentDC();
@@ -388,8 +1237,11 @@ LRESULT CALLBACK CApplication::MainWndProc( HWND hWnd, UINT uMsg, WPARAM wParam,
 }
 
 //-----------------------------------------------------------------------------------------------
-void CALLBACK CApplication::KeyboardHandler(UINT nKey, BOOL /*bKeyPressed*/)
+void CALLBACK CApplication::KeyboardHandler(UINT nKey, BOOL bKeyPressed)
 {
+    if (g_theApp.m_pInputSampler)
+        g_theApp.m_pInputSampler->OnKeyEvent( static_cast<int>( nKey ), bKeyPressed != FALSE, GetMessageTimeInSeconds() );
+
     Keys Key = static_cast<Keys>( nKey );
     switch (Key)
     {
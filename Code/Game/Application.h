@@ -17,6 +17,14 @@
     #include <tchar.h>
 #endif 
 
+#ifndef _MEMORY_
+    #include <memory>
+#endif
+
+#ifndef _VECTOR_
+    #include <vector>
+#endif
+
 #ifndef __KEYBOARD_H__
     #include "Keyboard.h"
 #endif
@@ -25,16 +33,86 @@
     #include "XboxController.h"
 #endif
 
+#ifndef __ACTION_MAP_H__
+    #include "ActionMap.h"
+#endif
+
 #include "CommonDef.h"
 // forward declaration
+namespace eng
+{
+class CAssetPack;
+class CAssetReloader;
+struct ReloadedAsset;
+
+namespace audio
+{
+class CAudioMixer;
+class IAudioSink;
+}
+
+namespace rdr
+{
+class CFrameCapture;
+class CTextureCache;
+class CVideoRecorder;
+}
+}
+
 class CGame;
 class CSoundManager;
+class CSoundEvents;
+class CInputRecorder;
+class CControllerMonitor;
+class CInputSampler;
+class IInputDevice;
+
+/**
+ * @brief options parsed from the command line at startup
+ */
+struct LaunchOptions
+{
+    char szVideoPath[MAX_PATH];   ///< -video <file.y4m>, records the session when set
+    bool bCoreProfile;            ///< -gl33, render through the OpenGL 3.3 core profile backend
+    bool bHotReload;              ///< -hotreload, watch the deploy directory and swap in edited assets
+    char szAudioSink[MAX_PATH];   ///< -audio <null|device|file.wav>, play through the software mixer
+    char szMusicPath[MAX_PATH];   ///< -music <file.wav>, looped from disk through the mixer
+    char szStatsPath[MAX_PATH];   ///< -stats <file.txt>, engine statistics report written at Shutdown
+    char szRecordPath[MAX_PATH];  ///< -record <file>, logs per tick input and the rand() seed
+    char szReplayPath[MAX_PATH];  ///< -replay <file>, plays a recording back and quits at its end
+    bool bHeadless;               ///< -headless, updates without rendering, for replay benchmarks; disables -video
+    unsigned int nInputSampleHz;  ///< -inputhz <n>, controller sampling rate, 0 polls once per frame
+    char szInputDevice[MAX_PATH]; ///< -input <win32|evdev:<dev>|script[:<seed>|:<file>]>, replaces live input
+    char szTracePath[MAX_PATH];   ///< -trace <file.json>, Chrome trace of the profiled zones written at Shutdown
+    bool bBenchmarks;             ///< -bench, F11 / F10 benchmark polygon generation / the mixer resampler, in any build
+};
 
 class CApplication
 {
     CGame*                  m_pGame;
     CSoundManager*          m_pSoundManager;
+    CSoundEvents*           m_pSoundEvents;
+    CInputRecorder*         m_pInputRecorder;
+    CControllerMonitor*     m_pControllerMonitor;
+    CInputSampler*          m_pInputSampler;
+    IInputDevice*           m_pInputDevice;
+    eng::rdr::CFrameCapture* m_pFrameCapture;
+    eng::rdr::CVideoRecorder* m_pVideoRecorder;
+    eng::CAssetPack*        m_pAssetPack;
+    eng::rdr::CTextureCache* m_pTextureCache;
+    eng::CAssetReloader*    m_pAssetReloader;
+    std::vector<std::unique_ptr<eng::ReloadedAsset>>* m_prgReloaded;  ///< reused each frame; held by pointer so the constructor stays constexpr
+    eng::audio::CAudioMixer* m_pAudioMixer;
+    eng::audio::IAudioSink* m_pAudioSink;
+    LaunchOptions           m_Options;
+    float                   m_fAudioRetryTimer;     ///< seconds until the next audio Reset() attempt
+    int                     m_iStatAudioFailures;
+    int                     m_iStatAudioResets;
+    int                     m_iStatReplayFrame;
+    double                  m_dInputTime;           ///< game time the input device is polled at
     CKeyboard               m_Keyboard;
+    CActionMap              m_ActionMap;
+    ActionState             m_Actions;              ///< resolved once per tick by UpdateInput()
     HINSTANCE               m_hInstance;
     HWND                    m_hMainWnd;
     HDC                     m_hdcDisplay;
@@ -50,7 +128,7 @@ public:
     /// Default destructor
     ~CApplication() noexcept;
 
-    void Initialize ( HINSTANCE hInstance );
+    void Initialize ( HINSTANCE hInstance, LPCSTR szCmdLine = nullptr );
 
     void Shutdown   ( void ) noexcept;
 
@@ -59,7 +137,9 @@ public:
     void Update     ( float fDeltaTime );
 
     bool PlaySound  ( int iIndex ) noexcept;
+    bool PlaySound  ( int iIndex, const eng::math::CVector2f& vPosition ) noexcept;
     bool StopSound  ( int iIndex ) noexcept;
+    bool SetSoundPitch( int iIndex, float fPitch ) noexcept;
 
     inline bool IsKeyPressed         ( Keys key ) const noexcept
     { return m_Keyboard.IsKeyPressed(key); };
@@ -73,6 +153,9 @@ public:
     inline const KeyboardState& GetKeyboardState(void) const noexcept
     { return m_Keyboard.GetState(); };
 
+    inline const ActionState&   GetActions(void) const noexcept
+    { return m_Actions; };
+
     inline bool IsController_APressed(size_t nController = 0) const noexcept
     { if (nController < _countof(CApplication::s_rgControllers))
          return CApplication::s_rgControllers[nController].get_A();
@@ -144,6 +227,23 @@ public:
 
 private:
     void    CreateOpenGLWindow      ( void ) noexcept;
+    void    InitAssetPack           ( void );
+    void    InitTextureCache        ( void );
+    void    InitAssetReloader       ( void );
+    void    InitAudioMixer          ( void );
+    void    InitInputRecorder       ( void );
+    void    InitControllerMonitor   ( void );
+    void    InitInputSampler        ( void );
+    void    InitInputDevice         ( void );
+    bool    UpdateInput             ( float& fDeltaTime ) noexcept;
+    bool    PollInputDevice         ( float fDeltaTime ) noexcept;
+    void    UpdateAudio             ( float fDeltaTime ) noexcept;
+    void    ReportStats             ( void ) noexcept;
+    void    ReleaseRenderResources  ( void ) noexcept;
+    void    ApplyAssetReloads       ( void );
+    void    InitFrameCapture        ( void );
+    void    InitVideoRecorder       ( void );
+    void    ParseCommandLine        ( LPCSTR szCmdLine ) noexcept;
     void    RegisterWndClass        ( void ) noexcept;
 
     void    OnSize                  ( void );
@@ -162,7 +262,28 @@ private:
 constexpr CApplication::CApplication() noexcept
   : m_pGame(nullptr),
     m_pSoundManager(nullptr),
+    m_pSoundEvents(nullptr),
+    m_pInputRecorder(nullptr),
+    m_pControllerMonitor(nullptr),
+    m_pInputSampler(nullptr),
+    m_pInputDevice(nullptr),
+    m_pFrameCapture(nullptr),
+    m_pVideoRecorder(nullptr),
+    m_pAssetPack(nullptr),
+    m_pTextureCache(nullptr),
+    m_pAssetReloader(nullptr),
+    m_prgReloaded(nullptr),
+    m_pAudioMixer(nullptr),
+    m_pAudioSink(nullptr),
+    m_Options{},
+    m_fAudioRetryTimer(0.f),
+    m_iStatAudioFailures(-1),
+    m_iStatAudioResets(-1),
+    m_iStatReplayFrame(-1),
+    m_dInputTime(0.0),
     m_Keyboard(),
+    m_ActionMap(),
+    m_Actions{},
     m_hInstance(nullptr),
     m_hMainWnd(nullptr),
     m_hdcDisplay(nullptr),
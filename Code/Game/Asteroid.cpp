@@ -25,7 +25,7 @@ CAsteroid::CAsteroid(ASTEROID_TYPE type) noexcept
       m_Type(type),
       m_fAngularVelocity(0.0),
       m_degOrientation(0.0),
-      m_rgVertices()
+      m_nShape(0)
 {
 };
 
@@ -35,7 +35,7 @@ CAsteroid::CAsteroid(const CAsteroid& o)
       m_Type(o.m_Type),
       m_fAngularVelocity(o.m_fAngularVelocity),
       m_degOrientation(o.m_degOrientation),
-      m_rgVertices(o.m_rgVertices)
+      m_nShape(o.m_nShape)
 {
 };
 
@@ -45,7 +45,7 @@ CAsteroid::CAsteroid(CAsteroid&& o) noexcept
       m_Type(o.m_Type),
       m_fAngularVelocity(o.m_fAngularVelocity),
       m_degOrientation(o.m_degOrientation),
-      m_rgVertices(o.m_rgVertices)
+      m_nShape(o.m_nShape)
 {
 };
 //-----------------------------------------------------------------------------------------------
@@ -55,7 +55,7 @@ CAsteroid::CAsteroid(ASTEROID_TYPE type, const eng::math::CVector2f& vCenter, fl
       m_Type(type),
       m_fAngularVelocity(fAngularVelocity),
       m_degOrientation(0.0),
-      m_rgVertices()
+      m_nShape(0)
 { 
 };
 
@@ -65,10 +65,10 @@ CAsteroid::~CAsteroid()
 };
 
 //-----------------------------------------------------------------------------------------------
-size_t CAsteroid::AddVertex(const eng::math::CVector2f& vNewVertex) noexcept
+eng::ShapeInstance CAsteroid::get_ShapeInstance(void) const noexcept
 {
-    m_rgVertices.push_back(vNewVertex); // note - may throw an exception
-    return m_rgVertices.size();
+    return eng::ShapeInstance{ get_Center().X, get_Center().Y, get_Radius(), get_Orientation(),
+                               k_clrAsteroidDefault };
 };
 
 //-----------------------------------------------------------------------------------------------
@@ -76,15 +76,10 @@ void CAsteroid::Render(void) const
 {
     if (IsActive())
     {
-        eng::g_theRdr.SetLineWidth(k_fAsteroidLineWidth);
-        eng::g_theRdr.SetColor(k_clrAsteroidDefault);
-
-        eng::g_theRdr.PushView();
+        const eng::ShapeInstance instance = get_ShapeInstance();
 
-        eng::g_theRdr.TranslateView(get_Center());
-        eng::g_theRdr.DrawPolygon(m_rgVertices, get_Orientation());
-
-        eng::g_theRdr.PopView();
+        eng::g_theRdr.SetLineWidth(k_fAsteroidLineWidth);
+        eng::g_theRdr.DrawShapeInstances(m_nShape, &instance, 1);
     }
 };
 
@@ -96,23 +91,25 @@ void CAsteroid::Update(float fDeltaTime)
 };
 
 //-----------------------------------------------------------------------------------------------
-void CAsteroid::InitIrregularAsteroid(size_t nNumVertices) noexcept
+void CAsteroid::GenerateIrregularOutline(size_t nNumVertices, std::vector<eng::math::CVector2f>& rgVertices)
 {
-    const float   fDeltaRadius      = get_Radius() / 3.f; // used to generate a random radius
-    const RADIANS fRadiansPerVertex = static_cast<float>(eng::math::RADIANS_PER_CIRCLE / nNumVertices);
+    const float fDeltaRadius = 1.f / 3.f; // used to generate a random radius
 
-    for (RADIANS fRadians = 0.0; fRadians < eng::math::RADIANS_PER_CIRCLE; fRadians += fRadiansPerVertex)
+    rgVertices.clear();
+    rgVertices.reserve(nNumVertices); // note - may throw an exception
+
+    for (size_t i = 0; i < nNumVertices; i++)
     {
-        float fVertexRadius = static_cast<float>( eng::math::RangedRand(get_Radius() - fDeltaRadius, get_Radius() + fDeltaRadius) );
-        float x = /* get_Center().X + */ ( fVertexRadius * std::cos(fRadians) );
-        float y = /* get_Center().Y + */ ( fVertexRadius * std::sin(fRadians) );
-        AddVertex( eng::math::CVector2f( x, y) );
+        const RADIANS fRadians      = static_cast<float>( (eng::math::RADIANS_PER_CIRCLE * i) / nNumVertices );
+        const float   fVertexRadius = static_cast<float>( eng::math::RangedRand(1.f - fDeltaRadius, 1.f + fDeltaRadius) );
+
+        rgVertices.push_back( eng::math::CVector2f( fVertexRadius * std::cos(fRadians),
+                                                    fVertexRadius * std::sin(fRadians) ) );
     }
 };
 
 
 
-
 //-----------------------------------------------------------------------------------------------
 CSmallAsteroid::CSmallAsteroid (const eng::math::CVector2f& vCenter, const eng::math::CVector2f& vVel, float fAngularVelocity) noexcept
     : CAsteroid (AST_SMALL, vCenter, k_fAsteroidRadiusSmall, vVel, fAngularVelocity)
@@ -21,6 +21,10 @@
     #include <vector>
 #endif
 
+#ifndef __RENDER_TYPES_H__
+    #include "Engine/Renderer/RenderTypes.h"
+#endif
+
 enum ASTEROID_TYPE 
 { 
   AST_SMALL, 
@@ -35,7 +39,7 @@ class CAsteroid :
     ASTEROID_TYPE                     m_Type;
     float                             m_fAngularVelocity;   // in degrees per time segment
     DEGREES                           m_degOrientation;     // in degrees
-    std::vector<eng::math::CVector2f> m_rgVertices;
+    size_t                            m_nShape;             // registered unit outline, shared between asteroids
 
 public:
     /// Default Constructor
@@ -66,15 +70,29 @@ public:
     { m_degOrientation += degDelta; };
 
 
-    void           InitIrregularAsteroid(size_t nNumVertices) noexcept;
+    inline void              set_Shape            (size_t nShape) noexcept
+    { m_nShape = nShape; };
+
+    constexpr size_t         get_Shape            (void) const noexcept
+    { return m_nShape; };
+
+/**
+ *  @brief placement of this asteroid's outline: scaled by its radius,
+ *         rotated by its orientation and centered on its position
+ */
+    eng::ShapeInstance       get_ShapeInstance    (void) const noexcept;
+
+/**
+ *  @brief generates an irregular outline of unit radius (every vertex lies
+ *         within a third of 1.0) for registration with the renderer
+ *
+ *  @note - may throw an exception
+ */
+    static void    GenerateIrregularOutline (size_t nNumVertices, std::vector<eng::math::CVector2f>& rgVertices);
 
 // IRenderable 
     void   Render               (void) const override;
     void   Update               (float fDeltaTime) override;
-
-private:
-    size_t         AddVertex            (const eng::math::CVector2f& vNewVertex) noexcept;
-
 };
 
 class CLargeAsteroid : public CAsteroid
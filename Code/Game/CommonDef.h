@@ -24,6 +24,9 @@ typedef float                RADIANS;
 
 constexpr size_t MAX_CONTROLLERS = 4;  // XInput handles up to 4 controllers
 
+constexpr unsigned int k_nControllerProbeMs = 500;  // background probe interval of empty controller slots
+constexpr unsigned int k_nInputSampleHz     = 1000; // controller sampling rate between ticks, see -inputhz
+
 constexpr int    WINDOW_PHYSICAL_WIDTH = 1600;
 constexpr int    WINDOW_PHYSICAL_HEIGHT = 900;
 
@@ -33,8 +36,22 @@ constexpr float VIEW_RIGHT  = 1600.0;
 constexpr float VIEW_BOTTOM = 0.0;
 constexpr float VIEW_TOP    = VIEW_RIGHT * static_cast< float >(WINDOW_PHYSICAL_HEIGHT) / static_cast< float >(WINDOW_PHYSICAL_WIDTH);
 
+constexpr float VIEW_WIDTH  = VIEW_RIGHT - VIEW_LEFT;
+constexpr float VIEW_HEIGHT = VIEW_TOP - VIEW_BOTTOM;
+
+// actors wrap around bounds a margin beyond the view, so they leave the
+// screen entirely before reappearing on the far side
+constexpr float WRAP_LEFT   = VIEW_LEFT   - OFFSET_FROM_WINDOWS_DESKTOP;
+constexpr float WRAP_RIGHT  = VIEW_RIGHT  + OFFSET_FROM_WINDOWS_DESKTOP;
+constexpr float WRAP_BOTTOM = VIEW_BOTTOM - OFFSET_FROM_WINDOWS_DESKTOP;
+constexpr float WRAP_TOP    = VIEW_TOP    + OFFSET_FROM_WINDOWS_DESKTOP;
+
+constexpr float WRAP_WIDTH  = WRAP_RIGHT - WRAP_LEFT;
+constexpr float WRAP_HEIGHT = WRAP_TOP - WRAP_BOTTOM;
+
 constexpr size_t MAX_ACTORS             = 512;
 constexpr size_t ASTEROID_VERTICES      = 12;
+constexpr size_t k_nAsteroidShapeVariants = 16;  ///< irregular outlines shared by all asteroids
 constexpr size_t INITIAL_ASTEROIDS      = 6;
 constexpr size_t ASTEROID_WAVE_DELTA    = 4;
 
@@ -45,6 +62,8 @@ constexpr float k_ShipRadius            =  15.f;
 constexpr float k_fShipLineWidth        =   1.5f;
 constexpr float k_fShipThrust           = 250.f;
 constexpr float k_fShipTurnRate         = 160.f;
+constexpr float k_fEnginePitchIdle      =  -0.3f;  // octaves, engine rumble at the lightest thrust
+constexpr float k_fEnginePitchFull      =   0.2f;  // octaves, at full thrust
 
 constexpr float k_fAsteroidLineWidth    =   1.5f;
 constexpr float k_fAsteroidRadiusLarge  =  40.f;
@@ -52,6 +71,57 @@ constexpr float k_fAsteroidRadiusMedium =  30.f;
 constexpr float k_fAsteroidRadiusSmall  =  20.f;
 constexpr float k_fAsteroidSpeed        =  50.f;
 
+// actors are drawn beyond their collision radius (ship nose, irregular asteroid
+// vertices), so culling is done against a scaled-up bounding circle
+constexpr float k_fCullRadiusScale      =   1.75f;
+
+// score, points per asteroid destroyed, and its HUD
+constexpr unsigned int k_nScoreLargeAsteroid  =  20;
+constexpr unsigned int k_nScoreMediumAsteroid =  50;
+constexpr unsigned int k_nScoreSmallAsteroid  = 100;
+constexpr float        k_fScoreTexelSize      =   6.f;  // view units per glyph texel
+constexpr float        k_fScoreMargin         =  20.f;
+constexpr const char*  k_szScoreDigitsTexture = "Assets\\Images\\ScoreDigits.png";  // digits 0 .. 9 left to right
+
+// particle effects
+constexpr size_t k_nMaxParticles              = 131072;
+constexpr float  k_fParticlePointSize         =   2.f;
+constexpr float  k_fExhaustParticlesPerSecond = 240.f;
+constexpr float  k_fExhaustSpeedMin           =  60.f;
+constexpr float  k_fExhaustSpeedMax           = 140.f;
+constexpr float  k_fExhaustSpread             =  30.f;  // degrees
+constexpr float  k_fExhaustLifeMin            =   0.15f;
+constexpr float  k_fExhaustLifeMax            =   0.4f;
+constexpr size_t k_nShipExplosionParticles    = 600;
+constexpr size_t k_nAsteroidExplosionLarge    = 400;
+constexpr size_t k_nAsteroidExplosionMedium   = 250;
+constexpr size_t k_nAsteroidExplosionSmall    = 150;
+
+// frame capture (PNG) settings
+constexpr size_t       k_nCapturePoolSize     =   6;  // frames that may be awaiting encode
+constexpr size_t       k_nCaptureBurstFrames  = 120;  // frames captured per F12 press
+constexpr unsigned int k_nCaptureInterval     =   0;  // capture every Nth frame, 0 = off
+
+// session video (Y4M) settings, see -video
+constexpr size_t       k_nVideoQueueDepth     =   8;  // frames that may await conversion before dropping
+constexpr int          k_iVideoFrameRate      =  60;  // stamped on live play, a replay uses its own tick rate
+
+// asset pack searched before loose files, relative to the module path
+constexpr const char*  k_szAssetPackFile      = "Assets.pak";
+
+// streamed background track, see -music (requires -audio)
+constexpr float        k_fMusicVolume         = 0.5f;
+
+// seconds between attempts to reset a failed audio output
+constexpr float        k_fAudioRetrySeconds   = 2.0f;
+
+// DrawPolygon benchmark (F11), see -bench
+constexpr size_t       k_nPolygonBenchmarkCount = 1000000;
+
+// mixer resampler benchmark (F10), see -bench
+constexpr size_t       k_nResamplerBenchmarkVoices = 48;
+constexpr size_t       k_nResamplerBenchmarkBlocks = 2000;
+
 #include "Resources\resource.h"
 
 
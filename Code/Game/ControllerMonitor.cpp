@@ -0,0 +1,113 @@
+/**
+ *  @file       ControllerMonitor.cpp
+ *  @brief      CControllerMonitor class implementation
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ */
+
+#define WIN32_LEAN_AND_MEAN
+#include "targetver.h"  // this needs to be the 1st header included
+
+#include <Windows.h>
+#include <Xinput.h>
+
+#include "ControllerMonitor.h"
+
+//-----------------------------------------------------------------------------------------------
+CControllerMonitor::CControllerMonitor() noexcept
+    : m_thProbe(),
+      m_mtxProbe(),
+      m_cvProbe(),
+      m_bShutdown(false),
+      m_nControllers(0),
+      m_tmInterval(0),
+      m_nConnectedMask(0),
+      m_nConnects(0),
+      m_nDisconnects(0)
+{
+};
+
+//-----------------------------------------------------------------------------------------------
+CControllerMonitor::~CControllerMonitor() noexcept
+{
+    Stop();
+};
+
+//-----------------------------------------------------------------------------------------------
+void CControllerMonitor::Start( uint32_t nControllers, unsigned int nIntervalMs )
+{
+    if (m_thProbe.joinable())
+        return;
+
+    m_nControllers = (nControllers < 32) ? nControllers : 32;
+    m_tmInterval   = std::chrono::milliseconds(nIntervalMs);
+    m_bShutdown    = false;
+
+    // the first frame already sees the pads plugged in at startup
+    ProbeEmptySlots();
+
+    m_thProbe = std::thread(&CControllerMonitor::ProbeProc, this); // note - may throw an exception
+};
+
+//-----------------------------------------------------------------------------------------------
+void CControllerMonitor::Stop( void ) noexcept
+{
+    if (m_thProbe.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mtxProbe);
+            m_bShutdown = true;
+        }
+        m_cvProbe.notify_one();
+        m_thProbe.join();
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+void CControllerMonitor::MarkDisconnected( uint32_t nController ) noexcept
+{
+    if (nController >= m_nControllers)
+        return;
+
+    const uint32_t nBit = 1u << nController;
+    if (m_nConnectedMask.fetch_and(~nBit, std::memory_order_acq_rel) & nBit)
+        m_nDisconnects.fetch_add(1, std::memory_order_relaxed);
+};
+
+//-----------------------------------------------------------------------------------------------
+void CControllerMonitor::ProbeProc( void ) noexcept
+{
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mtxProbe);
+            if (m_cvProbe.wait_for(lock, m_tmInterval, [this] { return m_bShutdown; }))
+                break;
+        }
+
+        ProbeEmptySlots();
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+void CControllerMonitor::ProbeEmptySlots( void ) noexcept
+{
+    const uint32_t nConnected = m_nConnectedMask.load(std::memory_order_acquire);
+
+    for (uint32_t i = 0; i < m_nControllers; i++)
+    {
+        const uint32_t nBit = 1u << i;
+        if (nConnected & nBit)
+            continue;   // the frame loop owns it
+
+        XINPUT_STATE state = { 0 };
+        if (::XInputGetState(i, &state) == ERROR_SUCCESS)
+        {
+            // publishes the slot to the frame loop's next poll
+            m_nConnectedMask.fetch_or(nBit, std::memory_order_acq_rel);
+            m_nConnects.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+};
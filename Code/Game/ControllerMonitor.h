@@ -0,0 +1,100 @@
+/**
+ *  @file       ControllerMonitor.h
+ *  @brief      CControllerMonitor class interface
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ *  <b>Implementation:</b>
+ *
+ *   XInputGetState() on an empty slot costs hundreds of microseconds, so
+ *   the frame loop only polls pads it believes are connected.  A background
+ *   thread probes the empty slots every few hundred milliseconds and sets
+ *   their bit in an atomic connected mask when a pad appears; the frame
+ *   loop clears a bit with MarkDisconnected() the first time a poll of
+ *   that pad fails.  Each side only ever touches the slots the other one
+ *   is not polling.
+ */
+#pragma once
+
+#if !defined(__CONTROLLER_MONITOR_H__)
+#define __CONTROLLER_MONITOR_H__
+
+#ifndef _ATOMIC_
+    #include <atomic>
+#endif
+
+#ifndef _CHRONO_
+    #include <chrono>
+#endif
+
+#ifndef _CONDITION_VARIABLE_
+    #include <condition_variable>
+#endif
+
+#ifndef _CSTDINT_
+    #include <cstdint>
+#endif
+
+#ifndef _MUTEX_
+    #include <mutex>
+#endif
+
+#ifndef _THREAD_
+    #include <thread>
+#endif
+
+class CControllerMonitor
+{
+    std::thread                 m_thProbe;
+    std::mutex                  m_mtxProbe;
+    std::condition_variable     m_cvProbe;
+    bool                        m_bShutdown;
+    uint32_t                    m_nControllers;
+    std::chrono::milliseconds   m_tmInterval;
+    std::atomic<uint32_t>       m_nConnectedMask;
+    std::atomic<uint32_t>       m_nConnects;        ///< pads found by the probe
+    std::atomic<uint32_t>       m_nDisconnects;     ///< pads lost by the frame loop
+
+public:
+    /// Default Constructor
+    CControllerMonitor() noexcept;
+    /// Default Destructor, stops the probe thread
+    ~CControllerMonitor() noexcept;
+
+/**
+ *  @brief probes every slot once, then starts the probe thread
+ *
+ *  @param [in] nControllers   slots to watch, at most 32
+ *  @param [in] nIntervalMs    milliseconds between probes of the empty slots
+ *
+ *  @note - may throw an exception
+ */
+    void     Start            ( uint32_t nControllers, unsigned int nIntervalMs );
+    void     Stop             ( void ) noexcept;
+
+/**
+ *  @brief called by the frame loop when polling a connected pad fails
+ */
+    void     MarkDisconnected ( uint32_t nController ) noexcept;
+
+    uint32_t get_ConnectedMask( void ) const noexcept
+    { return m_nConnectedMask.load(std::memory_order_acquire); };
+
+    uint32_t get_Connects     ( void ) const noexcept
+    { return m_nConnects.load(std::memory_order_relaxed); };
+
+    uint32_t get_Disconnects  ( void ) const noexcept
+    { return m_nDisconnects.load(std::memory_order_relaxed); };
+
+private:
+    void     ProbeProc        ( void ) noexcept;
+    void     ProbeEmptySlots  ( void ) noexcept;
+
+    /// Copy constructor
+    CControllerMonitor(const CControllerMonitor&) = delete;
+    /// Assignment operator
+    CControllerMonitor& operator=(const CControllerMonitor&) = delete;
+};
+
+#endif
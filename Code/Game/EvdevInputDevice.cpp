@@ -0,0 +1,396 @@
+/**
+ *  @file       EvdevInputDevice.cpp
+ *  @brief      CEvdevInputDevice class implementation
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ * <b>Cite:</b>
+ *
+ * @sa https://www.kernel.org/doc/html/latest/input/input.html
+ * @sa https://www.kernel.org/doc/html/latest/input/gamepad.html
+ */
+
+#include "targetver.h"  // this needs to be the 1st header included
+
+#ifdef __linux__
+    #include <cerrno>
+    #include <fcntl.h>
+    #include <linux/input.h>
+    #include <sys/ioctl.h>
+    #include <unistd.h>
+#endif
+
+#include "EvdevInputDevice.h"
+
+//-----------------------------------------------------------------------------------------------
+CEvdevInputDevice::CEvdevInputDevice(const char* szPaths)
+    : m_strPaths(szPaths ? szPaths : ""),  // note - may throw an exception
+      m_rgNodes(),
+      m_stState()
+{
+    m_stState = InputSnapshot{};
+};
+
+//-----------------------------------------------------------------------------------------------
+CEvdevInputDevice::~CEvdevInputDevice() noexcept
+{
+    Close();
+};
+
+#ifdef __linux__
+
+struct EvdevKey
+{
+    uint16_t nCode;
+    Keys     eKey;
+};
+
+struct EvdevButton
+{
+    uint16_t nCode;
+    uint16_t wButton;
+};
+
+const constexpr EvdevKey k_rgEvdevKeys[] =
+{
+    { KEY_ESC,        Keys::Escape       }, { KEY_BACKSPACE,  Keys::Back         },
+    { KEY_TAB,        Keys::Tab          }, { KEY_ENTER,      Keys::Enter        },
+    { KEY_SPACE,      Keys::Space        }, { KEY_CAPSLOCK,   Keys::CapsLock     },
+    { KEY_LEFTSHIFT,  Keys::LeftShift    }, { KEY_RIGHTSHIFT, Keys::RightShift   },
+    { KEY_LEFTCTRL,   Keys::LeftControl  }, { KEY_RIGHTCTRL,  Keys::RightControl },
+    { KEY_LEFTALT,    Keys::LeftAlt      }, { KEY_RIGHTALT,   Keys::RightAlt     },
+    { KEY_UP,         Keys::Up           }, { KEY_DOWN,       Keys::Down         },
+    { KEY_LEFT,       Keys::Left         }, { KEY_RIGHT,      Keys::Right        },
+    { KEY_HOME,       Keys::Home         }, { KEY_END,        Keys::End          },
+    { KEY_PAGEUP,     Keys::PageUp       }, { KEY_PAGEDOWN,   Keys::PageDown     },
+    { KEY_INSERT,     Keys::Insert       }, { KEY_DELETE,     Keys::Delete       },
+    { KEY_PAUSE,      Keys::Pause        },
+    { KEY_0, Keys::D0 }, { KEY_1, Keys::D1 }, { KEY_2, Keys::D2 }, { KEY_3, Keys::D3 }, { KEY_4, Keys::D4 },
+    { KEY_5, Keys::D5 }, { KEY_6, Keys::D6 }, { KEY_7, Keys::D7 }, { KEY_8, Keys::D8 }, { KEY_9, Keys::D9 },
+    { KEY_A, Keys::A }, { KEY_B, Keys::B }, { KEY_C, Keys::C }, { KEY_D, Keys::D }, { KEY_E, Keys::E },
+    { KEY_F, Keys::F }, { KEY_G, Keys::G }, { KEY_H, Keys::H }, { KEY_I, Keys::I }, { KEY_J, Keys::J },
+    { KEY_K, Keys::K }, { KEY_L, Keys::L }, { KEY_M, Keys::M }, { KEY_N, Keys::N }, { KEY_O, Keys::O },
+    { KEY_P, Keys::P }, { KEY_Q, Keys::Q }, { KEY_R, Keys::R }, { KEY_S, Keys::S }, { KEY_T, Keys::T },
+    { KEY_U, Keys::U }, { KEY_V, Keys::V }, { KEY_W, Keys::W }, { KEY_X, Keys::X }, { KEY_Y, Keys::Y },
+    { KEY_Z, Keys::Z },
+    { KEY_F1, Keys::F1 }, { KEY_F2, Keys::F2 }, { KEY_F3,  Keys::F3  }, { KEY_F4,  Keys::F4  },
+    { KEY_F5, Keys::F5 }, { KEY_F6, Keys::F6 }, { KEY_F7,  Keys::F7  }, { KEY_F8,  Keys::F8  },
+    { KEY_F9, Keys::F9 }, { KEY_F10, Keys::F10 }, { KEY_F11, Keys::F11 }, { KEY_F12, Keys::F12 }
+};
+
+// BTN_NORTH is the top face button (XInput Y), BTN_WEST the left one (XInput X)
+const constexpr EvdevButton k_rgEvdevButtons[] =
+{
+    { BTN_SOUTH,      PAD_A              }, { BTN_EAST,       PAD_B              },
+    { BTN_WEST,       PAD_X              }, { BTN_NORTH,      PAD_Y              },
+    { BTN_TL,         PAD_LEFT_SHOULDER  }, { BTN_TR,         PAD_RIGHT_SHOULDER },
+    { BTN_SELECT,     PAD_BACK           }, { BTN_START,      PAD_START          },
+    { BTN_THUMBL,     PAD_LEFT_THUMB     }, { BTN_THUMBR,     PAD_RIGHT_THUMB    },
+    { BTN_DPAD_UP,    PAD_DPAD_UP        }, { BTN_DPAD_DOWN,  PAD_DPAD_DOWN      },
+    { BTN_DPAD_LEFT,  PAD_DPAD_LEFT      }, { BTN_DPAD_RIGHT, PAD_DPAD_RIGHT     }
+};
+
+// in PadState order after the buttons: LX, LY, RX, RY, then left and right trigger
+const constexpr uint16_t k_rgEvdevAxes[k_nEvdevAxes] =
+{
+    ABS_X, ABS_Y, ABS_RX, ABS_RY, ABS_Z, ABS_RZ
+};
+
+constexpr size_t k_nEvdevKeyBytes = KEY_MAX / 8 + 1;
+
+//-----------------------------------------------------------------------------------------------
+static bool TestBit(const uint8_t* rgBits, int iBit) noexcept
+{
+    return (rgBits[iBit >> 3] & (1u << (iBit & 7))) != 0;
+};
+
+//-----------------------------------------------------------------------------------------------
+bool CEvdevInputDevice::Open( void ) noexcept
+{
+    Close();
+
+    try
+    {
+        size_t nPos   = 0;
+        int    nPads  = 0;
+        while (nPos <= m_strPaths.size())
+        {
+            size_t nEnd = m_strPaths.find(',', nPos);
+            if (nEnd == std::string::npos)
+                nEnd = m_strPaths.size();
+
+            const std::string strPath = m_strPaths.substr(nPos, nEnd - nPos); // note - may throw an exception
+            nPos = nEnd + 1;
+
+            const int iFile = strPath.empty() ? -1 : ::open(strPath.c_str(), O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+            if (iFile < 0)
+                continue;
+
+            EvdevNode node = { iFile, -1, false, { 0 }, { 0 } };
+
+            uint8_t rgKeyBits[k_nEvdevKeyBytes] = { 0 };
+            if (::ioctl(iFile, EVIOCGBIT(EV_KEY, sizeof(rgKeyBits)), rgKeyBits) >= 0 &&
+                TestBit(rgKeyBits, BTN_GAMEPAD) && nPads < static_cast<int>(k_nMaxInputPads))
+            {
+                node.iPad = nPads++;
+
+                for (size_t i = 0; i < k_nEvdevAxes; i++)
+                {
+                    input_absinfo info{};
+                    if (::ioctl(iFile, EVIOCGABS(k_rgEvdevAxes[i]), &info) >= 0)
+                    {
+                        node.rgMin[i] = info.minimum;
+                        node.rgMax[i] = info.maximum;
+                    }
+                }
+                m_stState.nConnectedPads |= 1u << node.iPad;
+            }
+
+            m_rgNodes.push_back(node); // note - may throw an exception
+            Resync(m_rgNodes.back());
+        }
+    }
+    catch (...)
+    {
+        Close();
+        return false;
+    }
+
+    return !m_rgNodes.empty();
+};
+
+//-----------------------------------------------------------------------------------------------
+void CEvdevInputDevice::Close( void ) noexcept
+{
+    for (EvdevNode& node : m_rgNodes)
+    {
+        if (node.iFile >= 0)
+            ::close(node.iFile);
+    }
+    m_rgNodes.clear();
+    m_stState = InputSnapshot{};
+};
+
+//-----------------------------------------------------------------------------------------------
+bool CEvdevInputDevice::Poll( double, InputSnapshot& snapshot ) noexcept
+{
+    bool bAlive = false;
+
+    for (EvdevNode& node : m_rgNodes)
+    {
+        if (node.iFile < 0)
+            continue;
+
+        struct input_event rgEvents[64];
+        for (;;)
+        {
+            const ssize_t nRead = ::read(node.iFile, rgEvents, sizeof(rgEvents));
+            if (nRead < 0 && errno == EINTR)
+                continue;
+            if (nRead < 0 && errno != EAGAIN)
+            {
+                // unplugged; its pad reads as disconnected from now on
+                ::close(node.iFile);
+                node.iFile = -1;
+                if (node.iPad >= 0)
+                {
+                    m_stState.nConnectedPads &= ~(1u << node.iPad);
+                    m_stState.rgPads[node.iPad] = PadState{};
+                }
+                break;
+            }
+            if (nRead <= 0)
+                break;
+
+            const size_t nEvents = static_cast<size_t>(nRead) / sizeof(struct input_event);
+            for (size_t i = 0; i < nEvents; i++)
+            {
+                const struct input_event& ev = rgEvents[i];
+                if (ev.type == EV_SYN)
+                {
+                    if (ev.code == SYN_DROPPED)
+                    {
+                        node.bDropped = true;
+                    }
+                    else if (ev.code == SYN_REPORT && node.bDropped)
+                    {
+                        Resync(node);
+                        node.bDropped = false;
+                    }
+                }
+                else if (node.bDropped)
+                {
+                    continue;   // superseded by the resync
+                }
+                else if (ev.type == EV_KEY)
+                {
+                    ApplyKey(node, ev.code, ev.value != 0);     // 2 is auto repeat
+                }
+                else if (ev.type == EV_ABS)
+                {
+                    ApplyAxis(node, ev.code, ev.value);
+                }
+            }
+        }
+
+        bAlive = bAlive || (node.iFile >= 0);
+    }
+
+    snapshot = m_stState;
+    return bAlive;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CEvdevInputDevice::Resync( EvdevNode& node ) noexcept
+{
+    uint8_t rgKeyBits[k_nEvdevKeyBytes] = { 0 };
+    if (::ioctl(node.iFile, EVIOCGKEY(sizeof(rgKeyBits)), rgKeyBits) >= 0)
+    {
+        for (const EvdevKey& key : k_rgEvdevKeys)
+            ApplyKey(node, key.nCode, TestBit(rgKeyBits, key.nCode));
+
+        if (node.iPad >= 0)
+        {
+            for (const EvdevButton& button : k_rgEvdevButtons)
+                ApplyKey(node, button.nCode, TestBit(rgKeyBits, button.nCode));
+        }
+    }
+
+    if (node.iPad < 0)
+        return;
+
+    static const constexpr uint16_t k_rgResyncAxes[] =
+    {
+        ABS_X, ABS_Y, ABS_RX, ABS_RY, ABS_Z, ABS_RZ, ABS_HAT0X, ABS_HAT0Y
+    };
+
+    for (const uint16_t nCode : k_rgResyncAxes)
+    {
+        input_absinfo info{};
+        if (::ioctl(node.iFile, EVIOCGABS(nCode), &info) >= 0)
+            ApplyAxis(node, nCode, info.value);
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+void CEvdevInputDevice::ApplyKey( const EvdevNode& node, int iCode, bool bDown ) noexcept
+{
+    for (const EvdevKey& key : k_rgEvdevKeys)
+    {
+        if (key.nCode == iCode)
+        {
+            m_stState.stKeyboard.SetKeyState(key.eKey, bDown);
+            return;
+        }
+    }
+
+    if (node.iPad < 0)
+        return;
+
+    PadState& pad = m_stState.rgPads[node.iPad];
+    for (const EvdevButton& button : k_rgEvdevButtons)
+    {
+        if (button.nCode == iCode)
+        {
+            if (bDown)
+                pad.wButtons |= button.wButton;
+            else
+                pad.wButtons &= ~button.wButton;
+            return;
+        }
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+void CEvdevInputDevice::ApplyAxis( const EvdevNode& node, int iCode, int32_t nValue ) noexcept
+{
+    if (node.iPad < 0)
+        return;
+
+    PadState& pad = m_stState.rgPads[node.iPad];
+
+    // most pads report the d-pad as a hat rather than as buttons
+    if (iCode == ABS_HAT0X || iCode == ABS_HAT0Y)
+    {
+        const uint16_t wNeg = (iCode == ABS_HAT0X) ? PAD_DPAD_LEFT  : PAD_DPAD_UP;
+        const uint16_t wPos = (iCode == ABS_HAT0X) ? PAD_DPAD_RIGHT : PAD_DPAD_DOWN;
+
+        pad.wButtons &= ~(wNeg | wPos);
+        if (nValue < 0)
+            pad.wButtons |= wNeg;
+        else if (nValue > 0)
+            pad.wButtons |= wPos;
+        return;
+    }
+
+    size_t iAxis = 0;
+    while (iAxis < k_nEvdevAxes && k_rgEvdevAxes[iAxis] != iCode)
+        iAxis++;
+
+    if (iAxis == k_nEvdevAxes || node.rgMax[iAxis] <= node.rgMin[iAxis])
+        return;
+
+    const double dRange = static_cast<double>(node.rgMax[iAxis]) - node.rgMin[iAxis];
+    double       dUnit  = (static_cast<double>(nValue) - node.rgMin[iAxis]) / dRange;
+    dUnit = (dUnit < 0.0) ? 0.0 : ((dUnit > 1.0) ? 1.0 : dUnit);
+
+    if (iAxis >= 4)
+    {
+        const uint8_t bTrigger = static_cast<uint8_t>(dUnit * 255.0 + 0.5);
+        if (iAxis == 4)
+            pad.bLeftTrigger  = bTrigger;
+        else
+            pad.bRightTrigger = bTrigger;
+        return;
+    }
+
+    // evdev Y grows downward, XInput's upward
+    if (iAxis == 1 || iAxis == 3)
+        dUnit = 1.0 - dUnit;
+
+    const int16_t sValue = static_cast<int16_t>(static_cast<int32_t>(dUnit * 65535.0 + 0.5) - 32768);
+    switch (iAxis)
+    {
+    case 0:  pad.sThumbLX = sValue; break;
+    case 1:  pad.sThumbLY = sValue; break;
+    case 2:  pad.sThumbRX = sValue; break;
+    default: pad.sThumbRY = sValue; break;
+    }
+};
+
+#else
+
+//-----------------------------------------------------------------------------------------------
+bool CEvdevInputDevice::Open( void ) noexcept
+{
+    return false;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CEvdevInputDevice::Close( void ) noexcept
+{
+};
+
+//-----------------------------------------------------------------------------------------------
+bool CEvdevInputDevice::Poll( double, InputSnapshot& ) noexcept
+{
+    return false;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CEvdevInputDevice::Resync( EvdevNode& ) noexcept
+{
+};
+
+//-----------------------------------------------------------------------------------------------
+void CEvdevInputDevice::ApplyKey( const EvdevNode&, int, bool ) noexcept
+{
+};
+
+//-----------------------------------------------------------------------------------------------
+void CEvdevInputDevice::ApplyAxis( const EvdevNode&, int, int32_t ) noexcept
+{
+};
+
+#endif
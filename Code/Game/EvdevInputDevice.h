@@ -0,0 +1,80 @@
+/**
+ *  @file       EvdevInputDevice.h
+ *  @brief      CEvdevInputDevice class interface
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ *  <b>Implementation:</b>
+ *
+ *   Reads Linux input event nodes (/dev/input/eventN) without blocking.
+ *   Key events of every node update one shared keyboard; each node that
+ *   reports gamepad buttons is given the next free pad slot, its buttons,
+ *   hat and axes mapped to the XInput layout (sticks scaled from the
+ *   node's own axis ranges, Y flipped to up positive).
+ *
+ *   The snapshot is kept up to date from the event stream; when the kernel
+ *   reports dropped events, the node's key and axis state is read back in
+ *   full.  Other platforms have no evdev backend; Open() fails there.
+ */
+#pragma once
+
+#if !defined(__EVDEV_INPUT_DEVICE_H__)
+#define __EVDEV_INPUT_DEVICE_H__
+
+#ifndef _STRING_
+    #include <string>
+#endif
+
+#ifndef _VECTOR_
+    #include <vector>
+#endif
+
+#ifndef __INPUT_DEVICE_H__
+    #include "InputDevice.h"
+#endif
+
+constexpr size_t k_nEvdevAxes = 6;      ///< left stick, right stick, both triggers
+
+class CEvdevInputDevice : public IInputDevice
+{
+    struct EvdevNode
+    {
+        int     iFile;                      ///< -1 once the node has gone
+        int     iPad;                       ///< pad slot, -1 for a keyboard only node
+        bool    bDropped;                   ///< events lost, resync at the next report
+        int32_t rgMin[k_nEvdevAxes];
+        int32_t rgMax[k_nEvdevAxes];
+    };
+
+    std::string             m_strPaths;     ///< comma separated node paths
+    std::vector<EvdevNode>  m_rgNodes;
+    InputSnapshot           m_stState;
+
+public:
+/**
+ *  @param [in] szPaths     one or more event nodes, comma separated
+ *
+ *  @note - may throw an exception
+ */
+    explicit CEvdevInputDevice(const char* szPaths);
+    ~CEvdevInputDevice() noexcept;
+
+    bool        Open        ( void ) noexcept override;
+    void        Close       ( void ) noexcept override;
+    bool        Poll        ( double dTime, InputSnapshot& snapshot ) noexcept override;
+    const char* get_Name    ( void ) const noexcept override
+    { return "evdev"; };
+
+private:
+    void        Resync      ( EvdevNode& node ) noexcept;
+    void        ApplyKey    ( const EvdevNode& node, int iCode, bool bDown ) noexcept;
+    void        ApplyAxis   ( const EvdevNode& node, int iCode, int32_t nValue ) noexcept;
+
+    /// Copy constructor
+    CEvdevInputDevice(const CEvdevInputDevice&) = delete;
+    /// Assignment operator
+    CEvdevInputDevice& operator=(const CEvdevInputDevice&) = delete;
+};
+
+#endif
@@ -11,14 +11,16 @@
 #include "targetver.h"  // this needs to be the 1st header include
 #include "CommonDef.h"
 
+#include <cmath>
+
 #include "Engine/Renderer/Renderer.h"
-#include "Engine/Utility/TimeUtils.h"
 #include "Engine/Utility/DebugUtils.h"
+#include "Engine/Utility/Profiler.h"
 
 #include "Asteroid.h"
 #include "Ship.h"
 #include "Projectile.h"
-#include "SoundManager.h"
+#include "SoundEvents.h"
 
 #include "Game.h"
 
@@ -43,15 +45,51 @@ bool IsAsteroid(eng::CActor2* pActor) noexcept
     return (pAst != nullptr);
 };
 
+// circle-versus-circle test on the actors' radii, measured across the
+// wrap seams so actors collide wherever their ghost instances are drawn;
+// unlike CActor2::IntersectsWith() this does not report the box corners
+bool IntersectsWrapped(const eng::CActor2& a, const eng::CActor2& b) noexcept
+{
+    if (!a.IsActive() || !b.IsActive())
+        return false;
+
+    float fDX = std::abs(a.get_CenterX() - b.get_CenterX());
+    float fDY = std::abs(a.get_CenterY() - b.get_CenterY());
+
+    if (fDX > WRAP_WIDTH * 0.5f)
+        fDX = WRAP_WIDTH - fDX;
+    if (fDY > WRAP_HEIGHT * 0.5f)
+        fDY = WRAP_HEIGHT - fDY;
+
+    const float fRange = a.get_Radius() + b.get_Radius();
+    return (fDX * fDX + fDY * fDY < fRange * fRange);
+};
+
 
 //-----------------------------------------------------------------------------------------------
-CGame::CGame( CSoundManager* pSoundManager )
+CGame::CGame( CSoundEvents* pSoundEvents )
     : m_pShip(nullptr),
-      m_pSoundManager(pSoundManager),
+      m_pSoundEvents(pSoundEvents),
       m_nAsteroidWaveSize(INITIAL_ASTEROIDS),
-      m_rgActors()
+      m_rgActors(),
+      m_ViewCuller(eng::CAABB2(eng::math::CVector2f(VIEW_LEFT, VIEW_BOTTOM),
+                               eng::math::CVector2f(VIEW_RIGHT, VIEW_TOP)),
+                   eng::CAABB2(eng::math::CVector2f(WRAP_LEFT, WRAP_BOTTOM),
+                               eng::math::CVector2f(WRAP_RIGHT, WRAP_TOP))),
+      m_AsteroidBatch(),
+      m_rgAsteroidShapes(),
+      m_Particles(k_nMaxParticles, k_fParticlePointSize),
+      m_fExhaustCarry(0.f),
+      m_dGameTime(0.0),
+      m_nScore(0),
+      m_ScoreHud()
 {
     m_rgActors.reserve(MAX_ACTORS);
+
+    InitAsteroidShapes();
+
+    if (!m_ScoreHud.Initialize())
+        eng::util::DebugTrace(_T("Score HUD unavailable, no digit texture and the atlas build failed \n"));
 }
 
 //-----------------------------------------------------------------------------------------------
@@ -64,45 +102,116 @@ CGame::~CGame()
     }
 }
 
+//-----------------------------------------------------------------------------------------------
+void CGame::ReleaseRenderResources( void ) noexcept
+{
+    m_ScoreHud.Release();
+};
+
 //-----------------------------------------------------------------------------------------------
 void CGame::Render( void ) const
 {
     eng::g_theRdr.SetClearColor(eng::RGBA_BLACK);
     eng::g_theRdr.ClearColorBuffer();
 
+    // particles go down first so actor outlines stay on top
+    m_Particles.Render();
+
+    m_ViewCuller.BeginFrame();
+    m_AsteroidBatch.Begin();
+
     for ( auto pActor : m_rgActors )
     {
-        if (pActor)
-            pActor->Render();
+        if (pActor && pActor->IsActive())
+        {
+            eng::math::CVector2f rgOffsets[eng::rdr::k_nMaxViewInstances];
+            size_t nInstances = m_ViewCuller.Classify(pActor->get_Center(),
+                                                      pActor->get_Radius() * k_fCullRadiusScale,
+                                                      rgOffsets);
+
+            // asteroids all share a handful of outlines; collect them and
+            // draw each outline's instances (ghosts included) in one call
+            const CAsteroid* pAsteroid = dynamic_cast<const CAsteroid*>(pActor);
+            if (pAsteroid)
+            {
+                for (size_t i = 0; i < nInstances; i++)
+                {
+                    eng::ShapeInstance instance = pAsteroid->get_ShapeInstance();
+                    instance.fX += rgOffsets[i].X;
+                    instance.fY += rgOffsets[i].Y;
+                    m_AsteroidBatch.Draw(pAsteroid->get_Shape(), instance); // note - may throw an exception
+                }
+                continue;
+            }
+
+            for (size_t i = 0; i < nInstances; i++)
+            {
+                if (rgOffsets[i].X == 0.f && rgOffsets[i].Y == 0.f)
+                {
+                    pActor->Render();
+                }
+                else
+                {
+                    // draw a ghost instance on the far side of the seam
+                    eng::g_theRdr.PushView();
+                    eng::g_theRdr.TranslateView(rgOffsets[i]);
+                    pActor->Render();
+                    eng::g_theRdr.PopView();
+                }
+            }
+        }
+    }
+
+    eng::g_theRdr.SetLineWidth(k_fAsteroidLineWidth);
+    m_AsteroidBatch.End();
+
+    m_ScoreHud.Render(m_nScore);
+
+#ifdef _DEBUG
+    static size_t s_nLastDrawn  = 0;
+    static size_t s_nLastCulled = 0;
+
+    const eng::rdr::CullStats& stats = m_ViewCuller.get_Stats();
+    if (stats.nDrawn != s_nLastDrawn || stats.nCulled != s_nLastCulled)
+    {
+        eng::util::DebugTrace(_T("Render: %zu drawn, %zu culled, %zu ghosts \n"),
+                              stats.nDrawn, stats.nCulled, stats.nGhosts);
+        s_nLastDrawn  = stats.nDrawn;
+        s_nLastCulled = stats.nCulled;
     }
+#endif
 };
 
 //-----------------------------------------------------------------------------------------------
 void CGame::Update( float fDeltaTime )
 {
+    m_dGameTime += fDeltaTime;
+
     for ( auto pActor : m_rgActors )
     {
         if (pActor)
         {
             pActor->Update(fDeltaTime);
 
-            // Brute-force screen wrap implementation
-            if (pActor->get_CenterX() < -OFFSET_FROM_WINDOWS_DESKTOP)
-                pActor->set_CenterX( static_cast<float>(VIEW_RIGHT + OFFSET_FROM_WINDOWS_DESKTOP) );
-            if (pActor->get_CenterX() > VIEW_RIGHT + OFFSET_FROM_WINDOWS_DESKTOP)
-                pActor->set_CenterX( static_cast<float>(-OFFSET_FROM_WINDOWS_DESKTOP) );
+            // Toroidal wrap a margin beyond the screen; actors straddling a
+            // seam are drawn on both sides by the view culler's ghost
+            // instances in Render(), and collide there too
+            if (pActor->get_CenterX() < WRAP_LEFT)
+                pActor->set_CenterX( pActor->get_CenterX() + WRAP_WIDTH );
+            else if (pActor->get_CenterX() >= WRAP_RIGHT)
+                pActor->set_CenterX( pActor->get_CenterX() - WRAP_WIDTH );
 
-            if (pActor->get_CenterY() < -OFFSET_FROM_WINDOWS_DESKTOP)
-                pActor->set_CenterY( static_cast<float>(VIEW_TOP + OFFSET_FROM_WINDOWS_DESKTOP) );
-            if (pActor->get_CenterY() > VIEW_TOP + OFFSET_FROM_WINDOWS_DESKTOP)
-                pActor->set_CenterY( static_cast<float>(-OFFSET_FROM_WINDOWS_DESKTOP) );
+            if (pActor->get_CenterY() < WRAP_BOTTOM)
+                pActor->set_CenterY( pActor->get_CenterY() + WRAP_HEIGHT );
+            else if (pActor->get_CenterY() >= WRAP_TOP)
+                pActor->set_CenterY( pActor->get_CenterY() - WRAP_HEIGHT );
 
             // using dynamic_cast for now
             CProjectile* pProj = dynamic_cast<CProjectile*>(pActor);
 
             if (pProj)
             {
-                if (eng::util::GetCurrentTimeInSeconds() - pProj->get_SpawnTime() >= 2.0)
+                if (m_dGameTime - pProj->get_SpawnTime() >= 2.0)
                 {
                     pProj->set_Active(false); // mark for deletion
                 }
@@ -110,6 +219,9 @@ void CGame::Update( float fDeltaTime )
         }
     }
 
+    EmitExhaust(fDeltaTime);
+    m_Particles.Update(fDeltaTime);
+
     std::vector<std::pair<eng::CActor2*, eng::CActor2*> > rgCollisions;
 
     if ( CheckForCollisions( rgCollisions ) ) // if we find collisions, resolve them
@@ -128,6 +240,8 @@ void CGame::Update( float fDeltaTime )
 //-----------------------------------------------------------------------------------------------
 bool CGame::CheckForCollisions( std::vector<std::pair<eng::CActor2*, eng::CActor2*> >& rgCollisionsFound ) const
 {
+    PROFILE_SCOPE("CheckForCollisions");
+
     bool bResult = false;
     for ( auto pActor1 : m_rgActors )
     {
@@ -139,7 +253,7 @@ bool CGame::CheckForCollisions( std::vector<std::pair<eng::CActor2*, eng::CActor
                 {
                     if ( IsAsteroid(pActor2) )
                     {
-                        if (pActor1->IntersectsWith(*pActor2))
+                        if (IntersectsWrapped(*pActor1, *pActor2))
                         {
                             rgCollisionsFound.push_back(std::make_pair(pActor1, pActor2)); // note - may throw an exception
                             bResult = true;
@@ -156,6 +270,8 @@ bool CGame::CheckForCollisions( std::vector<std::pair<eng::CActor2*, eng::CActor
 //-----------------------------------------------------------------------------------------------
 void CGame::ResolveCollisions( const std::vector<std::pair<eng::CActor2*, eng::CActor2*> >& rgCollisions )
 {
+    PROFILE_SCOPE("ResolveCollisions");
+
 #ifdef _DEBUG
     eng::util::DebugTrace(_T("%d Collisions Found \n"), rgCollisions.size() );
 #endif
@@ -165,24 +281,45 @@ void CGame::ResolveCollisions( const std::vector<std::pair<eng::CActor2*, eng::C
         pairActors.first->set_Active(false);
         pairActors.second->set_Active(false);
 
+        const eng::math::CVector2f vCollision = (pairActors.first->get_Center() + pairActors.second->get_Center()) * 0.5f;
+
         // if the ship is about to die, we need to clear the
         // class pointer now.
         CShip* pShip = dynamic_cast<CShip*>(pairActors.first);
 
         if (pShip)
         {
+            EmitExplosion(*pShip, k_nShipExplosionParticles, eng::RGBA_CYAN);
             m_pShip = nullptr;
-            m_pSoundManager->Play(SND_EXPLOSION);
+            // the engine rumble is a held level only CShip::Update() releases
+            m_pSoundEvents->Release(SND_ENGINE);
+            m_pSoundEvents->Trigger(SND_EXPLOSION, vCollision);
         }
         else
         {
-            // must be a missile.
-            m_pSoundManager->Play(SND_MISSILE_HIT);
+            // must be a missile; a breaking wave merges these into one voice
+            m_pSoundEvents->Trigger(SND_MISSILE_HIT, vCollision);
         }
 
         CAsteroid* pAsteroid = dynamic_cast<CAsteroid*>(pairActors.second);
         if (pAsteroid)
         {
+            switch (pAsteroid->get_Type())
+            {
+            case AST_LARGE:
+                EmitExplosion(*pAsteroid, k_nAsteroidExplosionLarge, eng::RGBA_WHITE);
+                m_nScore += k_nScoreLargeAsteroid;
+                break;
+            case AST_MEDIUM:
+                EmitExplosion(*pAsteroid, k_nAsteroidExplosionMedium, eng::RGBA_WHITE);
+                m_nScore += k_nScoreMediumAsteroid;
+                break;
+            default:
+                EmitExplosion(*pAsteroid, k_nAsteroidExplosionSmall, eng::RGBA_WHITE);
+                m_nScore += k_nScoreSmallAsteroid;
+                break;
+            }
+
             if (pAsteroid->get_Type() == AST_LARGE)
             {
                 eng::math::CVector2f vVelocity = pAsteroid->get_Velocity();
@@ -214,6 +351,8 @@ void CGame::ResolveCollisions( const std::vector<std::pair<eng::CActor2*, eng::C
 //-----------------------------------------------------------------------------------------------
 bool CGame::DestroyInactiveActors(void)
 {
+    PROFILE_SCOPE("DestroyInactiveActors");
+
     bool bReturn = false;
     if (m_rgActors.size() > 0)
     {
@@ -236,6 +375,58 @@ bool CGame::DestroyInactiveActors(void)
     return bReturn;
 };
 
+//-----------------------------------------------------------------------------------------------
+void CGame::EmitExhaust( float fDeltaTime ) noexcept
+{
+    if (m_pShip == nullptr || !m_pShip->IsActive() || !m_pShip->IsThrusting())
+    {
+        m_fExhaustCarry = 0.f;
+        return;
+    }
+
+    // emit at a fixed rate independent of the frame rate
+    m_fExhaustCarry += k_fExhaustParticlesPerSecond * fDeltaTime;
+    const size_t nParticles = static_cast<size_t>(m_fExhaustCarry);
+    m_fExhaustCarry -= static_cast<float>(nParticles);
+
+    if (nParticles)
+    {
+        const DEGREES degOrientation = m_pShip->get_Orientation();
+        const eng::math::CVector2f vForward(eng::math::CalcXComponent(degOrientation),
+                                            eng::math::CalcYComponent(degOrientation));
+
+        eng::ParticleBurst burst;
+        burst.vOrigin       = m_pShip->get_Center() - (vForward * 12.5f); // rear of the hull
+        burst.vBaseVelocity = m_pShip->get_Velocity();
+        burst.fDegDirection = degOrientation + 180.f;
+        burst.fDegSpread    = k_fExhaustSpread;
+        burst.fSpeedMin     = k_fExhaustSpeedMin;
+        burst.fSpeedMax     = k_fExhaustSpeedMax;
+        burst.fLifeMin      = k_fExhaustLifeMin;
+        burst.fLifeMax      = k_fExhaustLifeMax;
+        burst.clr           = eng::RGBA_RED;
+
+        m_Particles.Emit(burst, nParticles);
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+void CGame::EmitExplosion( const eng::CActor2& actor, size_t nParticles, const eng::ColorRGBA& clr ) noexcept
+{
+    eng::ParticleBurst burst;
+    burst.vOrigin       = actor.get_Center();
+    burst.vBaseVelocity = actor.get_Velocity();
+    burst.fDegDirection = 0.f;
+    burst.fDegSpread    = 360.f;
+    burst.fSpeedMin     = 20.f;
+    burst.fSpeedMax     = actor.get_Radius() * 6.f;
+    burst.fLifeMin      = 0.4f;
+    burst.fLifeMax      = 1.2f;
+    burst.clr           = clr;
+
+    m_Particles.Emit(burst, nParticles);
+};
+
 //-----------------------------------------------------------------------------------------------
 void CGame::InitActors( void )
 {
@@ -260,6 +451,29 @@ void CGame::SpawnShip( void )
     }
 };
 
+//-----------------------------------------------------------------------------------------------
+void CGame::InitAsteroidShapes( void )
+{
+    std::vector<eng::math::CVector2f> rgOutline;
+
+    m_rgAsteroidShapes.reserve(k_nAsteroidShapeVariants); // note - may throw an exception
+    for (size_t i = 0; i < k_nAsteroidShapeVariants; i++)
+    {
+        CAsteroid::GenerateIrregularOutline(ASTEROID_VERTICES, rgOutline);
+        m_rgAsteroidShapes.push_back(eng::g_theRdr.RegisterShape(rgOutline.data(), rgOutline.size()));
+    }
+}
+
+//-----------------------------------------------------------------------------------------------
+size_t CGame::PickAsteroidShape( void ) const noexcept
+{
+    if (m_rgAsteroidShapes.empty())
+        return 0;
+
+    const size_t nVariant = static_cast<size_t>( eng::math::RangedRand(0.f, static_cast<float>(m_rgAsteroidShapes.size())) );
+    return m_rgAsteroidShapes[ std::min(nVariant, m_rgAsteroidShapes.size() - 1) ];
+}
+
 //-----------------------------------------------------------------------------------------------
 void CGame::SpawnAsteroidWave( void )
 {
@@ -277,7 +491,8 @@ bool CGame::SpawnLargeAsteroid(void)
     bool bReturn = false;
     if (m_rgActors.size() < MAX_ACTORS) // make sure we have room
     {
-        eng::math::CVector2f vCenter(-OFFSET_FROM_WINDOWS_DESKTOP,
+        // spawn on the left/right seam so the asteroid slides into view on both sides
+        eng::math::CVector2f vCenter(VIEW_LEFT,
                                      eng::math::RangedRand(static_cast<float>( OFFSET_FROM_WINDOWS_DESKTOP + 1 ),
                                      static_cast<float>( VIEW_TOP - OFFSET_FROM_WINDOWS_DESKTOP - 1 )));
 
@@ -290,7 +505,7 @@ bool CGame::SpawnLargeAsteroid(void)
         CLargeAsteroid* pLargeAsteroid = new CLargeAsteroid(vCenter, vVelocity, fAngularVelocity);
         if (pLargeAsteroid)
         {
-            pLargeAsteroid->InitIrregularAsteroid(ASTEROID_VERTICES);
+            pLargeAsteroid->set_Shape(PickAsteroidShape());
 
             m_rgActors.push_back(pLargeAsteroid); // note - may throw an exception
             bReturn = true;
@@ -309,7 +524,7 @@ bool CGame::SpawnMediumAsteroid(const eng::math::CVector2f& vCenter, const eng::
         CMediumAsteroid* pMediumAsteroid = new CMediumAsteroid(vCenter, vVelocity, fAngularVelocity);
         if (pMediumAsteroid)
         {
-            pMediumAsteroid->InitIrregularAsteroid(ASTEROID_VERTICES);
+            pMediumAsteroid->set_Shape(PickAsteroidShape());
 
             m_rgActors.push_back(pMediumAsteroid); // note - may throw an exception
             bReturn = true;
@@ -328,7 +543,7 @@ bool CGame::SpawnSmallAsteroid(const eng::math::CVector2f& vCenter, const eng::m
         CSmallAsteroid* pSmallAsteroid = new CSmallAsteroid(vCenter, vVelocity, fAngularVelocity);
         if (pSmallAsteroid)
         {
-            pSmallAsteroid->InitIrregularAsteroid(ASTEROID_VERTICES);
+            pSmallAsteroid->set_Shape(PickAsteroidShape());
 
             m_rgActors.push_back(pSmallAsteroid); // note - may throw an exception
             bReturn = true;
@@ -366,12 +581,13 @@ bool CGame::FireProjectile(void)
 
             CProjectile* pProj = new CProjectile(vProjCenter,
                                                  vVelocity,
-                                                 static_cast<float>( eng::util::GetCurrentTimeInSeconds() ));
+                                                 static_cast<float>( m_dGameTime ));
 
 
             if (pProj)
             {
                 m_rgActors.push_back(pProj); // note - may throw an exception
+                m_pSoundEvents->Trigger(SND_MISSILE_FIRE, vProjCenter);
                 bReturn = true;
             }
         }
@@ -21,6 +21,22 @@
     #include "Engine/Math/Vector2.h"
 #endif
 
+#ifndef __PARTICLE_SYSTEM_H__
+    #include "Engine/Core/ParticleSystem.h"
+#endif
+
+#ifndef __VIEW_CULLER_H__
+    #include "Engine/Renderer/ViewCuller.h"
+#endif
+
+#ifndef __SHAPE_BATCH_H__
+    #include "Engine/Renderer/ShapeBatch.h"
+#endif
+
+#ifndef __SCORE_HUD_H__
+    #include "ScoreHud.h"
+#endif
+
 // forward declaration
 namespace eng
 {
@@ -28,18 +44,26 @@ class CActor2;
 }
 
 class CShip;
-class CSoundManager;
+class CSoundEvents;
 
 class CGame
 {
     CShip*                           m_pShip;
-    CSoundManager*                   m_pSoundManager;
+    CSoundEvents*                    m_pSoundEvents;
     size_t                           m_nAsteroidWaveSize;
     std::vector<eng::CActor2*>       m_rgActors;
+    mutable eng::rdr::CViewCuller    m_ViewCuller;
+    mutable eng::rdr::CShapeBatch    m_AsteroidBatch;
+    std::vector<size_t>              m_rgAsteroidShapes;  ///< registered outline variants
+    eng::CParticleSystem             m_Particles;
+    float                            m_fExhaustCarry;   ///< fractional exhaust particles owed from last frame
+    double                           m_dGameTime;       ///< sum of Update() deltas, replays identically
+    uint32_t                         m_nScore;
+    mutable CScoreHud                m_ScoreHud;
 
 public:
     /// Initialization constructor
-    CGame( CSoundManager* pSndManager );
+    CGame( CSoundEvents* pSoundEvents );
     /// Default destructor
     ~CGame() noexcept;
 
@@ -54,11 +78,31 @@ public:
     bool FireProjectile         ( void );
     bool DestroyRandomAsteroid  ( void );
 
+/**
+ *  @brief deletes the game's GPU resources while their context is current
+ */
+    void ReleaseRenderResources ( void ) noexcept;
+
+    constexpr uint32_t get_Score ( void ) const noexcept
+    { return m_nScore; };
+
+/**
+ *  @brief retrieves the drawn / culled / ghost counts of the last rendered frame
+ */
+    constexpr const eng::rdr::CullStats& get_RenderStats ( void ) const noexcept
+    { return m_ViewCuller.get_Stats(); };
+
 private:
     bool CheckForCollisions     ( std::vector<std::pair<eng::CActor2*, eng::CActor2*> >& rgCollisions ) const;
     void ResolveCollisions      ( const std::vector<std::pair<eng::CActor2*, eng::CActor2*> >& rgCollisions );
     bool DestroyInactiveActors  ( void );
 
+    void InitAsteroidShapes     ( void );
+    size_t PickAsteroidShape    ( void ) const noexcept;
+
+    void EmitExhaust            ( float fDeltaTime ) noexcept;
+    void EmitExplosion          ( const eng::CActor2& actor, size_t nParticles, const eng::ColorRGBA& clr ) noexcept;
+
     bool SpawnMediumAsteroid    ( const eng::math::CVector2f& vCenter, const eng::math::CVector2f& vVelocity, float fAngularVelocity );
     bool SpawnSmallAsteroid     ( const eng::math::CVector2f& vCenter, const eng::math::CVector2f& vVelocity, float fAngularVelocity );
 
@@ -0,0 +1,74 @@
+/**
+ *  @file       InputDevice.cpp
+ *  @brief      input device factory
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ */
+
+#include "targetver.h"  // this needs to be the 1st header included
+
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+
+#include "EvdevInputDevice.h"
+#include "ScriptedInputDevice.h"
+#include "Win32InputDevice.h"
+
+constexpr uint32_t k_nDefaultScriptSeed = 1;
+
+//-----------------------------------------------------------------------------------------------
+static bool IsAllDigits(const char* sz) noexcept
+{
+    if (*sz == '\0')
+        return false;
+
+    for (; *sz; sz++)
+    {
+        if (!isdigit(static_cast<unsigned char>(*sz)))
+            return false;
+    }
+    return true;
+};
+
+//-----------------------------------------------------------------------------------------------
+IInputDevice* CreateInputDevice(const char* szSpec) noexcept
+{
+    IInputDevice* pDevice = nullptr;
+
+    if (szSpec == nullptr || szSpec[0] == '\0')
+        return nullptr;
+
+    try
+    {
+        if (strcmp(szSpec, "win32") == 0)
+        {
+            pDevice = new CWin32InputDevice();
+        }
+        else if (strncmp(szSpec, "evdev:", 6) == 0)
+        {
+            pDevice = new CEvdevInputDevice(szSpec + 6);
+        }
+        else if (strcmp(szSpec, "script") == 0)
+        {
+            pDevice = new CScriptedInputDevice(nullptr, k_nDefaultScriptSeed);
+        }
+        else if (strncmp(szSpec, "script:", 7) == 0)
+        {
+            // a number seeds the generated pattern, anything else is a script file
+            const char* szArg = szSpec + 7;
+            if (IsAllDigits(szArg))
+                pDevice = new CScriptedInputDevice(nullptr, static_cast<uint32_t>( strtoul(szArg, nullptr, 10) ));
+            else
+                pDevice = new CScriptedInputDevice(szArg, k_nDefaultScriptSeed);
+        }
+    }
+    catch (...)
+    {
+        pDevice = nullptr;
+    }
+
+    return pDevice;
+};
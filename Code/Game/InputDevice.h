@@ -0,0 +1,119 @@
+/**
+ *  @file       InputDevice.h
+ *  @brief      IInputDevice interface and the input snapshot it fills
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ *  <b>Implementation:</b>
+ *
+ *   An input device produces a complete keyboard and gamepad snapshot on
+ *   each Poll(), with no Win32 or XInput types in the interface, so the
+ *   game's input path (CActionMap, CShip) can be fed from any of:
+ *
+ *    - CWin32InputDevice: the async key state and XInput, polled.
+ *    - CEvdevInputDevice: Linux /dev/input/event* keyboards and pads.
+ *    - CScriptedInputDevice: a deterministic pattern, generated from a
+ *      seed or read from a script file, for soak and perf runs that need
+ *      no one at the keyboard.
+ *
+ *   Keys are the Windows virtual key codes of KeyboardState and PadState
+ *   mirrors XINPUT_GAMEPAD, button bits included, so a snapshot installs
+ *   into CKeyboard and CXboxController unchanged.
+ */
+#pragma once
+
+#if !defined(__INPUT_DEVICE_H__)
+#define __INPUT_DEVICE_H__
+
+#ifndef _CSTDDEF_
+    #include <cstddef>
+#endif
+
+#ifndef _CSTDINT_
+    #include <cstdint>
+#endif
+
+#ifndef __KEYBOARD_STATE_H__
+    #include "KeyboardState.h"
+#endif
+
+constexpr size_t k_nMaxInputPads = 4;
+
+/**
+ * @brief gamepad buttons, the XINPUT_GAMEPAD_* bit values
+ */
+enum PAD_BUTTON_T : uint16_t
+{
+    PAD_DPAD_UP        = 0x0001,
+    PAD_DPAD_DOWN      = 0x0002,
+    PAD_DPAD_LEFT      = 0x0004,
+    PAD_DPAD_RIGHT     = 0x0008,
+    PAD_START          = 0x0010,
+    PAD_BACK           = 0x0020,
+    PAD_LEFT_THUMB     = 0x0040,
+    PAD_RIGHT_THUMB    = 0x0080,
+    PAD_LEFT_SHOULDER  = 0x0100,
+    PAD_RIGHT_SHOULDER = 0x0200,
+    PAD_A              = 0x1000,
+    PAD_B              = 0x2000,
+    PAD_X              = 0x4000,
+    PAD_Y              = 0x8000
+};
+
+/**
+ * @brief one gamepad, laid out like XINPUT_GAMEPAD
+ */
+struct PadState
+{
+    uint16_t wButtons;          ///< PAD_BUTTON_T flags
+    uint8_t  bLeftTrigger;      ///< 0 .. 255
+    uint8_t  bRightTrigger;
+    int16_t  sThumbLX;          ///< -32768 .. 32767, up and right positive
+    int16_t  sThumbLY;
+    int16_t  sThumbRX;
+    int16_t  sThumbRY;
+};
+
+/**
+ * @brief everything a device reports for one poll
+ */
+struct InputSnapshot
+{
+    KeyboardState stKeyboard;
+    PadState      rgPads[k_nMaxInputPads];
+    uint32_t      nConnectedPads;       ///< bit i set while pad i is present
+};
+
+class __declspec(novtable) IInputDevice
+{
+public:
+    virtual ~IInputDevice() = default;
+
+/**
+ *  @retval false    if the device is not available on this platform or machine
+ */
+    virtual bool        Open        ( void ) noexcept = 0;
+    virtual void        Close       ( void ) noexcept = 0;
+/**
+ *  @param [in]  dTime      game time in seconds; scripted input is a function of it
+ *  @param [out] snapshot   the full state, not a delta
+ *
+ *  @retval false    the device is gone or the script has ended
+ */
+    virtual bool        Poll        ( double dTime, InputSnapshot& snapshot ) noexcept = 0;
+    virtual const char* get_Name    ( void ) const noexcept = 0;
+};
+
+/**
+ *  @brief creates a device from a command line spec
+ *
+ *  @param [in] szSpec   "win32", "evdev:<dev>[,<dev>...]", "script",
+ *                       "script:<seed>" or "script:<file>"
+ *
+ *  @retval IInputDevice*  owned by the caller, not yet opened
+ *  @retval nullptr        on error
+ */
+IInputDevice* CreateInputDevice(const char* szSpec) noexcept;
+
+#endif
@@ -0,0 +1,290 @@
+/**
+ *  @file       InputRecorder.cpp
+ *  @brief      CInputRecorder class implementation
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ */
+
+#define _CRT_SECURE_NO_WARNINGS
+#define WIN32_LEAN_AND_MEAN
+#include "targetver.h"  // this needs to be the 1st header included
+
+#include <Windows.h>
+#include <cstring>
+
+#include "InputRecorder.h"
+
+constexpr size_t  k_nKeyboardWords = sizeof(KeyboardState) / sizeof(uint32_t);
+
+constexpr uint8_t k_nTickKeyboard  = 0x01;  ///< flags bit, a keyboard delta follows
+constexpr uint8_t k_nTickPadShift  = 1;     ///< flags bit of controller 0
+
+static_assert(sizeof(KeyboardState) == 32,   "a keyboard delta mask is one byte of 32-bit words");
+static_assert(sizeof(XINPUT_GAMEPAD) == 12,  "controller snapshots are written as is");
+static_assert(k_nMaxRecordedPads + k_nTickPadShift <= 8, "tick flags are one byte");
+
+//-----------------------------------------------------------------------------------------------
+/// header, in file order
+struct InputRecordHeader
+{
+    uint32_t nMagic;
+    uint16_t nVersion;
+    uint16_t nPads;
+    uint32_t nSeed;
+};
+
+//-----------------------------------------------------------------------------------------------
+static inline bool WriteBytes( FILE* pFile, const void* pData, size_t cbData ) noexcept
+{
+    return fwrite(pData, 1, cbData, pFile) == cbData;
+};
+
+//-----------------------------------------------------------------------------------------------
+static inline bool ReadBytes( FILE* pFile, void* pData, size_t cbData ) noexcept
+{
+    return fread(pData, 1, cbData, pFile) == cbData;
+};
+
+//-----------------------------------------------------------------------------------------------
+CInputRecorder::CInputRecorder() noexcept
+    : m_pFile(nullptr),
+      m_eMode(InputRecordMode::None),
+      m_nSeed(0),
+      m_nTicks(0),
+      m_nPads(0),
+      m_stKeyboard(),
+      m_rgPads{},
+      m_rgConnected{}
+{
+};
+
+//-----------------------------------------------------------------------------------------------
+CInputRecorder::~CInputRecorder() noexcept
+{
+    Close();
+};
+
+//-----------------------------------------------------------------------------------------------
+bool CInputRecorder::StartRecording( const char* szFileName, uint32_t nSeed, size_t nControllers ) noexcept
+{
+    Close();
+
+    if (szFileName == nullptr || *szFileName == '\0')
+        return false;
+
+    m_pFile = fopen(szFileName, "wb");
+    if (m_pFile == nullptr)
+        return false;
+
+    m_nSeed  = nSeed;
+    m_nPads  = static_cast<uint16_t>( (nControllers < k_nMaxRecordedPads) ? nControllers : k_nMaxRecordedPads );
+
+    const InputRecordHeader header = { k_nInputRecordMagic, k_nInputRecordVersion, m_nPads, m_nSeed };
+    if (!WriteBytes(m_pFile, &header, sizeof(header)))
+    {
+        Close();
+        return false;
+    }
+
+    m_eMode = InputRecordMode::Record;
+    return true;
+};
+
+//-----------------------------------------------------------------------------------------------
+bool CInputRecorder::StartReplay( const char* szFileName ) noexcept
+{
+    Close();
+
+    if (szFileName == nullptr || *szFileName == '\0')
+        return false;
+
+    m_pFile = fopen(szFileName, "rb");
+    if (m_pFile == nullptr)
+        return false;
+
+    InputRecordHeader header = { 0 };
+    if (!ReadBytes(m_pFile, &header, sizeof(header)) ||
+        header.nMagic != k_nInputRecordMagic || header.nVersion != k_nInputRecordVersion ||
+        header.nPads > k_nMaxRecordedPads)
+    {
+        Close();
+        return false;
+    }
+
+    m_nSeed = header.nSeed;
+    m_nPads = header.nPads;
+    m_eMode = InputRecordMode::Replay;
+    return true;
+};
+
+//-----------------------------------------------------------------------------------------------
+bool CInputRecorder::MeasureReplay( const char* szFileName, uint32_t& nTicks, double& dSeconds ) noexcept
+{
+    nTicks   = 0;
+    dSeconds = 0.0;
+
+    CInputRecorder recorder;
+    if (!recorder.StartReplay( szFileName ))
+        return false;
+
+    float         fDeltaTime = 0.f;
+    KeyboardState stKeyboard;
+    while (recorder.ReplayTick( fDeltaTime, stKeyboard, nullptr, 0 ))
+        dSeconds += fDeltaTime;
+
+    nTicks = recorder.get_Ticks();
+    return true;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CInputRecorder::Close( void ) noexcept
+{
+    if (m_pFile)
+    {
+        fclose(m_pFile);
+        m_pFile = nullptr;
+    }
+
+    // the ticks counted stay readable after the session
+    m_eMode      = InputRecordMode::None;
+    m_stKeyboard = KeyboardState();
+    memset(m_rgPads, 0, sizeof(m_rgPads));
+    memset(m_rgConnected, 0, sizeof(m_rgConnected));
+};
+
+//-----------------------------------------------------------------------------------------------
+bool CInputRecorder::RecordTick( float fDeltaTime, const KeyboardState& stKeyboard,
+                                 const CXboxController* rgControllers, size_t nControllers ) noexcept
+{
+    if (!IsRecording())
+        return false;
+
+    uint8_t  rgTick[sizeof(float) + 2 + sizeof(KeyboardState) + k_nMaxRecordedPads * (1 + sizeof(XINPUT_GAMEPAD))];
+    size_t   cbTick  = sizeof(float) + 1;
+    uint8_t  nFlags  = 0;
+
+    memcpy(rgTick, &fDeltaTime, sizeof(float));
+
+    // KeyboardState is byte aligned, compare it as words through copies
+    uint32_t rgCurr[k_nKeyboardWords];
+    uint32_t rgLast[k_nKeyboardWords];
+    memcpy(rgCurr, &stKeyboard, sizeof(rgCurr));
+    memcpy(rgLast, &m_stKeyboard, sizeof(rgLast));
+
+    uint8_t nWordMask = 0;
+    for (size_t j = 0; j < k_nKeyboardWords; j++)
+    {
+        if (rgCurr[j] != rgLast[j])
+            nWordMask |= static_cast<uint8_t>( 1u << j );
+    }
+
+    if (nWordMask)
+    {
+        nFlags |= k_nTickKeyboard;
+        rgTick[cbTick++] = nWordMask;
+        for (size_t j = 0; j < k_nKeyboardWords; j++)
+        {
+            if (nWordMask & (1u << j))
+            {
+                memcpy(&rgTick[cbTick], &rgCurr[j], sizeof(uint32_t));
+                cbTick += sizeof(uint32_t);
+            }
+        }
+        m_stKeyboard = stKeyboard;
+    }
+
+    const size_t nPads = (nControllers < m_nPads) ? nControllers : m_nPads;
+    for (size_t i = 0; i < nPads; i++)
+    {
+        const bool            bConnected = rgControllers[i].IsConnected();
+        const XINPUT_GAMEPAD& pad        = rgControllers[i].get_State().Gamepad;
+
+        if (bConnected == m_rgConnected[i] && memcmp(&pad, &m_rgPads[i], sizeof(pad)) == 0)
+            continue;
+
+        nFlags |= static_cast<uint8_t>( 1u << (i + k_nTickPadShift) );
+        rgTick[cbTick++] = bConnected ? 1 : 0;
+        memcpy(&rgTick[cbTick], &pad, sizeof(pad));
+        cbTick += sizeof(pad);
+
+        m_rgConnected[i] = bConnected;
+        m_rgPads[i]      = pad;
+    }
+
+    rgTick[sizeof(float)] = nFlags;
+
+    if (!WriteBytes(m_pFile, rgTick, cbTick))
+    {
+        Close();
+        return false;
+    }
+
+    m_nTicks++;
+    return true;
+};
+
+//-----------------------------------------------------------------------------------------------
+bool CInputRecorder::ReplayTick( float& fDeltaTime, KeyboardState& stKeyboard,
+                                 CXboxController* rgControllers, size_t nControllers ) noexcept
+{
+    if (!IsReplaying())
+        return false;
+
+    // decode into copies so a truncated last tick changes nothing
+    uint32_t       rgWords[k_nKeyboardWords];
+    XINPUT_GAMEPAD rgPads[k_nMaxRecordedPads];
+    bool           rgConnected[k_nMaxRecordedPads];
+    memcpy(rgWords, &m_stKeyboard, sizeof(rgWords));
+    memcpy(rgPads, m_rgPads, sizeof(rgPads));
+    memcpy(rgConnected, m_rgConnected, sizeof(rgConnected));
+
+    float   fDelta = 0.f;
+    uint8_t nFlags = 0;
+    if (!ReadBytes(m_pFile, &fDelta, sizeof(fDelta)) || !ReadBytes(m_pFile, &nFlags, 1))
+        return false;
+
+    if (nFlags & k_nTickKeyboard)
+    {
+        uint8_t nWordMask = 0;
+        if (!ReadBytes(m_pFile, &nWordMask, 1))
+            return false;
+
+        for (size_t j = 0; j < k_nKeyboardWords; j++)
+        {
+            if ((nWordMask & (1u << j)) && !ReadBytes(m_pFile, &rgWords[j], sizeof(uint32_t)))
+                return false;
+        }
+    }
+
+    for (size_t i = 0; i < m_nPads; i++)
+    {
+        if ((nFlags & (1u << (i + k_nTickPadShift))) == 0)
+            continue;
+
+        uint8_t nConnected = 0;
+        if (!ReadBytes(m_pFile, &nConnected, 1) || !ReadBytes(m_pFile, &rgPads[i], sizeof(XINPUT_GAMEPAD)))
+            return false;
+        rgConnected[i] = (nConnected != 0);
+    }
+
+    memcpy(&m_stKeyboard, rgWords, sizeof(m_stKeyboard));
+    memcpy(m_rgPads, rgPads, sizeof(m_rgPads));
+    memcpy(m_rgConnected, rgConnected, sizeof(m_rgConnected));
+    m_nTicks++;
+
+    fDeltaTime = fDelta;
+    stKeyboard = m_stKeyboard;
+
+    for (size_t i = 0; i < nControllers; i++)
+    {
+        XINPUT_STATE state = { 0 };
+        state.dwPacketNumber = m_nTicks;
+        if (i < m_nPads)
+            state.Gamepad = m_rgPads[i];
+
+        rgControllers[i].SetControllerState(state, i < m_nPads && m_rgConnected[i]);
+    }
+    return true;
+};
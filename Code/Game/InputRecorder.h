@@ -0,0 +1,137 @@
+/**
+ *  @file       InputRecorder.h
+ *  @brief      CInputRecorder class interface
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ *  <b>Implementation:</b>
+ *
+ *   Records everything a game tick reads from the player, so a session can
+ *   be played back bit for bit: the rand() seed once in the header, then
+ *   per tick the frame's delta time, the keyboard state and the polled
+ *   (dead zone applied) controller states.
+ *
+ *   Only what changed is written.  A tick is its delta time and a flags
+ *   byte; the flags say whether a keyboard delta follows (a byte of changed
+ *   32-bit words, then those words) and which controllers follow as a
+ *   connected byte and an XINPUT_GAMEPAD snapshot.  An idle tick costs 5
+ *   bytes, about 18 KB per minute at 60 Hz.  Values are written in the
+ *   machine's byte order.
+ *
+ *   Replay hands the same states back to CApplication, which installs them
+ *   in place of the message driven keyboard and XInput polling, so the
+ *   game's input code paths run unchanged.
+ */
+#pragma once
+
+#if !defined(__INPUT_RECORDER_H__)
+#define __INPUT_RECORDER_H__
+
+#ifndef _CSTDINT_
+    #include <cstdint>
+#endif
+
+#ifndef _CSTDIO_
+    #include <cstdio>
+#endif
+
+#ifndef __KEYBOARD_STATE_H__
+    #include "KeyboardState.h"
+#endif
+
+#ifndef __XBOX_CONTROLLER_H__
+    #include "XboxController.h"
+#endif
+
+constexpr uint32_t k_nInputRecordMagic   = 0x31524941;  // "AIR1"
+constexpr uint16_t k_nInputRecordVersion = 1;
+constexpr size_t   k_nMaxRecordedPads    = 4;           ///< one flag bit per controller
+
+enum class InputRecordMode
+{
+    None,
+    Record,
+    Replay
+};
+
+class CInputRecorder
+{
+    FILE*           m_pFile;
+    InputRecordMode m_eMode;
+    uint32_t        m_nSeed;
+    uint32_t        m_nTicks;
+    uint16_t        m_nPads;                            ///< controllers in the file
+    KeyboardState   m_stKeyboard;                       ///< last state written or read
+    XINPUT_GAMEPAD  m_rgPads[k_nMaxRecordedPads];
+    bool            m_rgConnected[k_nMaxRecordedPads];
+
+public:
+    /// Default constructor
+    CInputRecorder() noexcept;
+    /// Default destructor
+    ~CInputRecorder() noexcept;
+
+/**
+ *  @brief creates szFileName and writes the header
+ *
+ *  @param [in] nSeed         seed the session's rand() was given
+ *  @param [in] nControllers  controllers recorded each tick
+ *
+ *  @retval false   if the file cannot be created
+ */
+    bool StartRecording ( const char* szFileName, uint32_t nSeed, size_t nControllers ) noexcept;
+/**
+ *  @brief opens a recording and reads its header, get_Seed() is valid on success
+ *
+ *  @retval false   if the file is missing or not a recording
+ */
+    bool StartReplay    ( const char* szFileName ) noexcept;
+
+    void Close          ( void ) noexcept;
+
+/**
+ *  @brief appends one tick
+ *
+ *  @retval false   on a write error, the recording is closed
+ */
+    bool RecordTick     ( float fDeltaTime, const KeyboardState& stKeyboard,
+                          const CXboxController* rgControllers, size_t nControllers ) noexcept;
+/**
+ *  @brief reads the next tick into the caller's keyboard state and controllers
+ *
+ *  @retval false   at the end of the recording, nothing is changed
+ */
+    bool ReplayTick     ( float& fDeltaTime, KeyboardState& stKeyboard,
+                          CXboxController* rgControllers, size_t nControllers ) noexcept;
+
+/**
+ *  @brief reads a whole recording to total its ticks and their delta times
+ *
+ *  @retval false   if the file is missing or not a recording
+ */
+    static bool MeasureReplay ( const char* szFileName, uint32_t& nTicks, double& dSeconds ) noexcept;
+
+    constexpr InputRecordMode get_Mode  ( void ) const noexcept
+    { return m_eMode; };
+
+    constexpr bool     IsRecording      ( void ) const noexcept
+    { return m_eMode == InputRecordMode::Record; };
+
+    constexpr bool     IsReplaying      ( void ) const noexcept
+    { return m_eMode == InputRecordMode::Replay; };
+
+    constexpr uint32_t get_Seed         ( void ) const noexcept
+    { return m_nSeed; };
+
+    constexpr uint32_t get_Ticks        ( void ) const noexcept
+    { return m_nTicks; };
+
+private:
+    /// Copy constructor
+    CInputRecorder(const CInputRecorder&) = delete;
+    /// Assignment operator
+    CInputRecorder& operator=(const CInputRecorder&) = delete;
+};
+
+#endif
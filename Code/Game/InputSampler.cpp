@@ -0,0 +1,325 @@
+/**
+ *  @file       InputSampler.cpp
+ *  @brief      CInputSampler class implementation
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ */
+
+#define WIN32_LEAN_AND_MEAN
+#include "targetver.h"  // this needs to be the 1st header included
+
+#include <Windows.h>
+#include <mmsystem.h>
+#include <cmath>
+#include <cstring>
+
+#include "Engine/Utility/Stats.h"
+#include "Engine/Utility/TimeUtils.h"
+
+#include "ControllerMonitor.h"
+#include "InputSampler.h"
+
+#pragma comment( lib, "winmm" ) // timeBeginPeriod
+
+//-----------------------------------------------------------------------------------------------
+CInputSampler::CInputSampler() noexcept
+    : m_thSampler(),
+      m_mtxSampler(),
+      m_cvSampler(),
+      m_bShutdown(false),
+      m_bDeadZone(true),
+      m_nPads(0),
+      m_tmPeriod(0),
+      m_pMonitor(nullptr),
+      m_rgPollers(),
+      m_rgLastQueued{},
+      m_rgRings(),
+      m_nPolls(0),
+      m_nDropped(0),
+      m_rgCurrent{},
+      m_rgPending{},
+      m_nPending(0),
+      m_rgTickEvents{},
+      m_nTickEvents(0),
+      m_stTickStart(),
+      m_stTickEnd(),
+      m_dTickStart(0.0),
+      m_dTickEnd(0.0),
+      m_dwPacket(0),
+      m_pStats(nullptr),
+      m_iStatLatency(-1)
+{
+    for (size_t i = 0; i < k_nMaxSampledPads; i++)
+    {
+        m_rgRings[i].nWrite = 0;
+        m_rgRings[i].nRead  = 0;
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+CInputSampler::~CInputSampler() noexcept
+{
+    Stop();
+};
+
+//-----------------------------------------------------------------------------------------------
+void CInputSampler::AttachStats( eng::util::CStats* pStats ) noexcept
+{
+    if (IsRunning() || pStats == nullptr)
+        return;
+
+    m_iStatLatency = pStats->Register("input.latency", "ms", true);
+    m_pStats       = pStats;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CInputSampler::Start( CControllerMonitor* pMonitor, uint32_t nPads, unsigned int nRateHz, bool bDeadZone )
+{
+    if (IsRunning() || nRateHz == 0)
+        return;
+
+    m_pMonitor  = pMonitor;
+    m_nPads     = (nPads < k_nMaxSampledPads) ? nPads : static_cast<uint32_t>(k_nMaxSampledPads);
+    m_tmPeriod  = std::chrono::microseconds(1000000 / nRateHz);
+    m_bDeadZone = bDeadZone;
+    m_bShutdown = false;
+
+    for (uint32_t i = 0; i < m_nPads; i++)
+        m_rgPollers[i].m_dwController = i;
+
+    m_dTickEnd = eng::util::GetCurrentTimeInSeconds();
+
+    // the default 15.6 ms timer would cap the thread near 64 Hz
+    ::timeBeginPeriod(1);
+
+    try
+    {
+        m_thSampler = std::thread(&CInputSampler::SamplerProc, this); // note - may throw an exception
+    }
+    catch (...)
+    {
+        ::timeEndPeriod(1);
+        throw;
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+void CInputSampler::Stop( void ) noexcept
+{
+    if (m_thSampler.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mtxSampler);
+            m_bShutdown = true;
+        }
+        m_cvSampler.notify_one();
+        m_thSampler.join();
+
+        ::timeEndPeriod(1);
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+void CInputSampler::OnKeyEvent( int iKey, bool bDown, double dTime ) noexcept
+{
+    // past the log a tick's held fractions fall back to its end state
+    if (m_nPending < k_nKeyEventLog)
+        m_rgPending[m_nPending++] = KeyEvent{ dTime, iKey, bDown };
+};
+
+//-----------------------------------------------------------------------------------------------
+void CInputSampler::BeginTick( double dNow, const KeyboardState& stKeyboard,
+                               CXboxController* rgControllers, size_t nControllers ) noexcept
+{
+    m_dTickStart  = m_dTickEnd;
+    m_dTickEnd    = dNow;
+    m_stTickStart = m_stTickEnd;
+    m_stTickEnd   = stKeyboard;
+
+    memcpy(m_rgTickEvents, m_rgPending, m_nPending * sizeof(KeyEvent));
+    m_nTickEvents = m_nPending;
+    m_nPending    = 0;
+
+    if (m_pStats)
+    {
+        for (size_t j = 0; j < m_nTickEvents; j++)
+            m_pStats->Record(m_iStatLatency, (dNow - m_rgTickEvents[j].dTime) * 1000.0);
+    }
+
+    const size_t nPads = (nControllers < m_nPads) ? nControllers : m_nPads;
+    for (size_t i = 0; i < nPads; i++)
+        IntegratePad(i, dNow, rgControllers[i]);
+};
+
+//-----------------------------------------------------------------------------------------------
+float CInputSampler::get_KeyHeldFraction( Keys key ) const noexcept
+{
+    const double dSpan = m_dTickEnd - m_dTickStart;
+    if (dSpan <= 0.0 || m_nTickEvents == k_nKeyEventLog)
+        return m_stTickEnd.IsKeyStateSet(key) ? 1.f : 0.f;
+
+    const int iKey  = static_cast<int>(key);
+    bool      bDown = m_stTickStart.IsKeyStateSet(key);
+    double    dFrom = m_dTickStart;
+    double    dHeld = 0.0;
+
+    for (size_t j = 0; j < m_nTickEvents; j++)
+    {
+        const KeyEvent& ev = m_rgTickEvents[j];
+        if (ev.iKey != iKey)
+            continue;
+
+        // a message pumped this tick may have been generated before it began
+        const double dAt = (ev.dTime < m_dTickStart) ? m_dTickStart : ((ev.dTime > m_dTickEnd) ? m_dTickEnd : ev.dTime);
+        if (bDown)
+            dHeld += dAt - dFrom;
+
+        dFrom = dAt;
+        bDown = ev.bDown;
+    }
+
+    if (bDown)
+        dHeld += m_dTickEnd - dFrom;
+
+    return static_cast<float>(dHeld / dSpan);
+};
+
+//-----------------------------------------------------------------------------------------------
+void CInputSampler::IntegratePad( size_t iPad, double dNow, CXboxController& controller ) noexcept
+{
+    PadRing&   ring    = m_rgRings[iPad];
+    PadSample& current = m_rgCurrent[iPad];
+
+    double   dFrom = m_dTickStart;
+    double   rgSum[6] = { 0.0 };     // triggers and stick axes, weighted by time held
+    WORD     wButtons = current.pad.wButtons;
+
+    auto Accumulate = [&rgSum](const XINPUT_GAMEPAD& pad, double dWeight)
+    {
+        rgSum[0] += pad.bLeftTrigger  * dWeight;
+        rgSum[1] += pad.bRightTrigger * dWeight;
+        rgSum[2] += pad.sThumbLX      * dWeight;
+        rgSum[3] += pad.sThumbLY      * dWeight;
+        rgSum[4] += pad.sThumbRX      * dWeight;
+        rgSum[5] += pad.sThumbRY      * dWeight;
+    };
+
+    uint32_t       nRead  = ring.nRead.load(std::memory_order_relaxed);
+    const uint32_t nWrite = ring.nWrite.load(std::memory_order_acquire);
+
+    for (; nRead != nWrite; nRead++)
+    {
+        const PadSample& sample = ring.rgSamples[nRead & (k_nPadSampleRing - 1)];
+        if (sample.dTime > dNow)
+            break;      // belongs to the next tick
+
+        const double dAt = (sample.dTime < dFrom) ? dFrom : sample.dTime;
+        Accumulate(current.pad, dAt - dFrom);
+        dFrom = dAt;
+
+        current   = sample;
+        wButtons |= sample.pad.wButtons;
+
+        if (m_pStats)
+            m_pStats->Record(m_iStatLatency, (dNow - sample.dTime) * 1000.0);
+    }
+    ring.nRead.store(nRead, std::memory_order_release);
+
+    Accumulate(current.pad, dNow - dFrom);
+
+    XINPUT_STATE state = { 0 };
+    state.dwPacketNumber = ++m_dwPacket;
+
+    const double dSpan = dNow - m_dTickStart;
+    if (dSpan > 0.0)
+    {
+        state.Gamepad.bLeftTrigger  = static_cast<BYTE> (std::lround(rgSum[0] / dSpan));
+        state.Gamepad.bRightTrigger = static_cast<BYTE> (std::lround(rgSum[1] / dSpan));
+        state.Gamepad.sThumbLX      = static_cast<SHORT>(std::lround(rgSum[2] / dSpan));
+        state.Gamepad.sThumbLY      = static_cast<SHORT>(std::lround(rgSum[3] / dSpan));
+        state.Gamepad.sThumbRX      = static_cast<SHORT>(std::lround(rgSum[4] / dSpan));
+        state.Gamepad.sThumbRY      = static_cast<SHORT>(std::lround(rgSum[5] / dSpan));
+    }
+    else
+    {
+        state.Gamepad = current.pad;
+    }
+    state.Gamepad.wButtons = wButtons;
+
+    controller.SetControllerState(state, current.bConnected);
+};
+
+//-----------------------------------------------------------------------------------------------
+void CInputSampler::SamplerProc( void ) noexcept
+{
+    auto tmNext = std::chrono::steady_clock::now();
+
+    for (;;)
+    {
+        tmNext += m_tmPeriod;
+        {
+            std::unique_lock<std::mutex> lock(m_mtxSampler);
+            if (m_cvSampler.wait_until(lock, tmNext, [this] { return m_bShutdown; }))
+                break;
+        }
+
+        // after a stall, resume the rate from now rather than catching up
+        const auto tmNow = std::chrono::steady_clock::now();
+        if (tmNow - tmNext > m_tmPeriod)
+            tmNext = tmNow;
+
+        PollPads();
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+void CInputSampler::PollPads( void ) noexcept
+{
+    const uint32_t nConnected = m_pMonitor ? m_pMonitor->get_ConnectedMask() : ~0u;
+    const double   dNow       = eng::util::GetCurrentTimeInSeconds();
+
+    for (uint32_t i = 0; i < m_nPads; i++)
+    {
+        PadSample sample = { dNow, { 0 }, false };
+
+        // empty slots are left to the monitor's probe, polling one stalls
+        if (nConnected & (1u << i))
+        {
+            CXboxController& poller = m_rgPollers[i];
+            if (poller.UpdateControllerState())
+            {
+                if (m_bDeadZone)
+                    poller.ApplyRadialDeadZone();
+
+                sample.pad        = poller.get_State().Gamepad;
+                sample.bConnected = true;
+            }
+            else if (m_pMonitor)
+            {
+                m_pMonitor->MarkDisconnected(i);
+            }
+        }
+
+        // only changes are queued, the state holds until the next one
+        PadSample& last = m_rgLastQueued[i];
+        if (sample.bConnected == last.bConnected && memcmp(&sample.pad, &last.pad, sizeof(XINPUT_GAMEPAD)) == 0)
+            continue;
+
+        PadRing&       ring   = m_rgRings[i];
+        const uint32_t nWrite = ring.nWrite.load(std::memory_order_relaxed);
+        if (nWrite - ring.nRead.load(std::memory_order_acquire) >= k_nPadSampleRing)
+        {
+            // the frame loop has stalled; retried on the next poll
+            m_nDropped.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+
+        ring.rgSamples[nWrite & (k_nPadSampleRing - 1)] = sample;
+        ring.nWrite.store(nWrite + 1, std::memory_order_release);
+        last = sample;
+    }
+
+    m_nPolls.fetch_add(1, std::memory_order_relaxed);
+};
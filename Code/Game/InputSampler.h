@@ -0,0 +1,205 @@
+/**
+ *  @file       InputSampler.h
+ *  @brief      CInputSampler class interface
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ *  <b>Implementation:</b>
+ *
+ *   Input between two simulation ticks is integrated rather than read once
+ *   per frame.
+ *
+ *    - A sampling thread polls the connected pads at a fixed rate (1 kHz by
+ *      default), applies the radial dead zone and queues every change of
+ *      state with its engine clock time in a per-pad single producer ring.
+ *    - Keyboard events are stamped with the engine clock time they were
+ *      generated at, from the message time, as they are pumped.
+ *
+ *   BeginTick() consumes everything up to the tick's start time.  A pad's
+ *   sticks and triggers become their time weighted average over the tick,
+ *   its buttons the OR of every state seen, so a tap between two frames is
+ *   not lost; the result is installed in the CXboxController the game
+ *   reads.  get_KeyHeldFraction() gives the fraction of the tick a key was
+ *   down, which CActionMap turns into the amount of each action.
+ *
+ *   The time from an input arriving to the tick that consumes it is
+ *   recorded as the input.latency statistic.
+ */
+#pragma once
+
+#if !defined(__INPUT_SAMPLER_H__)
+#define __INPUT_SAMPLER_H__
+
+#ifndef _ATOMIC_
+    #include <atomic>
+#endif
+
+#ifndef _CHRONO_
+    #include <chrono>
+#endif
+
+#ifndef _CONDITION_VARIABLE_
+    #include <condition_variable>
+#endif
+
+#ifndef _CSTDINT_
+    #include <cstdint>
+#endif
+
+#ifndef _MUTEX_
+    #include <mutex>
+#endif
+
+#ifndef _THREAD_
+    #include <thread>
+#endif
+
+#ifndef __KEYBOARD_STATE_H__
+    #include "KeyboardState.h"
+#endif
+
+#ifndef __XBOX_CONTROLLER_H__
+    #include "XboxController.h"
+#endif
+
+namespace eng
+{
+namespace util
+{
+class CStats;
+}
+}
+
+class CControllerMonitor;
+
+constexpr size_t k_nMaxSampledPads = 4;
+constexpr size_t k_nPadSampleRing  = 256;   ///< pad state changes awaiting a tick, power of two
+constexpr size_t k_nKeyEventLog    = 64;    ///< keyboard events kept per tick
+
+static_assert((k_nPadSampleRing & (k_nPadSampleRing - 1)) == 0, "k_nPadSampleRing must be a power of two");
+
+/**
+ * @brief a pad's state from the time it was sampled on
+ */
+struct PadSample
+{
+    double          dTime;          ///< engine clock, seconds
+    XINPUT_GAMEPAD  pad;            ///< zeroed while disconnected
+    bool            bConnected;
+};
+
+/**
+ * @brief a key going down or up
+ */
+struct KeyEvent
+{
+    double          dTime;          ///< engine clock, seconds
+    int             iKey;
+    bool            bDown;
+};
+
+class CInputSampler
+{
+    struct PadRing
+    {
+        PadSample             rgSamples[k_nPadSampleRing];
+        std::atomic<uint32_t> nWrite;       ///< advanced by the sampling thread
+        std::atomic<uint32_t> nRead;        ///< advanced by the frame loop
+    };
+
+    // sampling thread
+    std::thread                 m_thSampler;
+    std::mutex                  m_mtxSampler;
+    std::condition_variable     m_cvSampler;
+    bool                        m_bShutdown;
+    bool                        m_bDeadZone;
+    uint32_t                    m_nPads;
+    std::chrono::microseconds   m_tmPeriod;
+    CControllerMonitor*         m_pMonitor;
+    CXboxController             m_rgPollers[k_nMaxSampledPads];
+    PadSample                   m_rgLastQueued[k_nMaxSampledPads];
+    PadRing                     m_rgRings[k_nMaxSampledPads];
+    std::atomic<uint32_t>       m_nPolls;
+    std::atomic<uint32_t>       m_nDropped;         ///< changes lost to a full ring
+
+    // frame loop
+    PadSample                   m_rgCurrent[k_nMaxSampledPads];  ///< state each pad ended the last tick in
+    KeyEvent                    m_rgPending[k_nKeyEventLog];     ///< pumped since the last tick
+    size_t                      m_nPending;
+    KeyEvent                    m_rgTickEvents[k_nKeyEventLog];  ///< of the tick being simulated
+    size_t                      m_nTickEvents;
+    KeyboardState               m_stTickStart;
+    KeyboardState               m_stTickEnd;
+    double                      m_dTickStart;
+    double                      m_dTickEnd;
+    DWORD                       m_dwPacket;
+
+    eng::util::CStats*          m_pStats;
+    int                         m_iStatLatency;
+
+public:
+    /// Default Constructor
+    CInputSampler() noexcept;
+    /// Default Destructor, stops the sampling thread
+    ~CInputSampler() noexcept;
+
+/**
+ *  @brief starts sampling the pads that pMonitor reports connected
+ *
+ *  @param [in] pMonitor      may be nullptr, every slot is then polled
+ *  @param [in] nPads         pads to sample, at most k_nMaxSampledPads
+ *  @param [in] nRateHz       polls per second
+ *  @param [in] bDeadZone     apply the radial dead zone to each sample
+ *
+ *  @note - may throw an exception
+ */
+    void  Start             ( CControllerMonitor* pMonitor, uint32_t nPads, unsigned int nRateHz, bool bDeadZone );
+    void  Stop              ( void ) noexcept;
+
+/**
+ *  @brief registers input.latency, call before Start()
+ */
+    void  AttachStats       ( eng::util::CStats* pStats ) noexcept;
+
+/**
+ *  @brief logs a key transition from the message pump
+ *
+ *  @param [in] dTime         engine clock time the key message was generated
+ */
+    void  OnKeyEvent        ( int iKey, bool bDown, double dTime ) noexcept;
+
+/**
+ *  @brief closes the tick ending at dNow and installs the integrated pad states
+ *
+ *  @param [in] stKeyboard    keyboard state at dNow
+ */
+    void  BeginTick         ( double dNow, const KeyboardState& stKeyboard,
+                              CXboxController* rgControllers, size_t nControllers ) noexcept;
+
+/**
+ *  @retval float   0 .. 1, the fraction of the last tick key was held for
+ */
+    float get_KeyHeldFraction( Keys key ) const noexcept;
+
+    uint32_t get_Polls      ( void ) const noexcept
+    { return m_nPolls.load(std::memory_order_relaxed); };
+
+    uint32_t get_Dropped    ( void ) const noexcept
+    { return m_nDropped.load(std::memory_order_relaxed); };
+
+    bool     IsRunning      ( void ) const noexcept
+    { return m_thSampler.joinable(); };
+
+private:
+    void  SamplerProc       ( void ) noexcept;
+    void  PollPads          ( void ) noexcept;
+    void  IntegratePad      ( size_t iPad, double dNow, CXboxController& controller ) noexcept;
+
+    /// Copy constructor
+    CInputSampler(const CInputSampler&) = delete;
+    /// Assignment operator
+    CInputSampler& operator=(const CInputSampler&) = delete;
+};
+
+#endif
@@ -23,21 +23,6 @@
 bool SetKeyDownState(int iKey, KeyboardState& state) noexcept;
 bool SetKeyUpState  (int iKey, KeyboardState& state) noexcept;
 
-//-----------------------------------------------------------------------------------------------
-bool  KeyboardState::IsKeyStateSet(Keys key) const noexcept
-{
-    bool bRetVal = false;
-    // some basic sanity checking
-    if (key >= Keys::None && key <= Keys::OemClear)
-    {
-        auto pState = reinterpret_cast<const uint32_t*>( this );
-        auto iKey   = static_cast<int>(key);
-        unsigned int nBitFlag = 1u << ( iKey & 0x1f );
-        bRetVal = ( pState[( iKey >> 5 )] & nBitFlag ) != 0;
-    }
-    return bRetVal;
-}
-
 //-----------------------------------------------------------------------------------------------
 void CKeyboard::InitKeyStates(void) noexcept
 {
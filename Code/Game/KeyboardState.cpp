@@ -0,0 +1,42 @@
+/**
+ *  @file       KeyboardState.cpp
+ *  @brief      KeyboardState implementation
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ */
+
+#include <stdint.h>
+
+#include "KeyboardState.h"
+
+//-----------------------------------------------------------------------------------------------
+bool  KeyboardState::IsKeyStateSet(Keys key) const noexcept
+{
+    bool bRetVal = false;
+    // some basic sanity checking
+    if (key >= Keys::None && key <= Keys::OemClear)
+    {
+        auto pState = reinterpret_cast<const uint32_t*>( this );
+        auto iKey   = static_cast<int>(key);
+        unsigned int nBitFlag = 1u << ( iKey & 0x1f );
+        bRetVal = ( pState[( iKey >> 5 )] & nBitFlag ) != 0;
+    }
+    return bRetVal;
+}
+
+//-----------------------------------------------------------------------------------------------
+void  KeyboardState::SetKeyState(Keys key, bool bDown) noexcept
+{
+    if (key >= Keys::None && key <= Keys::OemClear)
+    {
+        auto pState = reinterpret_cast<uint32_t*>( this );
+        auto iKey   = static_cast<int>(key);
+        unsigned int nBitFlag = 1u << ( iKey & 0x1f );
+        if (bDown)
+            pState[( iKey >> 5 )] |= nBitFlag;
+        else
+            pState[( iKey >> 5 )] &= ~nBitFlag;
+    }
+};
@@ -31,9 +31,9 @@
 #include "Application.h"
 
 //-----------------------------------------------------------------------------------------------
-int WINAPI WinMain( HINSTANCE hInstance, HINSTANCE, LPSTR /*commandLineString*/, int )
+int WINAPI WinMain( HINSTANCE hInstance, HINSTANCE, LPSTR commandLineString, int )
 {
-    g_theApp.Initialize( hInstance );
+    g_theApp.Initialize( hInstance, commandLineString );
 
     MSG msg;
     // Enter the infinite message Loop
@@ -0,0 +1,156 @@
+/**
+ *  @file       ScoreHud.cpp
+ *  @brief      CScoreHud class implementation
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ */
+
+#include "targetver.h"  // this needs to be the 1st header included
+#include "CommonDef.h"
+
+#include "Engine/Renderer/Renderer.h"
+#include "Engine/Renderer/Texture.h"
+
+#include "ScoreHud.h"
+
+// one row of 3 bits per line, top row in the high bits
+constexpr const uint16_t k_rgDigitGlyphs[10] =
+{
+    075557,     // 0
+    026227,     // 1
+    071747,     // 2
+    071717,     // 3
+    055711,     // 4
+    074717,     // 5
+    074757,     // 6
+    071111,     // 7
+    075757,     // 8
+    075717      // 9
+};
+
+//-----------------------------------------------------------------------------------------------
+CScoreHud::CScoreHud()
+    : m_Atlas(64, 1),
+      m_Batch(m_Atlas),
+      m_rgDigitRegions(),
+      m_pDigitStrip(nullptr),
+      m_bReady(false)
+{
+};
+
+//-----------------------------------------------------------------------------------------------
+bool CScoreHud::Initialize( void )
+{
+    if (m_bReady)
+        return true;
+
+    // a deployed strip wins over the built-in font
+    try
+    {
+        m_pDigitStrip = eng::rdr::CTexture::CreateOrGetTexture(k_szScoreDigitsTexture); // note - may throw an exception
+    }
+    catch (...)
+    {
+        m_pDigitStrip = nullptr;
+    }
+
+    if (m_pDigitStrip)
+    {
+        m_bReady = true;
+        return true;
+    }
+
+    char szName[] = "digit0";
+
+    for (int iDigit = 0; iDigit < 10; iDigit++)
+    {
+        unsigned char rgTexels[k_nScoreGlyphWidth * k_nScoreGlyphHeight * 4];
+
+        for (int iRow = 0; iRow < k_nScoreGlyphHeight; iRow++)
+        {
+            const unsigned nBits = (k_rgDigitGlyphs[iDigit] >> ((k_nScoreGlyphHeight - 1 - iRow) * 3)) & 07;
+
+            for (int iCol = 0; iCol < k_nScoreGlyphWidth; iCol++)
+            {
+                const bool bSet = (nBits & (04 >> iCol)) != 0;
+
+                unsigned char* pTexel = &rgTexels[(iRow * k_nScoreGlyphWidth + iCol) * 4];
+                pTexel[0] = pTexel[1] = pTexel[2] = 0xFF;
+                pTexel[3] = bSet ? 0xFF : 0x00;
+            }
+        }
+
+        szName[5] = static_cast<char>('0' + iDigit);
+        m_rgDigitRegions[iDigit] = m_Atlas.RegisterTexels(szName, k_nScoreGlyphWidth, k_nScoreGlyphHeight, rgTexels); // note - may throw an exception
+        if (m_rgDigitRegions[iDigit] < 0)
+            return false;
+    }
+
+    m_bReady = m_Atlas.Build();
+    return m_bReady;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CScoreHud::Render( uint32_t nScore )
+{
+    if (!m_bReady)
+        return;
+
+    const float fDigitWidth  = k_nScoreGlyphWidth  * k_fScoreTexelSize;
+    const float fDigitHeight = k_nScoreGlyphHeight * k_fScoreTexelSize;
+    const float fAdvance     = fDigitWidth + k_fScoreTexelSize;
+
+    // lowest digit first, drawn leftwards from the right margin
+    float fLeft = VIEW_RIGHT - k_fScoreMargin - fDigitWidth;
+    const float fBottom = VIEW_TOP - k_fScoreMargin - fDigitHeight;
+
+    if (m_pDigitStrip)
+    {
+        // digit n spans [n / 10, (n + 1) / 10) of the strip, top row at v = 0
+        eng::TexturedVertex rgVertices[k_nMaxScoreDigits * 4];
+        size_t nVertices = 0;
+        do
+        {
+            const float fU0    = static_cast<float>(nScore % 10) / 10.f;
+            const float fU1    = fU0 + 0.1f;
+            const float fRight = fLeft + fDigitWidth;
+            const float fTop   = fBottom + fDigitHeight;
+
+            rgVertices[nVertices++] = eng::TexturedVertex{ fLeft,  fBottom, fU0, 1.f, eng::RGBA_WHITE };
+            rgVertices[nVertices++] = eng::TexturedVertex{ fRight, fBottom, fU1, 1.f, eng::RGBA_WHITE };
+            rgVertices[nVertices++] = eng::TexturedVertex{ fRight, fTop,    fU1, 0.f, eng::RGBA_WHITE };
+            rgVertices[nVertices++] = eng::TexturedVertex{ fLeft,  fTop,    fU0, 0.f, eng::RGBA_WHITE };
+
+            fLeft  -= fAdvance;
+            nScore /= 10;
+        } while (nScore);
+
+        eng::g_theRdr.DrawTexturedQuads(m_pDigitStrip->get_TextureID(), rgVertices, nVertices);
+        return;
+    }
+
+    m_Batch.Begin();
+    do
+    {
+        const eng::rdr::SpriteRegion* pRegion = m_Atlas.GetRegion(m_rgDigitRegions[nScore % 10]);
+        if (pRegion)
+        {
+            const eng::CAABB2 aabbDigit(eng::math::CVector2f(fLeft, fBottom), fDigitWidth, fDigitHeight);
+            m_Batch.Draw(aabbDigit, *pRegion, eng::RGBA_WHITE); // note - may throw an exception
+        }
+
+        fLeft  -= fAdvance;
+        nScore /= 10;
+    } while (nScore);
+    m_Batch.End();
+};
+
+//-----------------------------------------------------------------------------------------------
+void CScoreHud::Release( void ) noexcept
+{
+    m_Atlas.Release();
+    m_pDigitStrip = nullptr;
+    m_bReady      = false;
+};
@@ -0,0 +1,84 @@
+/**
+ *  @file       ScoreHud.h
+ *  @brief      CScoreHud class interface
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ *  <b>Implementation:</b>
+ *
+ *   The score is drawn from a strip of ten 3 x 5 digit glyphs, loaded by
+ *   name through the texture manager (so it comes from the asset pack or
+ *   the texture cache when present, and is hot reloaded when edited).  If
+ *   the image is not deployed, the same glyphs are generated from a
+ *   built-in bitmap font, packed into one CTextureAtlas page and drawn
+ *   through a CSpriteBatch.  Either way the whole number costs one texture
+ *   bind and one draw call however many digits it has.  Glyphs are
+ *   magnified with nearest filtering, keeping the blocky look of the
+ *   vector-era original.
+ */
+#pragma once
+
+#if !defined(__SCORE_HUD_H__)
+#define __SCORE_HUD_H__
+
+#ifndef _CSTDINT_
+    #include <cstdint>
+#endif
+
+#ifndef __TEXTURE_ATLAS_H__
+    #include "Engine/Renderer/TextureAtlas.h"
+#endif
+
+#ifndef __SPRITE_BATCH_H__
+    #include "Engine/Renderer/SpriteBatch.h"
+#endif
+
+constexpr int k_nScoreGlyphWidth  = 3;     ///< texels
+constexpr int k_nScoreGlyphHeight = 5;
+constexpr int k_nMaxScoreDigits   = 10;    ///< digits of the largest uint32_t
+
+class CScoreHud
+{
+    eng::rdr::CTextureAtlas  m_Atlas;
+    eng::rdr::CSpriteBatch   m_Batch;
+    int                      m_rgDigitRegions[10];
+    const eng::rdr::CTexture* m_pDigitStrip;    ///< pinned by the texture manager, nullptr when not deployed
+    bool                     m_bReady;
+
+public:
+    /// Default constructor
+    CScoreHud();
+    /// Default destructor
+    ~CScoreHud() = default;
+
+/**
+ *  @brief loads the digit strip, or generates the glyphs and uploads the atlas
+ *
+ *  @note - requires a current rendering context
+ *
+ *  @retval false   if neither is available; Render() then draws nothing
+ */
+    bool Initialize ( void );
+
+/**
+ *  @brief draws the score right aligned at the upper right of the view
+ */
+    void Render     ( uint32_t nScore );
+
+/**
+ *  @brief deletes the atlas pages and lets go of the digit strip, which
+ *         the texture manager deletes; Render() draws nothing afterwards
+ *
+ *  @note - requires the rendering context Initialize() ran on
+ */
+    void Release    ( void ) noexcept;
+
+private:
+    /// Copy constructor
+    CScoreHud( const CScoreHud& ) = delete;
+    /// Assignment operator
+    CScoreHud& operator = ( const CScoreHud& ) = delete;
+};
+
+#endif
@@ -0,0 +1,394 @@
+/**
+ *  @file       ScriptedInputDevice.cpp
+ *  @brief      CScriptedInputDevice class implementation
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ * <b>Cite:</b>
+ *
+ * @sa https://www.jstatsoft.org/article/view/v008i14 (Marsaglia, "Xorshift RNGs")
+ */
+
+#define _CRT_SECURE_NO_WARNINGS
+#include "targetver.h"  // this needs to be the 1st header included
+
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "ScriptedInputDevice.h"
+
+struct ScriptName
+{
+    const char* szName;
+    int         iValue;
+};
+
+// single letters and digits are their own virtual key codes
+const constexpr ScriptName k_rgScriptKeys[] =
+{
+    { "Space",     static_cast<int>(Keys::Space)     }, { "Enter",        static_cast<int>(Keys::Enter)        },
+    { "Escape",    static_cast<int>(Keys::Escape)    }, { "Tab",          static_cast<int>(Keys::Tab)          },
+    { "Back",      static_cast<int>(Keys::Back)      }, { "Up",           static_cast<int>(Keys::Up)           },
+    { "Down",      static_cast<int>(Keys::Down)      }, { "Left",         static_cast<int>(Keys::Left)         },
+    { "Right",     static_cast<int>(Keys::Right)     }, { "LeftShift",    static_cast<int>(Keys::LeftShift)    },
+    { "LeftControl", static_cast<int>(Keys::LeftControl) }, { "LeftAlt",  static_cast<int>(Keys::LeftAlt)      }
+};
+
+const constexpr ScriptName k_rgScriptButtons[] =
+{
+    { "A",         PAD_A              }, { "B",         PAD_B              },
+    { "X",         PAD_X              }, { "Y",         PAD_Y              },
+    { "Start",     PAD_START          }, { "Back",      PAD_BACK           },
+    { "LB",        PAD_LEFT_SHOULDER  }, { "RB",        PAD_RIGHT_SHOULDER },
+    { "DPadUp",    PAD_DPAD_UP        }, { "DPadDown",  PAD_DPAD_DOWN      },
+    { "DPadLeft",  PAD_DPAD_LEFT      }, { "DPadRight", PAD_DPAD_RIGHT     }
+};
+
+constexpr double  k_dPi              = 3.14159265358979323846;
+constexpr int16_t k_nScriptStickMax  = 32767;
+constexpr double  k_dGenerateAhead   = 2.0;     ///< seconds of pattern generated past the poll time
+
+//-----------------------------------------------------------------------------------------------
+static bool IsNameEqual(const char* szA, const char* szB) noexcept
+{
+    for (; *szA && *szB; szA++, szB++)
+    {
+        if (tolower(static_cast<unsigned char>(*szA)) != tolower(static_cast<unsigned char>(*szB)))
+            return false;
+    }
+    return *szA == *szB;
+};
+
+//-----------------------------------------------------------------------------------------------
+static Keys FindScriptKey(const char* szName) noexcept
+{
+    if (szName[0] && szName[1] == '\0' && isalnum(static_cast<unsigned char>(szName[0])))
+        return static_cast<Keys>( toupper(static_cast<unsigned char>(szName[0])) );
+
+    // F1 .. F24
+    if ((szName[0] == 'F' || szName[0] == 'f') && isdigit(static_cast<unsigned char>(szName[1])))
+    {
+        const int nFunction = atoi(szName + 1);
+        if (nFunction >= 1 && nFunction <= 24)
+            return static_cast<Keys>( static_cast<int>(Keys::F1) + nFunction - 1 );
+    }
+
+    for (const ScriptName& key : k_rgScriptKeys)
+    {
+        if (IsNameEqual(key.szName, szName))
+            return static_cast<Keys>(key.iValue);
+    }
+    return Keys::None;
+};
+
+//-----------------------------------------------------------------------------------------------
+static uint16_t FindScriptButton(const char* szName) noexcept
+{
+    for (const ScriptName& button : k_rgScriptButtons)
+    {
+        if (IsNameEqual(button.szName, szName))
+            return static_cast<uint16_t>(button.iValue);
+    }
+    return 0;
+};
+
+//-----------------------------------------------------------------------------------------------
+static int16_t ToThumb(double dAxis) noexcept
+{
+    dAxis = (dAxis < -1.0) ? -1.0 : ((dAxis > 1.0) ? 1.0 : dAxis);
+    return static_cast<int16_t>( std::lround(dAxis * k_nScriptStickMax) );
+};
+
+//-----------------------------------------------------------------------------------------------
+CScriptedInputDevice::CScriptedInputDevice(const char* szScriptPath, uint32_t nSeed)
+    : m_strScriptPath(szScriptPath ? szScriptPath : ""),  // note - may throw an exception
+      m_nSeed(nSeed),
+      m_nRandom(0),
+      m_rgSteps(),
+      m_dEnd(0.0),
+      m_bLoop(false),
+      m_bOpen(false)
+{
+};
+
+//-----------------------------------------------------------------------------------------------
+bool CScriptedInputDevice::Open( void ) noexcept
+{
+    Close();
+
+    m_nRandom = m_nSeed ? m_nSeed : 1;     // xorshift never leaves 0
+    m_bOpen   = m_strScriptPath.empty() ? GenerateUntil(0.0) : LoadScript();
+    return m_bOpen;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CScriptedInputDevice::Close( void ) noexcept
+{
+    m_rgSteps.clear();
+    m_dEnd  = 0.0;
+    m_bLoop = false;
+    m_bOpen = false;
+};
+
+//-----------------------------------------------------------------------------------------------
+bool CScriptedInputDevice::Poll( double dTime, InputSnapshot& snapshot ) noexcept
+{
+    if (!m_bOpen)
+        return false;
+
+    if (m_strScriptPath.empty())
+    {
+        if (!GenerateUntil(dTime))
+            return false;
+    }
+    else if (m_bLoop)
+    {
+        dTime = std::fmod(dTime, m_dEnd);
+    }
+    else if (dTime >= m_dEnd)
+    {
+        return false;
+    }
+
+    snapshot = InputSnapshot{};
+    snapshot.nConnectedPads = 1;
+
+    for (const ScriptStep& step : m_rgSteps)
+    {
+        if (step.dStart <= dTime && dTime < step.dEnd)
+            ApplyStep(step, dTime, snapshot);
+    }
+    return true;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CScriptedInputDevice::ApplyStep( const ScriptStep& step, double dTime, InputSnapshot& snapshot ) const noexcept
+{
+    PadState&    pad     = snapshot.rgPads[0];
+    const double dOffset = dTime - step.dStart;
+
+    if (step.nPattern == SCRIPT_TAP && std::fmod(dOffset, k_dScriptTapPeriod) >= 0.5 * k_dScriptTapPeriod)
+        return;     // released half
+
+    if (step.eKey != Keys::None)
+        snapshot.stKeyboard.SetKeyState(step.eKey, true);
+
+    pad.wButtons |= step.wButtons;
+
+    if (step.nPattern == SCRIPT_SWEEP)
+    {
+        const double dAngle = 2.0 * k_dPi * dOffset / k_dScriptSweepPeriod;
+        pad.sThumbLX = ToThumb(std::cos(dAngle));
+        pad.sThumbLY = ToThumb(std::sin(dAngle));
+    }
+    else if (step.sThumbLX || step.sThumbLY)
+    {
+        pad.sThumbLX = step.sThumbLX;
+        pad.sThumbLY = step.sThumbLY;
+    }
+};
+
+//-----------------------------------------------------------------------------------------------
+uint32_t CScriptedInputDevice::NextRandom( void ) noexcept
+{
+    uint32_t n = m_nRandom;
+    n ^= n << 13;
+    n ^= n >> 17;
+    n ^= n << 5;
+    m_nRandom = n;
+    return n;
+};
+
+//-----------------------------------------------------------------------------------------------
+bool CScriptedInputDevice::GenerateUntil( double dTime ) noexcept
+{
+    // steps are made in order from the seed alone, so the pattern does not
+    // depend on the frame times it is polled at
+    auto NextUnit = [this]() { return (NextRandom() >> 8) * (1.0 / 16777216.0); };
+
+    try
+    {
+        // game time only moves forward, finished steps are dropped
+        size_t nFinished = 0;
+        while (nFinished < m_rgSteps.size() && m_rgSteps[nFinished].dEnd <= dTime)
+            nFinished++;
+        m_rgSteps.erase(m_rgSteps.begin(), m_rgSteps.begin() + nFinished);
+
+        while (m_dEnd < dTime + k_dGenerateAhead)
+        {
+            const double dStart  = m_dEnd;
+            const double dLength = 0.25 + 1.75 * NextUnit();
+            const double dEnd    = dStart + dLength;
+
+            ScriptStep step = { dStart, dEnd, Keys::None, 0, 0, 0, SCRIPT_HOLD };
+
+            switch (NextRandom() % 8)
+            {
+            case 0:     // thrust
+                step.eKey = Keys::W;
+                m_rgSteps.push_back(step); // note - may throw an exception
+                break;
+            case 1:     // turn
+                step.eKey = (NextRandom() & 1) ? Keys::A : Keys::D;
+                m_rgSteps.push_back(step); // note - may throw an exception
+                break;
+            case 2:     // thrust while turning
+                step.eKey = Keys::W;
+                m_rgSteps.push_back(step); // note - may throw an exception
+                step.eKey = (NextRandom() & 1) ? Keys::Left : Keys::Right;
+                m_rgSteps.push_back(step); // note - may throw an exception
+                break;
+            case 3:     // strafing fire
+                step.eKey = (NextRandom() & 1) ? Keys::A : Keys::D;
+                m_rgSteps.push_back(step); // note - may throw an exception
+                step.eKey     = Keys::Space;
+                step.nPattern = SCRIPT_TAP;
+                m_rgSteps.push_back(step); // note - may throw an exception
+                break;
+            case 4:     // stick sweep, firing with the pad
+                step.nPattern = SCRIPT_SWEEP;
+                m_rgSteps.push_back(step); // note - may throw an exception
+                step.wButtons = PAD_A;
+                step.nPattern = SCRIPT_TAP;
+                m_rgSteps.push_back(step); // note - may throw an exception
+                break;
+            case 5:     // pad thrust and turn
+                step.wButtons = PAD_DPAD_UP | ((NextRandom() & 1) ? PAD_DPAD_LEFT : PAD_DPAD_RIGHT);
+                m_rgSteps.push_back(step); // note - may throw an exception
+                break;
+            case 6:     // fixed stick deflection
+                step.sThumbLX = ToThumb(2.0 * NextUnit() - 1.0);
+                step.sThumbLY = ToThumb(2.0 * NextUnit() - 1.0);
+                m_rgSteps.push_back(step); // note - may throw an exception
+                break;
+            default:    // coast
+                break;
+            }
+
+            // respawn after a collision, and keep the field from emptying
+            const uint32_t nExtra = NextRandom() % 16;
+            if (nExtra < 2)
+            {
+                const ScriptStep tap = { dStart, dStart + 0.1, (nExtra == 0) ? Keys::P : Keys::O, 0, 0, 0, SCRIPT_HOLD };
+                m_rgSteps.push_back(tap); // note - may throw an exception
+            }
+
+            m_dEnd = dEnd;
+        }
+    }
+    catch (...)
+    {
+        return false;
+    }
+    return true;
+};
+
+//-----------------------------------------------------------------------------------------------
+bool CScriptedInputDevice::LoadScript( void ) noexcept
+{
+    FILE* pFile = fopen(m_strScriptPath.c_str(), "r");
+    if (pFile == nullptr)
+        return false;
+
+    bool bResult   = true;
+    bool bHasEnd   = false;
+    char szLine[256];
+
+    try
+    {
+        while (fgets(szLine, sizeof(szLine), pFile))
+        {
+            char* pComment = strchr(szLine, '#');
+            if (pComment)
+                *pComment = '\0';
+
+            double dStart  = 0.0;
+            double dLength = 0.0;
+            char   szInput[32] = { 0 };
+            char   szArg[32]   = { 0 };
+            double dX = 0.0;
+            double dY = 0.0;
+
+            const int nFields = sscanf(szLine, "%lf %lf %31s %31s", &dStart, &dLength, szInput, szArg);
+            if (nFields <= 0)
+                continue;   // blank or comment
+            if (nFields < 3 || dStart < 0.0 || dLength < 0.0)
+            {
+                bResult = false;
+                break;
+            }
+
+            if (IsNameEqual(szInput, "loop") || IsNameEqual(szInput, "end"))
+            {
+                m_dEnd   = dStart;
+                m_bLoop  = IsNameEqual(szInput, "loop");
+                bHasEnd  = true;
+                continue;
+            }
+
+            ScriptStep step   = { dStart, dStart + dLength, Keys::None, 0, 0, 0, SCRIPT_HOLD };
+            bool       bKnown = true;
+
+            if (IsNameEqual(szInput, "key"))
+            {
+                step.eKey = FindScriptKey(szArg);
+                bKnown    = (step.eKey != Keys::None);
+            }
+            else if (IsNameEqual(szInput, "button"))
+            {
+                step.wButtons = FindScriptButton(szArg);
+                bKnown        = (step.wButtons != 0);
+            }
+            else if (IsNameEqual(szInput, "tap"))
+            {
+                // a key name, else a button name
+                step.eKey     = FindScriptKey(szArg);
+                step.wButtons = (step.eKey == Keys::None) ? FindScriptButton(szArg) : 0;
+                step.nPattern = SCRIPT_TAP;
+                bKnown        = (step.eKey != Keys::None || step.wButtons != 0);
+            }
+            else if (IsNameEqual(szInput, "stick"))
+            {
+                bKnown        = (sscanf(szLine, "%*f %*f %*s %lf %lf", &dX, &dY) == 2);
+                step.sThumbLX = ToThumb(dX);
+                step.sThumbLY = ToThumb(dY);
+            }
+            else if (IsNameEqual(szInput, "sweep"))
+            {
+                step.nPattern = SCRIPT_SWEEP;
+            }
+            else
+            {
+                bKnown = false;
+            }
+
+            if (!bKnown)
+            {
+                bResult = false;
+                break;
+            }
+
+            m_rgSteps.push_back(step); // note - may throw an exception
+            if (!bHasEnd && step.dEnd > m_dEnd)
+                m_dEnd = step.dEnd;
+        }
+    }
+    catch (...)
+    {
+        bResult = false;
+    }
+
+    fclose(pFile);
+
+    // a zero length loop would never advance
+    if (m_bLoop && m_dEnd <= 0.0)
+        bResult = false;
+
+    if (!bResult)
+        m_rgSteps.clear();
+    return bResult;
+};
@@ -0,0 +1,106 @@
+/**
+ *  @file       ScriptedInputDevice.h
+ *  @brief      CScriptedInputDevice class interface
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ *  <b>Implementation:</b>
+ *
+ *   Synthesises keyboard and pad 0 input as a pure function of game time,
+ *   so a soak or perf run exercises the real ship logic the same way every
+ *   time it is given the same frame times.  Two sources of steps:
+ *
+ *    - Generated: an endless run of manoeuvres (thrust, turns, strafing
+ *      fire, stick sweeps, respawn taps) whose kinds and lengths come from
+ *      a seeded xorshift generator of its own, independent of rand().
+ *    - A script file, one step per line, times in seconds:
+ *
+ *          # start  length  input
+ *          0.0      2.0     key W
+ *          0.5      0.1     button A
+ *          1.0      1.5     stick 0.0 1.0      (left stick, -1 .. 1)
+ *          2.5      1.0     tap Space          (pressed half of every k_dScriptTapPeriod)
+ *          2.5      1.5     sweep              (left stick turning in a circle)
+ *          4.0      0       loop               (or "end", time wraps / stops)
+ *
+ *   Keys are named as in the Keys enumeration (W, Space, Left, F12, ...),
+ *   buttons as A, B, X, Y, Start, Back, LB, RB, DPadUp .. DPadRight.
+ */
+#pragma once
+
+#if !defined(__SCRIPTED_INPUT_DEVICE_H__)
+#define __SCRIPTED_INPUT_DEVICE_H__
+
+#ifndef _STRING_
+    #include <string>
+#endif
+
+#ifndef _VECTOR_
+    #include <vector>
+#endif
+
+#ifndef __INPUT_DEVICE_H__
+    #include "InputDevice.h"
+#endif
+
+constexpr double k_dScriptTapPeriod   = 0.25;    ///< seconds, half of it pressed
+constexpr double k_dScriptSweepPeriod = 2.0;     ///< seconds per stick revolution
+
+enum SCRIPT_PATTERN_T : uint8_t
+{
+    SCRIPT_HOLD,            ///< held for the whole step
+    SCRIPT_TAP,             ///< pressed and released every k_dScriptTapPeriod
+    SCRIPT_SWEEP            ///< left stick turning a full circle every k_dScriptSweepPeriod
+};
+
+/**
+ * @brief one input held over [dStart, dEnd)
+ */
+struct ScriptStep
+{
+    double   dStart;
+    double   dEnd;
+    Keys     eKey;          ///< Keys::None if none
+    uint16_t wButtons;      ///< PAD_BUTTON_T flags
+    int16_t  sThumbLX;
+    int16_t  sThumbLY;
+    uint8_t  nPattern;      ///< SCRIPT_PATTERN_T
+};
+
+class CScriptedInputDevice : public IInputDevice
+{
+    std::string             m_strScriptPath;    ///< empty for the generated pattern
+    uint32_t                m_nSeed;
+    uint32_t                m_nRandom;          ///< xorshift state
+    std::vector<ScriptStep> m_rgSteps;
+    double                  m_dEnd;             ///< script length, or how far the pattern is generated
+    bool                    m_bLoop;
+    bool                    m_bOpen;
+
+public:
+/**
+ *  @param [in] szScriptPath    nullptr or empty for the generated pattern
+ *  @param [in] nSeed           seeds the generated pattern
+ *
+ *  @note - may throw an exception
+ */
+    CScriptedInputDevice(const char* szScriptPath, uint32_t nSeed);
+
+    bool        Open        ( void ) noexcept override;
+    void        Close       ( void ) noexcept override;
+    bool        Poll        ( double dTime, InputSnapshot& snapshot ) noexcept override;
+    const char* get_Name    ( void ) const noexcept override
+    { return "script"; };
+
+    uint32_t    get_Seed    ( void ) const noexcept
+    { return m_nSeed; };
+
+private:
+    bool        LoadScript      ( void ) noexcept;
+    bool        GenerateUntil   ( double dTime ) noexcept;
+    uint32_t    NextRandom      ( void ) noexcept;
+    void        ApplyStep       ( const ScriptStep& step, double dTime, InputSnapshot& snapshot ) const noexcept;
+};
+
+#endif
@@ -41,19 +41,10 @@ void CShip::Render(void) const noexcept
     eng::g_theRdr.DrawLine( eng::math::CVector2f( 25.f,    0.f),  eng::math::CVector2f( -6.25f,-10.f) );
     eng::g_theRdr.DrawLine( eng::math::CVector2f( -6.25f,-10.f),  eng::math::CVector2f( -6.25f, 10.f) );
 
-    const KeyboardState& kbState = g_theApp.GetKeyboardState();
-    // draw engine exhaust
-    if (kbState.IsKeyStateSet(Keys::W) || kbState.IsKeyStateSet(Keys::Up) ||
-        g_theApp.IsController_DPadUpPressed() || g_theApp.IsController_ThumbLPressed() )
-    {
-        eng::g_theRdr.SetColor( eng::RGBA_RED );
-
-        eng::g_theRdr.DrawLine( eng::math::CVector2f( -12.5f, 0.f),  eng::math::CVector2f( -6.25f, 10.f) );
-        eng::g_theRdr.DrawLine( eng::math::CVector2f( -12.5f, 0.f),  eng::math::CVector2f( -6.25f,-10.f) );
-    }
+    // engine exhaust is emitted as particles by CGame while IsThrusting()
 
     // draw an orientation overlay (for debugging purposes)
-    if (kbState.IsKeyStateSet(Keys::T))
+    if (g_theApp.GetActions().IsHeld(ACT_SHOW_AXES))
     {
         eng::g_theRdr.SetLineWidth( 0.5f );
         eng::g_theRdr.SetColor( eng::RGBA_WHITE );
@@ -67,12 +58,15 @@ void CShip::Render(void) const noexcept
 //-----------------------------------------------------------------------------------------------
 void CShip::Update(float fDeltaTime) noexcept
 {
-    const KeyboardState& kbState = g_theApp.GetKeyboardState();
-    bool bThrusting = false;
+    const ActionState& actions = g_theApp.GetActions();
+    bool  bThrusting = false;
+    float fThrottle  = 0.f;
 
-    if (kbState.IsKeyStateSet(Keys::W) || kbState.IsKeyStateSet(Keys::Up) || g_theApp.IsController_DPadUpPressed())
+    // a key tapped between two frames thrusts for the part of the tick it was held
+    if (actions.IsHeld(ACT_THRUST))
     {
-        ThrustForward(fDeltaTime, k_fShipThrust);
+        fThrottle  = actions.get_Amount(ACT_THRUST);
+        ThrustForward(fDeltaTime, k_fShipThrust * fThrottle);
         bThrusting = true;
     }
     else
@@ -82,12 +76,17 @@ void CShip::Update(float fDeltaTime) noexcept
         {
             ThrustForward(fDeltaTime, k_fShipThrust * fMagnitude);
             bThrusting = true;
+            fThrottle  = fMagnitude;
         }
     }
 
+    m_bThrusting = bThrusting;
+
     if (bThrusting)
     {
-        g_theApp.PlaySound(SND_ENGINE);
+        // the rumble rises with the thrust actually applied
+        g_theApp.SetSoundPitch(SND_ENGINE, k_fEnginePitchIdle + (k_fEnginePitchFull - k_fEnginePitchIdle) * fThrottle);
+        g_theApp.PlaySound(SND_ENGINE, get_Center());
     }
     else
     {
@@ -133,13 +132,10 @@ void CShip::Turn( float fDeltaTime ) noexcept
         // 1.0 means "turn counter-clockwise" (positive direction), -1.0 means "turn clockwise" (negative direction)
         float turnDirection = 0.f; 
 
-        const KeyboardState& kbState = g_theApp.GetKeyboardState();
-
-
-        if (kbState.IsKeyStateSet(Keys::A) || kbState.IsKeyStateSet(Keys::Left)  || g_theApp.IsController_DPadLeftPressed())
-            turnDirection += 1.f;
-        if (kbState.IsKeyStateSet(Keys::D) || kbState.IsKeyStateSet(Keys::Right) || g_theApp.IsController_DPadRightPressed())
-            turnDirection += -1.f;
+        // keys count for the part of the tick they were held
+        const ActionState& actions = g_theApp.GetActions();
+        turnDirection += actions.get_Amount(ACT_TURN_LEFT);
+        turnDirection -= actions.get_Amount(ACT_TURN_RIGHT);
 
         float degreesToTurnThisFrame = k_fShipTurnRate * fDeltaTime;
         degreesToTurnThisFrame *= turnDirection; // May be zero if not turning
@@ -22,6 +22,7 @@ class CShip :
     public eng::CActor2
 {
     DEGREES m_degOrientation;
+    bool    m_bThrusting;
 public:
     /// Default Constructor
     constexpr CShip() noexcept;
@@ -40,6 +41,12 @@ public:
     constexpr DEGREES  get_Orientation( void ) const noexcept
     { return m_degOrientation; };
 
+/**
+  *  @brief returns true if the engine fired during the last update
+  */
+    constexpr bool     IsThrusting    ( void ) const noexcept
+    { return m_bThrusting; };
+
 // IRenderable  
     void              Render         ( void ) const noexcept override;
     void              Update         ( float fDeltaTime ) noexcept override;
@@ -54,28 +61,32 @@ private:
 //-----------------------------------------------------------------------------------------------
 constexpr CShip::CShip () noexcept
     : eng::CActor2 (),
-      m_degOrientation ()
+      m_degOrientation (),
+      m_bThrusting (false)
 {
 };
 
 //-----------------------------------------------------------------------------------------------
 constexpr CShip::CShip (const CShip& o) noexcept
     : eng::CActor2 (o),
-      m_degOrientation (o.m_degOrientation)
+      m_degOrientation (o.m_degOrientation),
+      m_bThrusting (o.m_bThrusting)
 {
 };
 
 //-----------------------------------------------------------------------------------------------
 constexpr CShip::CShip (const eng::math::CVector2f& vPos, const eng::math::CVector2f& vVel) noexcept
     : eng::CActor2 (vPos, k_ShipRadius, vVel),
-      m_degOrientation ()
+      m_degOrientation (),
+      m_bThrusting (false)
 {
 };
 
 //-----------------------------------------------------------------------------------------------
 constexpr CShip::CShip (float fPosX, float fPosY, float fDeltaX, float fDeltaY) noexcept
     : eng::CActor2 (fPosX, fPosY, k_ShipRadius, fDeltaX, fDeltaY),
-      m_degOrientation ()
+      m_degOrientation (),
+      m_bThrusting (false)
 {
 };
 
@@ -0,0 +1,239 @@
+/**
+ *  @file       SoundEvents.cpp
+ *  @brief      CSoundEvents class implementation
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ */
+
+#define WIN32_LEAN_AND_MEAN
+#include "targetver.h"  // this needs to be the 1st header included
+#include "CommonDef.h"
+
+#include <Windows.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "Engine/Utility/BitUtils.h"
+
+#include "SoundManager.h"
+#include "SoundEvents.h"
+
+//-----------------------------------------------------------------------------------------------
+CSoundEvents::CSoundEvents( CSoundManager* pSoundManager ) noexcept
+    : m_pSoundManager(pSoundManager),
+      m_dTime(0.0),
+      m_nPendingMask(0),
+      m_nPositionedMask(0),
+      m_nLevelMask(0),
+      m_nPlayingMask(0),
+      m_Stats{ 0, 0, 0, 0, 0 }
+{
+    // far enough back that the first trigger of every sound passes the rate limit
+    for (auto& dLast : m_rgLastStarted)
+        dLast = -1.0e9;
+
+    memset(m_rgGainSq,    0, sizeof(m_rgGainSq));
+    memset(m_rgPosX,      0, sizeof(m_rgPosX));
+    memset(m_rgPosY,      0, sizeof(m_rgPosY));
+    memset(m_rgPosWeight, 0, sizeof(m_rgPosWeight));
+    memset(m_rgPitch,     0, sizeof(m_rgPitch));
+    memset(m_rgPitchSent, 0, sizeof(m_rgPitchSent));
+
+    for (auto& iInstance : m_rgLoopInstance)
+        iInstance = -1;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CSoundEvents::SetPitch( int iSound, float fPitch ) noexcept
+{
+    if (iSound >= 0 && iSound < k_nSoundEventSlots && k_rgSoundEvents[iSound].bLooped)
+        m_rgPitch[iSound] = fPitch;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CSoundEvents::Trigger( int iSound, const eng::math::CVector2f& vPosition, float fGain /* = 1.0f */ ) noexcept
+{
+    if (iSound < 0 || iSound >= k_nSoundEventSlots)
+        return;
+
+    m_nPositionedMask |= 1u << iSound;
+
+    if (k_rgSoundEvents[iSound].bLooped)
+    {
+        m_rgPosX[iSound] = vPosition.X;
+        m_rgPosY[iSound] = vPosition.Y;
+    }
+    else
+    {
+        const float fWeight = fGain * fGain;
+        m_rgPosX[iSound]      += vPosition.X * fWeight;
+        m_rgPosY[iSound]      += vPosition.Y * fWeight;
+        m_rgPosWeight[iSound] += fWeight;
+    }
+
+    Trigger(iSound, fGain);
+};
+
+//-----------------------------------------------------------------------------------------------
+void CSoundEvents::Trigger( int iSound, float fGain /* = 1.0f */ ) noexcept
+{
+    if (iSound < 0 || iSound >= k_nSoundEventSlots)
+        return;
+
+    const uint32_t nBit = 1u << iSound;
+
+    if (k_rgSoundEvents[iSound].bLooped)
+    {
+        m_nLevelMask |= nBit;
+        return;
+    }
+
+    m_Stats.nTriggers++;
+    if (m_nPendingMask & nBit)
+        m_Stats.nMerged++;
+
+    m_nPendingMask      |= nBit;
+    m_rgGainSq[iSound]  += fGain * fGain;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CSoundEvents::Release( int iSound ) noexcept
+{
+    if (iSound >= 0 && iSound < k_nSoundEventSlots && k_rgSoundEvents[iSound].bLooped)
+        m_nLevelMask &= ~(1u << iSound);
+};
+
+//-----------------------------------------------------------------------------------------------
+void CSoundEvents::Flush( float fDeltaTime ) noexcept
+{
+    m_dTime += fDeltaTime;
+
+    if (m_pSoundManager == nullptr)
+    {
+        ClearPending();
+        return;
+    }
+
+    for (uint32_t nMask = m_nPendingMask; nMask; nMask &= nMask - 1)
+    {
+        const int iSound = eng::util::LowestSetBit(nMask);
+
+        const SoundEventConfig& cfg = k_rgSoundEvents[iSound];
+
+        if (m_dTime - m_rgLastStarted[iSound] < cfg.fMinInterval)
+        {
+            m_Stats.nRateLimited++;
+        }
+        else
+        {
+            const float fGain = std::min(std::sqrt(m_rgGainSq[iSound]), cfg.fMaxGain);
+
+            // zero weight positions (all triggers at gain 0) fall back to centred
+            eng::math::CVector2f vCentroid;
+            const eng::math::CVector2f* pPosition = nullptr;
+            if ((m_nPositionedMask & (1u << iSound)) && m_rgPosWeight[iSound] > 0.0f)
+            {
+                vCentroid.X = m_rgPosX[iSound] / m_rgPosWeight[iSound];
+                vCentroid.Y = m_rgPosY[iSound] / m_rgPosWeight[iSound];
+                pPosition   = &vCentroid;
+            }
+
+            if (m_pSoundManager->Play(iSound, -1, fGain, pPosition) != -1)
+            {
+                m_rgLastStarted[iSound] = m_dTime;
+                m_Stats.nStarted++;
+            }
+        }
+
+    }
+
+    // looped sounds: act on edges only, and follow the source while held
+    const uint32_t nHeldMask = m_nLevelMask & m_nPlayingMask & m_nPositionedMask;
+
+    for (uint32_t nMask = m_nLevelMask ^ m_nPlayingMask; nMask; nMask &= nMask - 1)
+    {
+        const int iSound = eng::util::LowestSetBit(nMask);
+
+        const uint32_t nBit = 1u << iSound;
+        if (m_nLevelMask & nBit)
+        {
+            const eng::math::CVector2f vPosition(m_rgPosX[iSound], m_rgPosY[iSound]);
+
+            // a failed start is retried next frame
+            const int iInstance = m_pSoundManager->Loop(iSound, -1, 1.0f, (m_nPositionedMask & nBit) ? &vPosition : nullptr);
+            if (iInstance == -1)
+                continue;
+
+            // the voice may be a reused one, so its pitch is always set
+            m_pSoundManager->SetPitch(m_rgPitch[iSound], iInstance, iSound);
+            m_rgPitchSent[iSound]    = m_rgPitch[iSound];
+            m_rgLoopInstance[iSound] = iInstance;
+            m_nPlayingMask |= nBit;
+        }
+        else
+        {
+            m_pSoundManager->Stop(iSound);
+            m_rgLoopInstance[iSound] = -1;
+            m_nPlayingMask &= ~nBit;
+        }
+        m_Stats.nEdges++;
+    }
+
+    for (uint32_t nMask = m_nPlayingMask; nMask; nMask &= nMask - 1)
+    {
+        const int iSound = eng::util::LowestSetBit(nMask);
+        if (m_rgPitch[iSound] != m_rgPitchSent[iSound])
+        {
+            m_pSoundManager->SetPitch(m_rgPitch[iSound], m_rgLoopInstance[iSound], iSound);
+            m_rgPitchSent[iSound] = m_rgPitch[iSound];
+        }
+    }
+
+    for (uint32_t nMask = nHeldMask; nMask; nMask &= nMask - 1)
+    {
+        const int iSound = eng::util::LowestSetBit(nMask);
+        m_pSoundManager->SetPosition(iSound, eng::math::CVector2f(m_rgPosX[iSound], m_rgPosY[iSound]));
+    }
+
+    ClearPending();
+};
+
+//-----------------------------------------------------------------------------------------------
+void CSoundEvents::ClearPending( void ) noexcept
+{
+    for (uint32_t nMask = m_nPendingMask | m_nPositionedMask; nMask; nMask &= nMask - 1)
+    {
+        const int iSound = eng::util::LowestSetBit(nMask);
+
+        m_rgGainSq[iSound]    = 0.0f;
+        m_rgPosX[iSound]      = 0.0f;
+        m_rgPosY[iSound]      = 0.0f;
+        m_rgPosWeight[iSound] = 0.0f;
+    }
+
+    m_nPendingMask    = 0;
+    m_nPositionedMask = 0;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CSoundEvents::Reset( void ) noexcept
+{
+    if (m_pSoundManager)
+    {
+        for (uint32_t nMask = m_nPlayingMask; nMask; nMask &= nMask - 1)
+        {
+            m_pSoundManager->Stop(eng::util::LowestSetBit(nMask));
+        }
+    }
+
+    ClearPending();
+    m_nLevelMask   = 0;
+    m_nPlayingMask = 0;
+
+    for (auto& iInstance : m_rgLoopInstance)
+        iInstance = -1;
+};
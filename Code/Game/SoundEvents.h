@@ -0,0 +1,123 @@
+/**
+ *  @file       SoundEvents.h
+ *  @brief      CSoundEvents class interface
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ *  <b>Implementation:</b>
+ *
+ *   Game code reports sound triggers here instead of calling the sound
+ *   manager directly; Flush() turns one frame of triggers into backend
+ *   commands:
+ *
+ *    - one-shot triggers of the same sound are merged into one voice with
+ *      the RMS sum of their gains, so a wave breaking up in a single frame
+ *      starts one hit instead of dozens;
+ *    - a per-sound minimum interval (k_rgSoundEvents) rate limits what is
+ *      left; merged and rate limited triggers are counted;
+ *    - looped sounds are levels set by Trigger() / Release(); Loop and
+ *      Stop reach the sound manager only when the level changes.
+ *    - a trigger may carry a world position; merged one-shots play from
+ *      the gain weighted centroid of theirs, a positioned loop is moved
+ *      to its latest position every frame.
+ *    - a looped sound's pitch is sent when it starts and again only when
+ *      SetPitch() changes it.
+ */
+#pragma once
+
+#if !defined(__SOUND_EVENTS_H__)
+#define __SOUND_EVENTS_H__
+
+#ifndef _CSTDINT_
+    #include <cstdint>
+#endif
+
+#ifndef __SOUND_LIST_H__
+    #include "SoundList.h"
+#endif
+
+#ifndef __VECTOR2_H__
+    #include "Engine/Math/Vector2.h"
+#endif
+
+class CSoundManager;
+
+constexpr const int k_nSoundEventSlots = static_cast<int>(_countof(k_szSoundFiles));
+
+static_assert(k_nSoundEventSlots <= 32, "CSoundEvents keeps one bit per sound");
+
+/**
+ * @brief trigger accounting since startup
+ */
+struct SoundEventStats
+{
+    uint32_t nTriggers;         ///< Trigger() calls for one-shot sounds
+    uint32_t nMerged;           ///< triggers folded into another trigger of the same frame
+    uint32_t nRateLimited;      ///< frames of triggers dropped by the minimum interval
+    uint32_t nStarted;          ///< one-shot voices requested from the sound manager
+    uint32_t nEdges;            ///< Loop / Stop commands for looped sounds
+};
+
+class CSoundEvents
+{
+    CSoundManager*  m_pSoundManager;
+    double          m_dTime;                                ///< sum of Flush() deltas
+    double          m_rgLastStarted[k_nSoundEventSlots];    ///< m_dTime of the last voice started
+    float           m_rgGainSq[k_nSoundEventSlots];         ///< sum of squared gains this frame
+    float           m_rgPosX[k_nSoundEventSlots];           ///< squared gain weighted sums of positions,
+    float           m_rgPosY[k_nSoundEventSlots];           ///< or the latest position of a loop
+    float           m_rgPosWeight[k_nSoundEventSlots];      ///< squared gains of the positioned triggers
+    uint32_t        m_nPendingMask;                         ///< one-shots triggered this frame
+    uint32_t        m_nPositionedMask;                      ///< sounds with a position this frame
+    float           m_rgPitch[k_nSoundEventSlots];          ///< requested pitch of a loop, in octaves
+    float           m_rgPitchSent[k_nSoundEventSlots];      ///< pitch last given to its voice
+    int             m_rgLoopInstance[k_nSoundEventSlots];   ///< voice a playing loop started on
+    uint32_t        m_nLevelMask;                           ///< looped sounds requested on
+    uint32_t        m_nPlayingMask;                         ///< looped sounds started on the backend
+    SoundEventStats m_Stats;
+
+public:
+    /// Initialization constructor
+    explicit CSoundEvents( CSoundManager* pSoundManager ) noexcept;
+
+/**
+ *  @brief reports a sound; for a looped sound this sets its level on
+ *
+ *  @param [in] fGain    gain of this trigger, merged with the others of the frame
+ */
+    void Trigger            ( int iSound, float fGain = 1.0f ) noexcept;
+/**
+ *  @brief reports a sound heard from a world position
+ */
+    void Trigger            ( int iSound, const eng::math::CVector2f& vPosition, float fGain = 1.0f ) noexcept;
+/**
+ *  @brief sets the level of a looped sound off; ignored for one-shots
+ */
+    void Release            ( int iSound ) noexcept;
+/**
+ *  @brief sets the pitch of a looped sound, -1 .. +1 octave
+ */
+    void SetPitch           ( int iSound, float fPitch ) noexcept;
+/**
+ *  @brief issues the frame's merged commands, call once per frame
+ */
+    void Flush              ( float fDeltaTime ) noexcept;
+/**
+ *  @brief stops every looped sound and discards pending triggers
+ */
+    void Reset              ( void ) noexcept;
+
+    constexpr const SoundEventStats& get_Stats ( void ) const noexcept
+    { return m_Stats; };
+
+private:
+    void ClearPending       ( void ) noexcept;
+
+    /// Copy constructor
+    CSoundEvents( const CSoundEvents& ) = delete;
+    /// Assignment operator
+    CSoundEvents& operator = ( const CSoundEvents& ) = delete;
+};
+
+#endif
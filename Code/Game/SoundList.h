@@ -33,4 +33,56 @@ enum SOUND_T
     SND_EXPLOSION
 };
 
+/**
+ * @brief voice pool configuration of a sound
+ *
+ * A sound plays on at most nPolyphony voices at once. When every voice is busy
+ * a new request with bSteal set takes over the lowest priority voice, oldest
+ * first, provided that voice was not started at a higher priority than the
+ * request; otherwise the request is dropped.
+ */
+struct SoundVoiceConfig
+{
+    int  nPolyphony;    ///< voices created for the sound, 1 .. k_nMaxVoices
+    int  iPriority;     ///< default priority of a request, higher wins
+    bool bSteal;        ///< false drops requests while all voices are busy
+};
+
+/// indexed by SOUND_T, parallel to k_szSoundFiles
+const constexpr SoundVoiceConfig k_rgSoundVoices[] =
+{
+    { 1, 3, false },    // SND_ENGINE, one continuous voice; never restarted
+    { 8, 1, true  },    // SND_MISSILE_FIRE
+    { 6, 2, true  },    // SND_MISSILE_HIT
+    { 4, 2, true  }     // SND_EXPLOSION
+};
+
+static_assert(_countof(k_rgSoundVoices) == _countof(k_szSoundFiles), "k_rgSoundVoices must parallel k_szSoundFiles");
+
+/**
+ * @brief how game triggers of a sound reach the sound manager, see CSoundEvents
+ *
+ * Triggers of a one-shot sound within a frame are merged into a single
+ * voice whose gain is the RMS sum of the trigger gains, capped at fMaxGain.
+ * A looped sound is a level: it starts and stops only when the level
+ * changes between frames.
+ */
+struct SoundEventConfig
+{
+    float fMinInterval;     ///< seconds between voices started for the sound
+    float fMaxGain;         ///< cap on the merged gain of one frame
+    bool  bLooped;          ///< level triggered, played with CSoundManager::Loop
+};
+
+/// indexed by SOUND_T, parallel to k_szSoundFiles
+const constexpr SoundEventConfig k_rgSoundEvents[] =
+{
+    { 0.00f, 1.0f, true  },     // SND_ENGINE
+    { 0.05f, 1.0f, false },     // SND_MISSILE_FIRE
+    { 0.03f, 1.5f, false },     // SND_MISSILE_HIT
+    { 0.08f, 1.5f, false }      // SND_EXPLOSION
+};
+
+static_assert(_countof(k_rgSoundEvents) == _countof(k_szSoundFiles), "k_rgSoundEvents must parallel k_szSoundFiles");
+
 #endif
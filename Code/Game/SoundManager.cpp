@@ -16,19 +16,45 @@
 
 #include <stdio.h>
 #include <string>
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <fstream>
+#include <filesystem>
+#include <iterator>
+#include <vector>
+
+#include "Engine/Audio/AudioMixer.h"
+#include "Engine/Audio/WaveFile.h"
+#include "Engine/Utility/AssetPack.h"
+#include "Engine/Utility/BitUtils.h"
+#include "Engine/Utility/Hash.h"
 
 #include "SoundManager.h"
 
 extern TCHAR  g_szModulePath[MAX_PATH];
 
+//-----------------------------------------------------------------------------------------------
+/// @retval uint32_t   mask with the low nVoices bits set
+static inline uint32_t VoiceMask(int nVoices) noexcept
+{
+    return (nVoices >= 32) ? 0xFFFFFFFFu : ((1u << nVoices) - 1u);
+};
 
-CSoundManager::CSoundManager() noexcept
-    : m_nCount(0),
+
+CSoundManager::CSoundManager(eng::audio::CAudioMixer* pMixer /* = nullptr */) noexcept
+    : m_pAudioEngine(nullptr),
+      m_pMixer(pMixer),
+      m_Field(eng::audio::k_DefaultListenerField),
+      m_nCount(0),
+      m_nLastPlayedSound(-1),
       m_nLastPlayedInstance(-1),
-      m_nLastPlayedSound(-1)
+      m_nPlaySequence(0)
 {
-    memset(m_rgInstanceCount, 0, sizeof(m_rgInstanceCount));
-    memset(m_rgInstances, 0, sizeof(m_rgInstances));
+    memset(m_rgPools, 0, sizeof(m_rgPools));
+
+    if (m_pMixer)
+        return;
 
     ::CoInitializeEx(nullptr, COINIT_MULTITHREADED);
     AUDIO_ENGINE_FLAGS eflags = AudioEngine_Default;
@@ -51,18 +77,18 @@ CSoundManager::CSoundManager() noexcept
 
 CSoundManager::~CSoundManager()
 {
-    for (int i = 0; i < m_nCount; i++)
-    {
-        for (int j = 0; j < m_rgInstanceCount[i]; j++)
-        {
-            delete m_rgInstances[i][j];
-        }
-        delete [] m_rgInstances[i];
-    }
+    for (auto& pool : m_rgPools)
+        ReleaseVoices(pool);
 
     for (auto SndEffect : m_rgSoundEffects)
         delete SndEffect;
 
+    if (m_pMixer)
+    {
+        m_pMixer->StopAll();
+        return;
+    }
+
     delete m_pAudioEngine;
 
     ::CoUninitialize ();
@@ -93,15 +119,181 @@ int CSoundManager::Load(const wchar_t* szFileName) noexcept
     return iRetVal;
 }
 
-bool CSoundManager::InitSounds(void) noexcept
+SoundEffect* CSoundManager::CreateFromMemory(const eng::AssetView& view) noexcept
+{
+    eng::audio::WaveView wave;
+    if (!eng::audio::ParseWave(view.pData, view.nSize, wave))
+        return nullptr;
+
+    // SoundEffect takes ownership of its buffer, so the pack bytes are copied
+    // once: a WAVEFORMATEX (cbSize present) followed by the sample data
+    const size_t nFormatBytes = std::max<size_t>(wave.nFormatBytes, sizeof(WAVEFORMATEX));
+
+    SoundEffect* pSndEff = nullptr;
+    try
+    {
+        std::unique_ptr<uint8_t[]> pWavData(new uint8_t[nFormatBytes + wave.nSampleBytes]); // note - may throw an exception
+
+        memset(pWavData.get(), 0, nFormatBytes);
+        memcpy(pWavData.get(), wave.pFormat, wave.nFormatBytes);
+        memcpy(pWavData.get() + nFormatBytes, wave.pSamples, wave.nSampleBytes);
+
+        const WAVEFORMATEX* pwfx = reinterpret_cast<const WAVEFORMATEX*>(pWavData.get());
+        const uint8_t* pSamples  = pWavData.get() + nFormatBytes;
+
+        pSndEff = new SoundEffect(m_pAudioEngine, pWavData, pwfx, pSamples, wave.nSampleBytes);
+    }
+    catch (...)
+    {
+        delete pSndEff;
+        pSndEff = nullptr;
+    }
+
+    return pSndEff;
+}
+
+int CSoundManager::LoadFromMemory(const eng::AssetView& view) noexcept
+{
+    int iRetVal = -1;
+
+    SoundEffect* pSndEff = CreateFromMemory(view);
+    if (pSndEff)
+    {
+        try
+        {
+            m_rgSoundEffects.push_back (pSndEff);
+            iRetVal = static_cast<int>(m_rgSoundEffects.size() - 1);
+        }
+        catch (...)
+        {
+            delete pSndEff;
+        }
+    }
+
+    return iRetVal;
+}
+
+int CSoundManager::LoadIntoMixer(const eng::AssetView& view) noexcept
+{
+    int iRetVal = -1;
+
+    eng::audio::WaveView   wave;
+    eng::audio::PcmBuffer  pcm;
+    if (eng::audio::ParseWave(view.pData, view.nSize, wave))
+    {
+        try
+        {
+            if (eng::audio::DecodeWave(wave, pcm))
+                iRetVal = m_pMixer->AddSound(pcm);
+        }
+        catch (...)
+        {
+            iRetVal = -1;
+        }
+    }
+
+    return iRetVal;
+}
+
+bool CSoundManager::ReloadSound(uint64_t nNameHash, const eng::AssetView& view) noexcept
+{
+    int iIndex = -1;
+    for (int iCtr = 0; iCtr < m_nCount && iCtr < static_cast<int>(_countof(k_szSoundFiles)); iCtr++)
+    {
+        if (eng::util::HashPath(k_szSoundFiles[iCtr]) == nNameHash)
+        {
+            iIndex = iCtr;
+            break;
+        }
+    }
+
+    if (iIndex == -1)
+        return false;
+
+    VoicePool& pool = m_rgPools[iIndex];
+
+    if (m_pMixer)
+    {
+        eng::audio::WaveView  wave;
+        eng::audio::PcmBuffer pcm;
+        try
+        {
+            if (!eng::audio::ParseWave(view.pData, view.nSize, wave) || !eng::audio::DecodeWave(wave, pcm))
+                return false;
+        }
+        catch (...)
+        {
+            return false;
+        }
+
+        // the mixer stops the old voices as part of the swap
+        if (!m_pMixer->ReplaceSound(iIndex, pcm))
+            return false;
+
+        pool.nFreeMask = VoiceMask(pool.nVoices);
+        return true;
+    }
+
+    SoundEffect* pSndEff = CreateFromMemory(view);
+    if (pSndEff == nullptr)
+        return false;
+
+    // build the replacement voices first so a failure leaves the old sound playing
+    SoundEffectInstance* rgNewVoices[k_nMaxVoices] = { nullptr };
+    try
+    {
+        for (int i = 0; i < pool.nVoices; i++)
+            rgNewVoices[i] = pSndEff->CreateInstance(SoundEffectInstance_Default).release();
+    }
+    catch (...)
+    {
+        for (int i = 0; i < pool.nVoices; i++)
+            delete rgNewVoices[i];
+        delete pSndEff;
+        return false;
+    }
+
+    // voices reference the effect's sample buffer; they go first
+    for (int i = 0; i < pool.nVoices; i++)
+    {
+        pool.rgVoices[i]->Stop(true);
+        delete pool.rgVoices[i];
+        pool.rgVoices[i] = rgNewVoices[i];
+    }
+    pool.nFreeMask = VoiceMask(pool.nVoices);
+
+    delete m_rgSoundEffects[iIndex];
+    m_rgSoundEffects[iIndex] = pSndEff;
+
+    return true;
+}
+
+bool CSoundManager::InitSounds(const eng::CAssetPack* pAssetPack /* = nullptr */) noexcept
 {
     int iResult = -1;
     for (int iCtr = 0; iCtr < _countof (k_szSoundFiles); iCtr++)
     {
-        std::wstring szFileName(g_szModulePath);
-        szFileName += k_szSoundFiles[iCtr];
+        iResult = -1;
+
+        if (pAssetPack)
+        {
+            const eng::AssetView view = pAssetPack->Get(eng::util::HashPath(k_szSoundFiles[iCtr]));
+            if (view.IsValid() && view.eFormat == eng::AF_WAVE)
+            {
+                iResult = m_pMixer ? LoadIntoMixer(view) : LoadFromMemory(view);
+                if (iResult != -1)
+                    CreateInstances(iResult, GetVoiceConfig(iResult).nPolyphony, SoundEffectInstance_Default);
+            }
+        }
+
+        if (iResult == -1)
+        {
+            std::wstring szFileName(g_szModulePath);
+            szFileName += k_szSoundFiles[iCtr];
+
+            iResult = LoadAndCreateInstance(szFileName.c_str());
+        }
 
-        iResult = LoadAndCreateInstance(szFileName.c_str());
         if (iResult == -1)
             break;
     }
@@ -111,90 +303,275 @@ bool CSoundManager::InitSounds(void) noexcept
 
 int CSoundManager::LoadAndCreateInstance(const wchar_t* szFilename) noexcept
 {
-    auto iIndex = Load(szFilename);
+    int iIndex = -1;
+
+    if (m_pMixer)
+    {
+        try
+        {
+            std::ifstream file(std::filesystem::path(szFilename), std::ios::binary);
+            const std::vector<unsigned char> rgBytes((std::istreambuf_iterator<char>(file)),
+                                                     std::istreambuf_iterator<char>()); // note - may throw an exception
+
+            iIndex = LoadIntoMixer(eng::AssetView{ rgBytes.data(), rgBytes.size(), eng::AF_WAVE });
+        }
+        catch (...)
+        {
+            iIndex = -1;
+        }
+    }
+    else
+    {
+        iIndex = Load(szFilename);
+    }
 
     if (iIndex != -1)
-       CreateInstances(iIndex, 1, SoundEffectInstance_Default );
+       CreateInstances(iIndex, GetVoiceConfig(iIndex).nPolyphony, SoundEffectInstance_Default );
 
     return iIndex;
 }
 
 bool CSoundManager::Update(void) noexcept
 {
+    for (int i = 0; i < m_nCount; i++)
+        ReclaimVoices(m_rgPools[i]);
+
+    if (m_pMixer)
+        return m_pMixer->IsRunning();
+
     return m_pAudioEngine ? m_pAudioEngine->Update () : false;
 };
 
+bool CSoundManager::Reset(void) noexcept
+{
+    const bool bReset = m_pMixer ? m_pMixer->RestartOutput()
+                                 : (m_pAudioEngine ? m_pAudioEngine->Reset() : false);
+
+    if (bReset)
+    {
+        for (int i = 0; i < m_nCount; i++)
+            m_rgPools[i].nFreeMask = VoiceMask(m_rgPools[i].nVoices);
+    }
+
+    return bReset;
+};
+
 bool CSoundManager::IsAudioDevicePresent (void) const noexcept
 {
+    if (m_pMixer)
+        return m_pMixer->IsRunning();
+
     return m_pAudioEngine ? m_pAudioEngine->IsAudioDevicePresent () : false;
 };
 
 
+SoundVoiceConfig CSoundManager::GetVoiceConfig(int iIndex) noexcept
+{
+    if (iIndex >= 0 && iIndex < static_cast<int>(_countof(k_rgSoundVoices)))
+        return k_rgSoundVoices[iIndex];
+
+    return SoundVoiceConfig{ 1, 0, true };
+}
+
+
 void CSoundManager::CreateInstances(int iIndex, int iNumInstances, SOUND_EFFECT_INSTANCE_FLAGS flags) noexcept
 {
-    m_rgInstanceCount[iIndex] = iNumInstances;
-    m_rgInstances[iIndex] = new SoundEffectInstance*[iNumInstances];
+    VoicePool& pool = m_rgPools[iIndex];
+    ReleaseVoices(pool);
+
+    iNumInstances = std::min(std::max(iNumInstances, 1), k_nMaxVoices);
 
     try
     {
         for (int i = 0; i < iNumInstances; i++)
-            m_rgInstances[iIndex][i] = m_rgSoundEffects[iIndex]->CreateInstance(flags).release();
+        {
+            // mixer voices are claimed from the mixer as they start
+            if (m_pMixer == nullptr)
+                pool.rgVoices[i] = m_rgSoundEffects[iIndex]->CreateInstance(flags).release();
+            pool.nVoices++;
+        }
     }
     catch (...)
     {
-       return;
+        // keep the voices created so far; the sound plays with less polyphony
     }
 
-    m_nCount++;
+    pool.nFreeMask = VoiceMask(pool.nVoices);
+
+    if (pool.nVoices)
+        m_nCount++;
+}
+
+
+void CSoundManager::ReleaseVoices(VoicePool& pool) noexcept
+{
+    for (int i = 0; i < pool.nVoices; i++)
+        delete pool.rgVoices[i];
+
+    memset(&pool, 0, sizeof(pool));
 }
 
 
-int CSoundManager::GetNextInstance(int iIndex) noexcept
+bool CSoundManager::StartVoice(int iIndex, int iVoice, bool bStolen, bool bLoop, float fVolume, const eng::math::CVector2f* pPosition) noexcept
 {
-    int iInstance = 0; //current instance
+    VoicePool& pool = m_rgPools[iIndex];
+
+    if (m_pMixer == nullptr)
+    {
+        // voices are reused, so a centred sound resets the pan explicitly
+        float fPan         = 0.0f;
+        float fAttenuation = 1.0f;
+        if (pPosition)
+            eng::audio::CalcFieldGain(m_Field, pPosition->X, pPosition->Y, fPan, fAttenuation);
+
+        pool.rgVoices[iVoice]->SetVolume(fVolume * fAttenuation);
+        pool.rgVoices[iVoice]->SetPan(fPan);
+        pool.rgVoices[iVoice]->Play(bLoop);
+
+        pool.stats.nPlayed++;
+        if (bStolen)
+            pool.stats.nStolen++;
+        return true;
+    }
+
+    // the mixer pans positional voices itself, once per block
+    pool.rgMixerVoices[iVoice] = pPosition ? m_pMixer->PlayAt(iIndex, pPosition->X, pPosition->Y, fVolume, bLoop)
+                                           : m_pMixer->Play(iIndex, fVolume, 0.0f, bLoop);
+    if (pool.rgMixerVoices[iVoice] != 0)
+    {
+        pool.stats.nPlayed++;
+        if (bStolen)
+            pool.stats.nStolen++;
+        return true;
+    }
+
+    // the mixer itself is out of voices; hand the slot back and count a drop
+    pool.nFreeMask |= (1u << iVoice);
+    pool.stats.nDropped++;
+    return false;
+}
+
+
+void CSoundManager::StopVoice(VoicePool& pool, int iVoice) noexcept
+{
+    if (m_pMixer)
+        m_pMixer->Stop(pool.rgMixerVoices[iVoice]);
+    else if (pool.rgVoices[iVoice] != nullptr)
+        pool.rgVoices[iVoice]->Stop(true);
+}
+
+
+bool CSoundManager::IsVoicePlaying(const VoicePool& pool, int iVoice) const noexcept
+{
+    if (m_pMixer)
+        return m_pMixer->IsPlaying(pool.rgMixerVoices[iVoice]);
+
+    return pool.rgVoices[iVoice]->GetState() == PLAYING;
+}
+
+
+void CSoundManager::ReclaimVoices(VoicePool& pool) noexcept
+{
+    // only busy voices are polled
+    uint32_t nBusy = ~pool.nFreeMask & VoiceMask(pool.nVoices);
+    while (nBusy)
+    {
+        const int iVoice = eng::util::LowestSetBit(nBusy);
+        nBusy &= nBusy - 1;
+
+        if (!IsVoicePlaying(pool, iVoice))
+            pool.nFreeMask |= (1u << iVoice);
+    }
+}
+
+
+int CSoundManager::AcquireVoice(int iIndex, int iPriority, bool& bStolen) noexcept
+{
+    VoicePool& pool = m_rgPools[iIndex];
+
+    bStolen = false;
+
+    if (pool.nFreeMask == 0)
+        ReclaimVoices(pool);
+
+    int iVoice = eng::util::LowestSetBit(pool.nFreeMask);
+    if (iVoice != -1)
+    {
+        pool.nFreeMask &= ~(1u << iVoice);
+    }
+    else if (pool.nVoices && GetVoiceConfig(iIndex).bSteal)
+    {
+        // lowest priority first, oldest among equals
+        int iVictim = 0;
+        for (int i = 1; i < pool.nVoices; i++)
+        {
+            if (pool.rgPriority[i] < pool.rgPriority[iVictim] ||
+               (pool.rgPriority[i] == pool.rgPriority[iVictim] && pool.rgStarted[i] < pool.rgStarted[iVictim]))
+                iVictim = i;
+        }
 
-    //get status of first instance
-    SoundState soundState = m_rgInstances[iIndex][iInstance]->GetState();
+        if (pool.rgPriority[iVictim] <= iPriority)
+        {
+            StopVoice(pool, iVictim);
+            bStolen = true;
+            iVoice  = iVictim;
+        }
+    }
 
-    //find next unplayed instance, if any
-    while (iInstance < m_rgInstanceCount[iIndex] && ( soundState == PLAYING )) //while current copy in use
+    if (iVoice == -1)
     {
-        if (++iInstance < m_rgInstanceCount[iIndex]) //go to next copy
-            soundState = m_rgInstances[iIndex][iInstance]->GetState();
+        pool.stats.nDropped++;
+        return -1;
     }
-    return iInstance;
+
+    pool.rgPriority[iVoice] = iPriority;
+    pool.rgStarted[iVoice]  = ++m_nPlaySequence;
+
+    return iVoice;
 }
 
 
-int CSoundManager::Play(int iIndex) noexcept
+int CSoundManager::Play(int iIndex, int iPriority /* = -1 */, float fVolume /* = 1.0f */,
+                        const eng::math::CVector2f* pPosition /* = nullptr */) noexcept
 {
     if (iIndex < 0 || iIndex >= m_nCount)
         return -1; //bail if bad index
 
-    int iInstance = GetNextInstance(iIndex);
-    if (iInstance < m_rgInstanceCount[iIndex]) //if unused copy found
-        m_rgInstances[iIndex][iInstance]->Play(); //Play it
+    if (iPriority == -1)
+        iPriority = GetVoiceConfig(iIndex).iPriority;
 
-    m_nLastPlayedSound = iIndex;
-    m_nLastPlayedInstance = iInstance;
+    bool bStolen   = false;
+    int  iInstance = AcquireVoice(iIndex, iPriority, bStolen);
+    if (iInstance != -1 && StartVoice(iIndex, iInstance, bStolen, false, fVolume, pPosition)) //Play it
+    {
+        m_nLastPlayedSound = iIndex;
+        m_nLastPlayedInstance = iInstance;
+        return iInstance;
+    }
 
-    return iInstance;
+    return -1;
 }
 
 
-int CSoundManager::Loop(int iIndex) noexcept
+int CSoundManager::Loop(int iIndex, int iPriority /* = -1 */, float fVolume /* = 1.0f */,
+                        const eng::math::CVector2f* pPosition /* = nullptr */) noexcept
 {
     if (iIndex < 0 || iIndex >= m_nCount)
         return -1; //bail if bad index
 
-    int iInstance = GetNextInstance(iIndex);
-    if (iInstance < m_rgInstanceCount[iIndex]) //if unused copy found
-        m_rgInstances[iIndex][iInstance]->Play(true); //Play it looped
+    if (iPriority == -1)
+        iPriority = GetVoiceConfig(iIndex).iPriority;
 
-    m_nLastPlayedSound = iIndex;
-    m_nLastPlayedInstance = iInstance;
+    bool bStolen   = false;
+    int  iInstance = AcquireVoice(iIndex, iPriority, bStolen);
+    if (iInstance != -1 && StartVoice(iIndex, iInstance, bStolen, true, fVolume, pPosition)) //Play it looped
+    {
+        m_nLastPlayedSound = iIndex;
+        m_nLastPlayedInstance = iInstance;
+        return iInstance;
+    }
 
-    return iInstance;
+    return -1;
 }
 
 void CSoundManager::Stop(int iIndex) noexcept
@@ -202,16 +579,75 @@ void CSoundManager::Stop(int iIndex) noexcept
     if (iIndex < 0 || iIndex >= m_nCount)
         return; //bail if bad index
 
-    for (int iInstance = 0; iInstance < m_rgInstanceCount[iIndex]; iInstance++)
+    VoicePool& pool = m_rgPools[iIndex];
+    for (int iInstance = 0; iInstance < pool.nVoices; iInstance++)
+        StopVoice(pool, iInstance);
+
+    pool.nFreeMask = VoiceMask(pool.nVoices);
+}
+
+
+void CSoundManager::SetPosition(int iIndex, const eng::math::CVector2f& vPosition) noexcept
+{
+    if (iIndex < 0 || iIndex >= m_nCount)
+        return; //bail if bad index
+
+    VoicePool& pool = m_rgPools[iIndex];
+
+    float fPan         = 0.0f;
+    float fAttenuation = 1.0f;
+    if (m_pMixer == nullptr)
+        eng::audio::CalcFieldGain(m_Field, vPosition.X, vPosition.Y, fPan, fAttenuation);
+
+    uint32_t nBusy = ~pool.nFreeMask & VoiceMask(pool.nVoices);
+    while (nBusy)
     {
-        SoundEffectInstance* p = m_rgInstances[iIndex][iInstance];
-        if (p != nullptr)
-            p->Stop();
+        const int iVoice = eng::util::LowestSetBit(nBusy);
+        nBusy &= nBusy - 1;
+
+        if (m_pMixer)
+            m_pMixer->SetPosition(pool.rgMixerVoices[iVoice], vPosition.X, vPosition.Y);
+        else
+            pool.rgVoices[iVoice]->SetPan(fPan);    // the start volume is kept; only the pan follows
     }
 }
 
 
-void CSoundManager::SetPitch(float fPitch, int iInstance /* = -1 */, int iIndex /* = -1 */)
+void CSoundManager::SetListenerField(float fLeft, float fBottom, float fRight, float fTop) noexcept
+{
+    const eng::audio::ListenerField field = { fLeft, fBottom, fRight, fTop, eng::audio::k_fFieldRolloff };
+    if (!field.IsValid())
+        return;
+
+    m_Field = field;
+    if (m_pMixer)
+        m_pMixer->SetListenerField(field);
+}
+
+
+VoiceStats CSoundManager::get_VoiceStats(int iIndex) const noexcept
+{
+    if (iIndex < 0 || iIndex >= m_nCount)
+        return VoiceStats{ 0, 0, 0 };
+
+    return m_rgPools[iIndex].stats;
+}
+
+
+VoiceStats CSoundManager::get_VoiceStats(void) const noexcept
+{
+    VoiceStats total = { 0, 0, 0 };
+    for (int i = 0; i < m_nCount; i++)
+    {
+        total.nPlayed  += m_rgPools[i].stats.nPlayed;
+        total.nStolen  += m_rgPools[i].stats.nStolen;
+        total.nDropped += m_rgPools[i].stats.nDropped;
+    }
+    return total;
+}
+
+
+void CSoundManager::SetPitch(float fPitch, int iInstance /* = -1 */, int iIndex /* = -1 */) noexcept
 {
     if (iIndex == -1)
         iIndex = m_nLastPlayedSound;
@@ -219,8 +655,25 @@ void CSoundManager::SetPitch(float fPitch, int iInstance /* = -1 */, int iIndex
     if (iInstance == -1)
         iInstance = m_nLastPlayedInstance;
 
-    if (iInstance >= 0 && iInstance < m_rgInstanceCount[iIndex])
-        m_rgInstances[iIndex][iInstance]->SetPitch(fPitch);
+    if (iIndex < 0 || iIndex >= m_nCount || iInstance < 0 || iInstance >= m_rgPools[iIndex].nVoices)
+        return;
+
+    fPitch = std::min(std::max(fPitch, -1.0f), 1.0f);
+
+    if (m_pMixer)
+    {
+        m_pMixer->SetPitch(m_rgPools[iIndex].rgMixerVoices[iInstance], std::exp2(fPitch));
+        return;
+    }
+
+    try
+    {
+        m_rgPools[iIndex].rgVoices[iInstance]->SetPitch(fPitch);
+    }
+    catch (...)
+    {
+        // instance created with SoundEffectInstance_NoSetPitch
+    }
 }
 
 
@@ -232,6 +685,11 @@ void CSoundManager::SetVolume(float fVolume, int iInstance /* = -1 */, int iInde
     if (iInstance == -1)
         iInstance = m_nLastPlayedInstance;
 
-    if (iInstance >= 0 && iInstance < m_rgInstanceCount[iIndex])
-        m_rgInstances[iIndex][iInstance]->SetVolume(fVolume);
-}
\ No newline at end of file
+    if (iIndex >= 0 && iIndex < m_nCount && iInstance >= 0 && iInstance < m_rgPools[iIndex].nVoices)
+    {
+        if (m_pMixer)
+            m_pMixer->SetVolume(m_rgPools[iIndex].rgMixerVoices[iInstance], fVolume);
+        else
+            m_rgPools[iIndex].rgVoices[iInstance]->SetVolume(fVolume);
+    }
+}
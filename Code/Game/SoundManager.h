@@ -23,32 +23,91 @@
     #include "Soundlist.h" //list of sound names
 #endif
 
+#ifndef __VECTOR2_H__
+    #include "Engine/Math/Vector2.h"
+#endif
+
+#ifndef __LISTENER_FIELD_H__
+    #include "Engine/Audio/ListenerField.h"
+#endif
+
+// forward declaration
+namespace eng
+{
+class CAssetPack;
+struct AssetView;
+
+namespace audio
+{
+class CAudioMixer;
+}
+}
+
 using namespace DirectX;
 
 constexpr const size_t k_nMaxSounds = 20;
+constexpr const int    k_nMaxVoices = 32;   ///< polyphony limit per sound, one bit each in a voice mask
+
+/**
+ * @brief voice allocation counters of a sound
+ */
+struct VoiceStats
+{
+    uint32_t nPlayed;       ///< requests that started a voice, including stolen ones
+    uint32_t nStolen;       ///< requests that cut off a busy voice to start
+    uint32_t nDropped;      ///< requests discarded because every voice was busy
+};
+
+/**
+ * @brief the fixed set of voices a sound plays on
+ *
+ * A set bit in nFreeMask marks an idle voice, so acquiring one is a single
+ * bit scan. Voices that finished playing are returned to the mask by
+ * CSoundManager::Update, or on demand when the mask runs empty.
+ */
+struct VoicePool
+{
+    SoundEffectInstance* rgVoices[k_nMaxVoices];       ///< DirectXTK voices
+    uint32_t             rgMixerVoices[k_nMaxVoices];  ///< eng::audio::MixerVoice handles in mixer mode
+    uint64_t             rgStarted[k_nMaxVoices];   ///< play sequence at start, smaller is older
+    int                  rgPriority[k_nMaxVoices];  ///< priority the voice was started at
+    uint32_t             nFreeMask;                 ///< bit i set when rgVoices[i] is idle
+    int                  nVoices;
+    VoiceStats           stats;
+};
 
 /// @brief The sound manager.
 ///
 /// The sound manager allows you to Play multiple
 /// overlapping copies of sounds simultaneously.
 /// It can load WAV format sounds.
+///
+/// Sounds play through DirectXTK / XAudio2 by default, or through the
+/// portable eng::audio::CAudioMixer when one is passed to the constructor;
+/// voice pools, priorities and stealing behave the same either way.
 class CSoundManager
 {
 private:
     AudioEngine*              m_pAudioEngine; ///< XAudio 2.8 Engine wrapped up in DirectXTK.
+    eng::audio::CAudioMixer*  m_pMixer;       ///< Software mixer, replaces m_pAudioEngine when set.
     std::vector<SoundEffect*> m_rgSoundEffects; ///< A list of sound effect.
-    SoundEffectInstance**     m_rgInstances[k_nMaxSounds]; ///< A list of arrays of sound effect instances.
-
-    int m_rgInstanceCount[k_nMaxSounds]; ///< Number of copies of each sound.
+    VoicePool                 m_rgPools[k_nMaxSounds]; ///< Voices of each sound.
+    eng::audio::ListenerField m_Field;        ///< Playfield sound positions are relative to.
 
-    int m_nCount;              ///< Number of sounds loaded.
-    int m_nLastPlayedSound;    ///< Last sound played.
-    int m_nLastPlayedInstance; ///< Instance of the last sound played.
+    int      m_nCount;              ///< Number of sounds loaded.
+    int      m_nLastPlayedSound;    ///< Last sound played.
+    int      m_nLastPlayedInstance; ///< Instance of the last sound played.
+    uint64_t m_nPlaySequence;       ///< Incremented per voice started, orders voices by age.
 
 /**
  *  Create sound instances
  */
     void CreateInstances(int iIndex, int nNumInstances, SOUND_EFFECT_INSTANCE_FLAGS flags) noexcept;
+/**
+ *  @retval SoundVoiceConfig   k_rgSoundVoices entry of the sound, a single
+ *                             stealable voice for sounds not listed there
+ */
+    static SoundVoiceConfig GetVoiceConfig(int iIndex) noexcept;
 /**
  *  Load sound from file
  *
@@ -57,23 +116,80 @@ private:
  */
     int  Load(const wchar_t* szWaveFileName) noexcept;
 /**
- *  Get the next instance that is not playing
+ *  Load sound from a packed RIFF WAVE image
+ *
+ *  @retval int  containing sound file index
+ *  @retval -1   on error
+ */
+    int  LoadFromMemory(const eng::AssetView& view) noexcept;
+/**
+ *  Decode a RIFF WAVE image into the software mixer
+ *
+ *  @retval int  containing sound file index
+ *  @retval -1   on error
  */
-    int  GetNextInstance(int iIndex) noexcept;
+    int  LoadIntoMixer(const eng::AssetView& view) noexcept;
+/**
+ *  Create a sound effect from a RIFF WAVE image
+ *
+ *  @retval SoundEffect*  owned by the caller
+ *  @retval nullptr       on error
+ */
+    SoundEffect* CreateFromMemory(const eng::AssetView& view) noexcept;
+/**
+ *  Takes a voice of the sound, stealing one if its configuration allows
+ *
+ *  @param [out] bStolen  set when the voice was taken from a playing sound
+ *
+ *  @retval int   containing voice index
+ *  @retval -1    if every voice is busy and none may be stolen
+ */
+    int  AcquireVoice(int iIndex, int iPriority, bool& bStolen) noexcept;
+/**
+ *  Starts, stops or polls voice iVoice of a sound on whichever backend is active;
+ *  StartVoice counts the play, and the steal if bStolen, only once the voice is running
+ */
+    bool StartVoice(int iIndex, int iVoice, bool bStolen, bool bLoop, float fVolume, const eng::math::CVector2f* pPosition) noexcept;
+    void StopVoice(VoicePool& pool, int iVoice) noexcept;
+    bool IsVoicePlaying(const VoicePool& pool, int iVoice) const noexcept;
+/**
+ *  Returns voices that stopped playing to the free mask
+ */
+    void ReclaimVoices(VoicePool& pool) noexcept;
+/**
+ *  Destroys the voices of a pool and clears it
+ */
+    static void ReleaseVoices(VoicePool& pool) noexcept;
 
 public:
-    /// Default Constructor
-    CSoundManager() noexcept;
+/**
+ *  @param [in] pMixer   not owned; when set, sounds play through it and no
+ *                       XAudio2 engine is created
+ */
+    explicit CSoundManager(eng::audio::CAudioMixer* pMixer = nullptr) noexcept;
     /// Default Destructor
     ~CSoundManager();
 
 /**
  *  Initialize and allocates sound file resources
  *
+ *  @param [in] pAssetPack   searched first when not nullptr; sounds missing
+ *                           from it are loaded from loose files
+ *
  *  @retval true    on success
  *  @retval false   on error
  */
-    bool InitSounds(void) noexcept;
+    bool InitSounds(const eng::CAssetPack* pAssetPack = nullptr) noexcept;
+/**
+ *  Replaces the sample data of a loaded sound in place; the sound keeps
+ *  its index, any of its voices that were playing are stopped
+ *
+ *  @param [in] nNameHash   eng::util::HashPath() of its k_szSoundFiles entry
+ *
+ *  @retval true    on success
+ *  @retval false   if no loaded sound matches or the data is invalid
+ */
+    bool ReloadSound(uint64_t nNameHash, const eng::AssetView& view) noexcept;
 /**
  *  @param [in] szWaveFilename   wav file name
  *
@@ -95,27 +211,58 @@ public:
  *  @retval false  if in 'silent mode'
  */
     bool Update(void) noexcept;
+/**
+ *  Tries to bring output back after Update() failed: resets the XAudio2
+ *  engine or restarts the mixer's sink. Every voice is left stopped, so
+ *  looped sounds must be started again.
+ *
+ *  @retval true   if output is running again
+ */
+    bool Reset(void) noexcept;
 
 /**
  *  Play a sound
  *
+ *  @param [in] iPriority    -1 uses the sound's k_rgSoundVoices default
+ *  @param [in] fVolume      gain of the voice, 1 is unattenuated
+ *  @param [in] pPosition    world position to pan and attenuate from,
+ *                           nullptr plays centred
+ *
  *  @retval int   containing instance played
- *  @retval -1    on error
+ *  @retval -1    on error, or when dropped for lack of a voice
  */
-    int  Play(int iIndex) noexcept;
-    int  Loop(int iIndex) noexcept; ///< Play a sound looped.
+    int  Play(int iIndex, int iPriority = -1, float fVolume = 1.0f, const eng::math::CVector2f* pPosition = nullptr) noexcept;
+    int  Loop(int iIndex, int iPriority = -1, float fVolume = 1.0f, const eng::math::CVector2f* pPosition = nullptr) noexcept; ///< Play a sound looped.
     void Stop(int iIndex) noexcept; ///< Stop a sound.
+/**
+ *  Moves every playing voice of a sound, e.g. a loop following its source
+ */
+    void SetPosition(int iIndex, const eng::math::CVector2f& vPosition) noexcept;
+/**
+ *  Sets the playfield positions are relative to, normally the view extents
+ */
+    void SetListenerField(float fLeft, float fBottom, float fRight, float fTop) noexcept;
+
+/**
+ *  @retval VoiceStats   counters of the sound, zeroed for a bad index
+ */
+    VoiceStats get_VoiceStats(int iIndex) const noexcept;
+/**
+ *  @retval VoiceStats   counters summed over every sound
+ */
+    VoiceStats get_VoiceStats(void) const noexcept;
 
 /**
  *  Sets a pitch-shift factor. 
  * 
- *  @param [in] fPitch       Ranges from -1 to +1, playback defaults to 0 (which is no pitch-shifting).
+ *  @param [in] fPitch       Ranges from -1 to +1 octave, playback defaults to 0 (which is no pitch-shifting).
  *  @param [in] iInstance
  *  @param [in] iIndex
  *
- *  This will trigger a C++ exception if the object was created with SoundEffectInstance_NoSetPitch
+ *  In mixer mode the voice is resampled by the mixer.  A DirectXTK voice
+ *  created with SoundEffectInstance_NoSetPitch keeps its pitch.
  */
-    void SetPitch (float fPitch, int iInstance = -1, int iIndex = -1);
+    void SetPitch (float fPitch, int iInstance = -1, int iIndex = -1) noexcept;
 /**
  *  Sets playback volume. Playback defaults to 1
  */
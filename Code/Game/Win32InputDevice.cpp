@@ -0,0 +1,116 @@
+/**
+ *  @file       Win32InputDevice.cpp
+ *  @brief      CWin32InputDevice class implementation
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ * <b>Cite:</b>
+ *
+ * @sa https://docs.microsoft.com/en-us/windows/win32/api/winuser/nf-winuser-getasynckeystate
+ */
+
+#define WIN32_LEAN_AND_MEAN
+#include "targetver.h"  // this needs to be the 1st header included
+#include "CommonDef.h"
+
+#include <cstring>
+
+#ifdef _WIN32
+    #include <Windows.h>
+    #include <Xinput.h>
+
+    #pragma comment( lib, "Xinput9_1_0" )
+#endif
+
+#include "Win32InputDevice.h"
+
+#ifdef _WIN32
+static_assert(sizeof(PadState) == sizeof(XINPUT_GAMEPAD), "PadState must mirror XINPUT_GAMEPAD");
+static_assert(PAD_A == XINPUT_GAMEPAD_A && PAD_DPAD_UP == XINPUT_GAMEPAD_DPAD_UP &&
+              PAD_RIGHT_SHOULDER == XINPUT_GAMEPAD_RIGHT_SHOULDER, "PAD_BUTTON_T must use the XInput bits");
+#endif
+
+//-----------------------------------------------------------------------------------------------
+CWin32InputDevice::CWin32InputDevice() noexcept
+    : m_bOpen(false),
+      m_nConnectedPads(0),
+      m_rgNextProbe{}
+{
+};
+
+#ifdef _WIN32
+
+//-----------------------------------------------------------------------------------------------
+bool CWin32InputDevice::Open( void ) noexcept
+{
+    m_bOpen          = true;
+    m_nConnectedPads = ~0u;     // the first poll probes every slot
+    memset(m_rgNextProbe, 0, sizeof(m_rgNextProbe));
+    return true;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CWin32InputDevice::Close( void ) noexcept
+{
+    m_bOpen = false;
+};
+
+//-----------------------------------------------------------------------------------------------
+bool CWin32InputDevice::Poll( double, InputSnapshot& snapshot ) noexcept
+{
+    if (!m_bOpen)
+        return false;
+
+    snapshot = InputSnapshot{};
+
+    for (int iKey = 1; iKey <= static_cast<int>(Keys::OemClear); iKey++)
+    {
+        if (::GetAsyncKeyState(iKey) & 0x8000)
+            snapshot.stKeyboard.SetKeyState(static_cast<Keys>(iKey), true);
+    }
+
+    const uint32_t nNow = static_cast<uint32_t>( ::GetTickCount() );
+    for (DWORD i = 0; i < k_nMaxInputPads; i++)
+    {
+        const uint32_t nBit = 1u << i;
+        if (!(m_nConnectedPads & nBit) && static_cast<int32_t>(nNow - m_rgNextProbe[i]) < 0)
+            continue;
+
+        XINPUT_STATE state = { 0 };
+        if (::XInputGetState(i, &state) == ERROR_SUCCESS)
+        {
+            memcpy(&snapshot.rgPads[i], &state.Gamepad, sizeof(PadState));
+            m_nConnectedPads |= nBit;
+        }
+        else
+        {
+            m_nConnectedPads &= ~nBit;
+            m_rgNextProbe[i]  = nNow + k_nControllerProbeMs;
+        }
+    }
+    snapshot.nConnectedPads = m_nConnectedPads & ((1u << k_nMaxInputPads) - 1);
+
+    return true;
+};
+
+#else
+
+//-----------------------------------------------------------------------------------------------
+bool CWin32InputDevice::Open( void ) noexcept
+{
+    return false;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CWin32InputDevice::Close( void ) noexcept
+{
+};
+
+//-----------------------------------------------------------------------------------------------
+bool CWin32InputDevice::Poll( double, InputSnapshot& ) noexcept
+{
+    return false;
+};
+
+#endif
@@ -0,0 +1,42 @@
+/**
+ *  @file       Win32InputDevice.h
+ *  @brief      CWin32InputDevice class interface
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ *  <b>Implementation:</b>
+ *
+ *   Polls the async key state of every virtual key and XInput for each
+ *   pad, independent of the message pump.  A slot that reported no pad is
+ *   only probed again every k_nControllerProbeMs, since XInputGetState on
+ *   an empty slot stalls for milliseconds.  Other platforms have no Win32
+ *   backend; Open() fails there.
+ */
+#pragma once
+
+#if !defined(__WIN32_INPUT_DEVICE_H__)
+#define __WIN32_INPUT_DEVICE_H__
+
+#ifndef __INPUT_DEVICE_H__
+    #include "InputDevice.h"
+#endif
+
+class CWin32InputDevice : public IInputDevice
+{
+    bool     m_bOpen;
+    uint32_t m_nConnectedPads;
+    uint32_t m_rgNextProbe[k_nMaxInputPads];    ///< tick count an empty slot is probed again at
+
+public:
+    /// Default constructor
+    CWin32InputDevice() noexcept;
+
+    bool        Open        ( void ) noexcept override;
+    void        Close       ( void ) noexcept override;
+    bool        Poll        ( double dTime, InputSnapshot& snapshot ) noexcept override;
+    const char* get_Name    ( void ) const noexcept override
+    { return "win32"; };
+};
+
+#endif
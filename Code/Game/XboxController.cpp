@@ -39,6 +39,31 @@ bool CXboxController::UpdateControllerState(void) noexcept
      return m_bConnected;
 };
 
+//-----------------------------------------------------------------------------------------------
+void CXboxController::SetControllerState(const XINPUT_STATE& state, bool bConnected) noexcept
+{
+     m_stLast     = m_stInput;
+     m_stInput    = state;
+     m_dwResult   = bConnected ? ERROR_SUCCESS : ERROR_DEVICE_NOT_CONNECTED;
+     m_bConnected = bConnected;
+};
+
+//-----------------------------------------------------------------------------------------------
+void CXboxController::ApplyRadialDeadZone(void) noexcept
+{
+     if (!IsThumbL_Pressed())
+     {
+         m_stInput.Gamepad.sThumbLX = 0;
+         m_stInput.Gamepad.sThumbLY = 0;
+     }
+
+     if (!IsThumbR_Pressed())
+     {
+         m_stInput.Gamepad.sThumbRX = 0;
+         m_stInput.Gamepad.sThumbRY = 0;
+     }
+};
+
 //-----------------------------------------------------------------------------------------------
 bool CXboxController::IsThumbL_Pressed(void) const noexcept
 {
@@ -33,6 +33,19 @@ public:
     ~CXboxController() noexcept;
 
     bool  UpdateControllerState(void) noexcept;
+
+/**
+ *  @brief installs a state in place of polling XInput, as input replay does
+ */
+    void  SetControllerState   (const XINPUT_STATE& state, bool bConnected) noexcept;
+
+/**
+ *  @brief centres a thumbstick whose deflection is inside its dead zone circle
+ *
+ *  A stick outside the circle keeps its raw value; CalcThumbL_Magnitude()
+ *  and CalcThumbR_Magnitude() rescale the range past the dead zone.
+ */
+    void  ApplyRadialDeadZone  (void) noexcept;
     
     bool  IsThumbL_Pressed     (void) const noexcept;
 
@@ -0,0 +1,76 @@
+/**
+ *  @file       PackBuilder.cpp
+ *  @brief      command line asset pack builder
+ *
+ *  @author     Mark L. Short
+ *  @date       October 19, 2026
+ *
+ *  <b>Usage:</b>
+ *
+ *      PackBuilder <output.pak> <deploy root>
+ *
+ *   Every file below the deploy root is packed under its path relative to
+ *   that root, e.g. "Assets\\Audio\\Fire.wav", which is the same relative
+ *   name the game resolves against g_szModulePath.  Build the pack from the
+ *   output directory after the post-build copy and ship it as Assets.pak
+ *   next to the executable.
+ */
+
+// turn off silly warnings that encourage use of xxxx_s functions
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <filesystem>
+#include <string>
+
+#include "Engine/Utility/AssetPack.h"
+
+namespace fs = std::filesystem;
+
+//-----------------------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    if (argc != 3)
+    {
+        fprintf(stderr, "usage: PackBuilder <output.pak> <deploy root>\n");
+        return 1;
+    }
+
+    const fs::path pathPack(argv[1]);
+    const fs::path pathRoot(argv[2]);
+
+    try
+    {
+        eng::CAssetPackBuilder builder;
+
+        for (const fs::directory_entry& entry : fs::recursive_directory_iterator(pathRoot))
+        {
+            if (!entry.is_regular_file())
+                continue;
+
+            // never pack a previous build of the output into itself
+            if (fs::exists(pathPack) && fs::equivalent(entry.path(), pathPack))
+                continue;
+
+            const std::string strFile = entry.path().string();
+            const std::string strName = entry.path().lexically_relative(pathRoot).string();
+
+            builder.AddFile(strName.c_str(), strFile.c_str(),
+                            eng::CAssetPackBuilder::FormatFromExtension(strFile.c_str()));
+        }
+
+        if (!builder.Write(pathPack.string().c_str()))
+        {
+            fprintf(stderr, "PackBuilder: %s\n", builder.get_LastError().c_str());
+            return 2;
+        }
+
+        printf("PackBuilder: %zu files written to %s\n", builder.get_Count(), pathPack.string().c_str());
+    }
+    catch (const std::exception& e)
+    {
+        fprintf(stderr, "PackBuilder: %s\n", e.what());
+        return 2;
+    }
+
+    return 0;
+}